@@ -0,0 +1,1542 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200112L
+#include <stdint.h>          /* Standard integer types */
+#include <limits.h>          /* Integer limits */
+#include <stdbool.h>         /* Standard boolean types */
+#include <stdio.h>           /* Standard IO library */
+#include <stdlib.h>          /* Standard library */
+#include <string.h>          /* Standard string library */
+#include <unistd.h>          /* POSIX options and system configuration */
+#include "cimlib.h"          /* Library header */
+#include "bench_libs.h"      /* Libraries bench functions */
+#include "bench_all.h"       /* All libraries bench */
+
+
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Bench buffer size, in bytes per element of maximum length. Functions with
+ * larger elements are limited to shorter lengths */
+#define BUF_ELEM_BYTES  (8)
+
+/* Frame functions parameters */
+#define CIC_ORDER       (3)         /* CIC filter order */
+#define CIC_RATE        (4)         /* CIC decimation/interpolation rate */
+#define WIN_LEN         (64)        /* Moving window and sliding DFT length */
+#define NR_BINS         (4)         /* Number of DFT bins */
+#define RADIX_W         (30)        /* DFT twiddles radix */
+
+/* Maximum length of functions with O(len^2) complexity */
+#define LEN_SORT        (4096)
+
+/* Bench entry of function */
+#define BENCH_ENTRY(F, BYTES, SIZE, RDX, MAX_LEN)                              \
+    {#F, bench_##F, (BYTES), (SIZE), (RDX), (MAX_LEN)}
+
+/* Element wise, 'Z = f(X, Y)' */
+#define BENCH_ZXY(F, TZ, TX, TY)                                               \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    (void)radix;                                                               \
+    F((TZ *)pBufZ, len, (const TX *)pBufX, (const TY *)pBufY);                 \
+}
+
+/* Element wise with radix, 'Z = f(X, Y)' */
+#define BENCH_ZRXY(F, TZ, TX, TY)                                              \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    F((TZ *)pBufZ, len, radix, (const TX *)pBufX, (const TY *)pBufY);          \
+}
+
+/* Element wise with radix, 'Z = f(X, Y, W)' */
+#define BENCH_ZRXYW(F, T)                                                      \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    F((T *)pBufZ, len, radix, (const T *)pBufX, (const T *)pBufY,              \
+      (const T *)pBufW);                                                       \
+}
+
+/* Element wise with radix and constant, 'Z = f(X, const, Y)' */
+#define BENCH_ZRXCY(F, T)                                                      \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    F((T *)pBufZ, len, radix, (const T *)pBufX, *(const T *)pBufW,             \
+      (const T *)pBufY);                                                       \
+}
+
+/* Element wise with radix and radix offset, 'Z = f(X, Y)' */
+#define BENCH_ZRXYO(F, T)                                                      \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    F((T *)pBufZ, len, radix, (const T *)pBufX, (const T *)pBufY, -1);        \
+}
+
+/* Element wise, 'Y = f(X)' */
+#define BENCH_YX(F, TY, TX)                                                    \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    (void)radix;                                                               \
+    F((TY *)pBufZ, len, (const TX *)pBufX);                                    \
+}
+
+/* Element wise with radix, 'Y = f(X)' */
+#define BENCH_YRX(F, TY, TX)                                                   \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    F((TY *)pBufZ, len, radix, (const TX *)pBufX);                             \
+}
+
+/* Element wise with radix, conversion from floating point 'Y = f(X)' */
+#define BENCH_YRFX(F, TY, TX, BUF)                                             \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    F((TY *)pBufZ, len, radix, CIMLIB_CONV_RND | CIMLIB_CONV_SAT,              \
+      (const TX *)(BUF));                                                      \
+}
+
+/* Accumulation, 'Y += f(X)' */
+#define BENCH_AX(F, TY, TX)                                                    \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    (void)radix;                                                               \
+    F((TY *)pBufZ, len, (const TX *)pBufX);                                    \
+}
+
+/* EMA accumulation, alpha is 1/16 */
+#define BENCH_EMA(F, T)                                                        \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    F((T *)pBufZ, len, (T)(1 << (radix - 4)), radix, (const T *)pBufX);        \
+}
+
+/* Element wise with constant, 'Y = f(X, const)' */
+#define BENCH_YXC(F, T)                                                        \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    (void)radix;                                                               \
+    F((T *)pBufZ, len, (const T *)pBufX, *(const T *)pBufW);                   \
+}
+
+/* Element wise with radix and constant, 'Y = f(X, const)' */
+#define BENCH_YRXC(F, T)                                                       \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    F((T *)pBufZ, len, radix, (const T *)pBufX, *(const T *)pBufW);            \
+}
+
+/* Element wise, planar input, 'Y = f(XRe, XIm)' */
+#define BENCH_YXP(F, TY, TX)                                                   \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    (void)radix;                                                               \
+    F((TY *)pBufZ, len, (const TX *)pBufX, (const TX *)pBufX + len);           \
+}
+
+/* Element wise, planar output, '(YRe, YIm) = f(X)' */
+#define BENCH_YPX(F, TY, TX)                                                   \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    (void)radix;                                                               \
+    F((TY *)pBufZ, (TY *)pBufZ + len, len, (const TX *)pBufX);                 \
+}
+
+/* Element wise, planar, '(ZRe, ZIm) = f(XRe, XIm, YRe, YIm)' */
+#define BENCH_ZPXPYP(F, T)                                                     \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    (void)radix;                                                               \
+    F((T *)pBufZ, (T *)pBufZ + len, len, (const T *)pBufX,                     \
+      (const T *)pBufX + len, (const T *)pBufY, (const T *)pBufY + len);       \
+}
+
+/* Element wise with radix, planar, '(ZRe, ZIm) = f(XRe, XIm, YRe, YIm)' */
+#define BENCH_ZPRXPYP(F, T)                                                    \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    F((T *)pBufZ, (T *)pBufZ + len, len, radix, (const T *)pBufX,              \
+      (const T *)pBufX + len, (const T *)pBufY, (const T *)pBufY + len);       \
+}
+
+/* Reduction, 'f(X)' */
+#define BENCH_RX(F, TX)                                                        \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    (void)radix;                                                               \
+    (void)F((const TX *)pBufX, len);                                           \
+}
+
+/* Reduction with radix, 'f(X)' */
+#define BENCH_RXR(F, TX)                                                       \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    (void)F((const TX *)pBufX, len, radix);                                    \
+}
+
+/* Reduction, 'f(X, Y)' */
+#define BENCH_RXY(F, TX, TY)                                                   \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    (void)radix;                                                               \
+    (void)F((const TX *)pBufX, (const TY *)pBufY, len);                        \
+}
+
+/* Reduction with radix, 'f(X, Y)' */
+#define BENCH_RXYR(F, TX, TY)                                                  \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    (void)F((const TX *)pBufX, (const TY *)pBufY, len, radix);                 \
+}
+
+/* Reduction with radix, planar, 'f(XRe, XIm, YRe, YIm)' */
+#define BENCH_RXPYPR(F, T)                                                     \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    (void)F((const T *)pBufX, (const T *)pBufX + len, (const T *)pBufY,        \
+            (const T *)pBufY + len, len, radix);                               \
+}
+
+/* Reduction with index, 'f(X)' */
+#define BENCH_RIX(F, TX)                                                       \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    int idx;                                                                   \
+    (void)radix;                                                               \
+    (void)F(&idx, (const TX *)pBufX, len);                                     \
+}
+
+/* Reduction with index and radix, 'f(X)' */
+#define BENCH_RIXR(F, TX)                                                      \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    int idx;                                                                   \
+    (void)F(&idx, (const TX *)pBufX, len, radix);                              \
+}
+
+/* Scalar function of one argument, called for each element */
+#define BENCH_SC1(F, TR, TX)                                                   \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    int n;                                                                     \
+    (void)radix;                                                               \
+    for (n = 0; n < len; n++) {                                                \
+        ((TR *)pBufZ)[n] = F(((const TX *)pBufX)[n]);                          \
+    }                                                                          \
+}
+
+/* Scalar function of one argument with radix */
+#define BENCH_SC1R(F, TR, TX)                                                  \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    int n;                                                                     \
+    for (n = 0; n < len; n++) {                                                \
+        ((TR *)pBufZ)[n] = F(((const TX *)pBufX)[n], radix);                   \
+    }                                                                          \
+}
+
+/* Scalar function of two arguments */
+#define BENCH_SC2(F, TR, TX, TY)                                               \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    int n;                                                                     \
+    (void)radix;                                                               \
+    for (n = 0; n < len; n++) {                                                \
+        ((TR *)pBufZ)[n] = F(((const TX *)pBufX)[n],                           \
+                             ((const TY *)pBufY)[n]);                          \
+    }                                                                          \
+}
+
+/* Scalar function of two arguments with radix */
+#define BENCH_SC2R(F, TR, TX, TY)                                              \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    int n;                                                                     \
+    for (n = 0; n < len; n++) {                                                \
+        ((TR *)pBufZ)[n] = F(((const TX *)pBufX)[n],                           \
+                             ((const TY *)pBufY)[n], radix);                   \
+    }                                                                          \
+}
+
+/* Scalar function of three arguments */
+#define BENCH_SC3(F, TR, TX, TY, TW)                                           \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    int n;                                                                     \
+    (void)radix;                                                               \
+    for (n = 0; n < len; n++) {                                                \
+        ((TR *)pBufZ)[n] = F(((const TX *)pBufX)[n],                           \
+                             ((const TY *)pBufY)[n],                           \
+                             ((const TW *)pBufW)[n]);                          \
+    }                                                                          \
+}
+
+/* Scalar function of three arguments with radix */
+#define BENCH_SC3R(F, TR, TX, TY, TW)                                          \
+static void bench_##F(int len, int radix)                                      \
+{                                                                              \
+    int n;                                                                     \
+    for (n = 0; n < len; n++) {                                                \
+        ((TR *)pBufZ)[n] = F(((const TX *)pBufX)[n],                           \
+                             ((const TY *)pBufY)[n],                           \
+                             ((const TW *)pBufW)[n], radix);                   \
+    }                                                                          \
+}
+
+
+/* -----------------------------------------------------------------------------
+ * Global variables
+ * ---------------------------------------------------------------------------*/
+
+/* Bench buffers, 'BUF_ELEM_BYTES' per element of maximum length. Inputs
+ * 'X', 'Y' and 'W' are pseudo random, 'D' and 'F' are the same values in
+ * double and float formats, 'Z' is output */
+static uint8_t *pBufX, *pBufY, *pBufW, *pBufZ;
+static double *pBufD;
+static float *pBufF;
+
+/* Workspace arena */
+static mem_arena_t arena;
+
+/* Parallel backend thread pool */
+static par_pool_t *pPool;
+
+/* DFT twiddles, bins 1..4 of 64 */
+static const cint32_t twiddles[NR_BINS] = {
+    CIMLIB_CONST_C32(0.9951847267, 0.0980171403, RADIX_W),
+    CIMLIB_CONST_C32(0.9807852804, 0.1950903220, RADIX_W),
+    CIMLIB_CONST_C32(0.9569403357, 0.2902846773, RADIX_W),
+    CIMLIB_CONST_C32(0.9238795325, 0.3826834324, RADIX_W)
+};
+
+
+/* -----------------------------------------------------------------------------
+ * Bench functions
+ * ---------------------------------------------------------------------------*/
+
+/* Frame math library, states are kept between calls as in streaming use */
+
+static void bench_frm_cic_decim_s16(int len, int radix)
+{
+    static frm_cic_s16_t states;
+    static uint64_t reg[CIMLIB_CIC_REG_LEN(CIC_ORDER, 1)];
+
+    (void)radix;
+    if (states.pReg == NULL) {
+        frm_cic_decim_init_s16(&states, reg, 1, CIC_ORDER, CIC_RATE);
+    }
+    (void)frm_cic_decim_s16((int16_t *)pBufZ, &states, (const int16_t *)pBufX,
+                            len);
+}
+
+static void bench_frm_cic_interp_s16(int len, int radix)
+{
+    static frm_cic_s16_t states;
+    static uint64_t reg[CIMLIB_CIC_REG_LEN(CIC_ORDER, 1)];
+
+    (void)radix;
+    if (states.pReg == NULL) {
+        frm_cic_interp_init_s16(&states, reg, 1, CIC_ORDER, CIC_RATE);
+    }
+    (void)frm_cic_interp_s16((int16_t *)pBufZ, &states, (const int16_t *)pBufX,
+                             len);
+}
+
+static void bench_frm_ema_blk_s32(int len, int radix)
+{
+    (void)frm_ema_blk_s32((int32_t *)pBufZ, len, 0, 1 << (radix - 4), radix);
+}
+
+static void bench_frm_ema_s16(int len, int radix)
+{
+    (void)frm_ema_s16((int16_t *)pBufZ, len, 0, (int16_t)(1 << (radix - 4)),
+                      radix);
+}
+
+static void bench_frm_ema_s32(int len, int radix)
+{
+    (void)frm_ema_s32((int32_t *)pBufZ, len, 0, 1 << (radix - 4), radix);
+}
+
+static void bench_frm_goertzel_s16(int len, int radix)
+{
+    (void)radix;
+    frm_goertzel_s16((uint64_t *)pBufZ, NR_BINS, (const int16_t *)pBufX, len,
+                     twiddles, RADIX_W);
+}
+
+static void bench_frm_movavg_s16(int len, int radix)
+{
+    static frm_movavg_s16_t states;
+    static int16_t hist[WIN_LEN];
+
+    (void)radix;
+    if (states.pHist == NULL) {
+        frm_movavg_init_s16(&states, hist, WIN_LEN);
+    }
+    frm_movavg_s16((int16_t *)pBufZ, &states, (const int16_t *)pBufX, len);
+}
+
+static void bench_frm_movavg_s32(int len, int radix)
+{
+    static frm_movavg_s32_t states;
+    static int32_t hist[WIN_LEN];
+
+    (void)radix;
+    if (states.pHist == NULL) {
+        frm_movavg_init_s32(&states, hist, WIN_LEN);
+    }
+    frm_movavg_s32((int32_t *)pBufZ, &states, (const int32_t *)pBufX, len);
+}
+
+static void bench_frm_movsum_sqr_c16(int len, int radix)
+{
+    static frm_movsum_sqr_c16_t states;
+    static cint16_t hist[WIN_LEN];
+
+    (void)radix;
+    if (states.pHist == NULL) {
+        frm_movsum_sqr_init_c16(&states, hist, WIN_LEN);
+    }
+    frm_movsum_sqr_c16((uint64_t *)pBufZ, &states, (const cint16_t *)pBufX,
+                       len);
+}
+
+static void bench_frm_movsum_sqr_s16(int len, int radix)
+{
+    static frm_movsum_sqr_s16_t states;
+    static int16_t hist[WIN_LEN];
+
+    (void)radix;
+    if (states.pHist == NULL) {
+        frm_movsum_sqr_init_s16(&states, hist, WIN_LEN);
+    }
+    frm_movsum_sqr_s16((uint64_t *)pBufZ, &states, (const int16_t *)pBufX,
+                       len);
+}
+
+static void bench_frm_sdft_c16(int len, int radix)
+{
+    static frm_sdft_c16_t states;
+    static cint32_t bins[NR_BINS];
+    static cint16_t hist[WIN_LEN];
+
+    (void)radix;
+    if (states.pHist == NULL) {
+        frm_sdft_init_c16(&states, bins, twiddles, NR_BINS, hist, WIN_LEN,
+                          RADIX_W);
+    }
+    frm_sdft_c16((uint64_t *)pBufZ, &states, (const cint16_t *)pBufX, len);
+}
+
+static void bench_frm_stats_s16(int len, int radix)
+{
+    frm_stats_s16_t stats;
+
+    frm_stats_s16(&stats, CIMLIB_STATS_ALL, (const int16_t *)pBufX, len,
+                  radix);
+}
+
+static void bench_frm_stats_s32(int len, int radix)
+{
+    frm_stats_s32_t stats;
+
+    frm_stats_s32(&stats, CIMLIB_STATS_ALL, (const int32_t *)pBufX, len,
+                  radix);
+}
+
+
+/* Memory operations library, in place functions work on copy of input */
+
+static void bench_mem_kth_min_s16(int len, int radix)
+{
+    (void)radix;
+    (void)memcpy(pBufZ, pBufX, len * sizeof(int16_t));
+    (void)mem_kth_min_s16((int16_t *)pBufZ, len, len / 4);
+}
+
+static void bench_mem_kth_min_s32(int len, int radix)
+{
+    (void)radix;
+    (void)memcpy(pBufZ, pBufX, len * sizeof(int32_t));
+    (void)mem_kth_min_s32((int32_t *)pBufZ, len, len / 4);
+}
+
+static void bench_mem_kth_min_ws_s16(int len, int radix)
+{
+    int16_t kth;
+    size_t mark = mem_arena_mark(&arena);
+
+    (void)radix;
+    (void)mem_kth_min_ws_s16(&kth, &arena, (const int16_t *)pBufX, len,
+                             len / 4);
+    mem_arena_reset(&arena, mark);
+}
+
+static void bench_mem_kth_min_ws_s32(int len, int radix)
+{
+    int32_t kth;
+    size_t mark = mem_arena_mark(&arena);
+
+    (void)radix;
+    (void)mem_kth_min_ws_s32(&kth, &arena, (const int32_t *)pBufX, len,
+                             len / 4);
+    mem_arena_reset(&arena, mark);
+}
+
+static void bench_mem_median_s16(int len, int radix)
+{
+    (void)radix;
+    (void)memcpy(pBufZ, pBufX, len * sizeof(int16_t));
+    (void)mem_median_s16((int16_t *)pBufZ, len);
+}
+
+static void bench_mem_median_s32(int len, int radix)
+{
+    (void)radix;
+    (void)memcpy(pBufZ, pBufX, len * sizeof(int32_t));
+    (void)mem_median_s32((int32_t *)pBufZ, len);
+}
+
+static void bench_mem_median_ws_s16(int len, int radix)
+{
+    int16_t med;
+    size_t mark = mem_arena_mark(&arena);
+
+    (void)radix;
+    (void)mem_median_ws_s16(&med, &arena, (const int16_t *)pBufX, len);
+    mem_arena_reset(&arena, mark);
+}
+
+static void bench_mem_median_ws_s32(int len, int radix)
+{
+    int32_t med;
+    size_t mark = mem_arena_mark(&arena);
+
+    (void)radix;
+    (void)mem_median_ws_s32(&med, &arena, (const int32_t *)pBufX, len);
+    mem_arena_reset(&arena, mark);
+}
+
+static void bench_mem_sort_s16(int len, int radix)
+{
+    (void)radix;
+    (void)memcpy(pBufZ, pBufX, len * sizeof(int16_t));
+    mem_sort_s16((int16_t *)pBufZ, len);
+}
+
+static void bench_mem_sort_s32(int len, int radix)
+{
+    (void)radix;
+    (void)memcpy(pBufZ, pBufX, len * sizeof(int32_t));
+    mem_sort_s32((int32_t *)pBufZ, len);
+}
+
+
+/* Parallel backend library */
+
+static void bench_par_mem_kth_min_ws_s32(int len, int radix)
+{
+    int32_t kth;
+    size_t mark = mem_arena_mark(&arena);
+
+    (void)radix;
+    (void)par_mem_kth_min_ws_s32(pPool, &kth, &arena, (const int32_t *)pBufX,
+                                 len, len / 4);
+    mem_arena_reset(&arena, mark);
+}
+
+static void bench_par_mem_median_ws_s32(int len, int radix)
+{
+    int32_t med;
+    size_t mark = mem_arena_mark(&arena);
+
+    (void)radix;
+    (void)par_mem_median_ws_s32(pPool, &med, &arena, (const int32_t *)pBufX,
+                                len);
+    mem_arena_reset(&arena, mark);
+}
+
+static void bench_par_mem_sort_ws_s32(int len, int radix)
+{
+    size_t mark = mem_arena_mark(&arena);
+
+    (void)radix;
+    (void)memcpy(pBufZ, pBufX, len * sizeof(int32_t));
+    (void)par_mem_sort_ws_s32(pPool, &arena, (int32_t *)pBufZ, len);
+    mem_arena_reset(&arena, mark);
+}
+
+static void bench_par_vec_max_s32(int len, int radix)
+{
+    int idx;
+
+    (void)radix;
+    (void)par_vec_max_s32(pPool, &idx, (const int32_t *)pBufX, len);
+}
+
+static void bench_par_vec_mul_c16(int len, int radix)
+{
+    par_vec_mul_c16(pPool, (cint16_t *)pBufZ, len, radix,
+                    (const cint16_t *)pBufX, (const cint16_t *)pBufY);
+}
+
+static void bench_par_vec_mul_c32(int len, int radix)
+{
+    par_vec_mul_c32(pPool, (cint32_t *)pBufZ, len, radix,
+                    (const cint32_t *)pBufX, (const cint32_t *)pBufY);
+}
+
+static void bench_par_vec_sum_s32(int len, int radix)
+{
+    (void)radix;
+    (void)par_vec_sum_s32(pPool, (const int32_t *)pBufX, len);
+}
+
+static void bench_par_vec_sum_sqr_long_s32(int len, int radix)
+{
+    (void)radix;
+    (void)par_vec_sum_sqr_long_s32(pPool, (const int32_t *)pBufX, len);
+}
+
+
+/* Scalar math library, called for each element */
+
+BENCH_SC2(sc_add_c16, cint16_t, cint16_t, cint16_t)
+BENCH_SC2(sc_add_c32, cint32_t, cint32_t, cint32_t)
+BENCH_SC2(sc_add_sat_c16, cint16_t, cint16_t, cint16_t)
+BENCH_SC2(sc_add_sat_c32, cint32_t, cint32_t, cint32_t)
+BENCH_SC2(sc_add_sat_s16, int16_t, int16_t, int16_t)
+BENCH_SC2(sc_add_sat_s32, int32_t, int32_t, int32_t)
+BENCH_SC2R(sc_atan2_s16, int16_t, int16_t, int16_t)
+BENCH_SC2R(sc_atan2_s32, int32_t, int32_t, int32_t)
+BENCH_SC1R(sc_cos_s16, int16_t, int16_t)
+BENCH_SC1R(sc_cos_s32, int32_t, int32_t)
+BENCH_SC2R(sc_div_c16, cint16_t, cint16_t, cint16_t)
+BENCH_SC2R(sc_div_c32, cint32_t, cint32_t, cint32_t)
+BENCH_SC2R(sc_div_s16, int16_t, int16_t, int16_t)
+BENCH_SC2R(sc_div_s32, int32_t, int32_t, int32_t)
+BENCH_SC3R(sc_ema_s16, int16_t, int16_t, int16_t, int16_t)
+BENCH_SC3R(sc_ema_s32, int32_t, int32_t, int32_t, int32_t)
+BENCH_SC1R(sc_ln_u16, int16_t, uint16_t)
+BENCH_SC1R(sc_ln_u32, int32_t, uint32_t)
+BENCH_SC1R(sc_log10_u16, int16_t, uint16_t)
+BENCH_SC1R(sc_log10_u32, int32_t, uint32_t)
+BENCH_SC1(sc_log2_int_u16, int, uint16_t)
+BENCH_SC1(sc_log2_int_u32, int, uint32_t)
+BENCH_SC1(sc_log2_int_u64, int, uint64_t)
+BENCH_SC1R(sc_log2_u16, int16_t, uint16_t)
+BENCH_SC1R(sc_log2_u32, int32_t, uint32_t)
+BENCH_SC3R(sc_mac_c16, cint16_t, cint16_t, cint16_t, cint16_t)
+BENCH_SC3R(sc_mac_c32, cint32_t, cint32_t, cint32_t, cint32_t)
+BENCH_SC3R(sc_mac_cj_c16, cint16_t, cint16_t, cint16_t, cint16_t)
+BENCH_SC3R(sc_mac_cj_c32, cint32_t, cint32_t, cint32_t, cint32_t)
+BENCH_SC3(sc_mac_cj_long_c16, cint32_t, cint16_t, cint16_t, cint32_t)
+BENCH_SC3(sc_mac_cj_long_c32, cint64_t, cint32_t, cint32_t, cint64_t)
+BENCH_SC3(sc_mac_long_c16, cint32_t, cint16_t, cint16_t, cint32_t)
+BENCH_SC3(sc_mac_long_c32, cint64_t, cint32_t, cint32_t, cint64_t)
+BENCH_SC3(sc_mac_long_s16, int32_t, int16_t, int16_t, int32_t)
+BENCH_SC3(sc_mac_long_s32, int64_t, int32_t, int32_t, int64_t)
+BENCH_SC3R(sc_mac_s16, int16_t, int16_t, int16_t, int16_t)
+BENCH_SC3R(sc_mac_s32, int32_t, int32_t, int32_t, int32_t)
+BENCH_SC3R(sc_mac_sat_c16, cint16_t, cint16_t, cint16_t, cint16_t)
+BENCH_SC3R(sc_mac_sat_c32, cint32_t, cint32_t, cint32_t, cint32_t)
+BENCH_SC3R(sc_mac_sat_s16, int16_t, int16_t, int16_t, int16_t)
+BENCH_SC3R(sc_mac_sat_s32, int32_t, int32_t, int32_t, int32_t)
+BENCH_SC1(sc_mag_c16, uint16_t, cint16_t)
+BENCH_SC1(sc_mag_c32, uint32_t, cint32_t)
+BENCH_SC2(sc_max_s16, int16_t, int16_t, int16_t)
+BENCH_SC2(sc_max_s32, int32_t, int32_t, int32_t)
+BENCH_SC2(sc_min_s16, int16_t, int16_t, int16_t)
+BENCH_SC2(sc_min_s32, int32_t, int32_t, int32_t)
+BENCH_SC2R(sc_mul_c16, cint16_t, cint16_t, cint16_t)
+BENCH_SC2R(sc_mul_c16s16, cint16_t, cint16_t, int16_t)
+BENCH_SC2R(sc_mul_c32, cint32_t, cint32_t, cint32_t)
+BENCH_SC2R(sc_mul_c32s32, cint32_t, cint32_t, int32_t)
+BENCH_SC2R(sc_mul_cj_c16, cint16_t, cint16_t, cint16_t)
+BENCH_SC2R(sc_mul_cj_c32, cint32_t, cint32_t, cint32_t)
+BENCH_SC2(sc_mul_cj_long_c16, cint32_t, cint16_t, cint16_t)
+BENCH_SC2(sc_mul_cj_long_c32, cint64_t, cint32_t, cint32_t)
+BENCH_SC2R(sc_mul_cj_sat_c16, cint16_t, cint16_t, cint16_t)
+BENCH_SC2R(sc_mul_cj_sat_c32, cint32_t, cint32_t, cint32_t)
+BENCH_SC2(sc_mul_long_c16, cint32_t, cint16_t, cint16_t)
+BENCH_SC2(sc_mul_long_c32, cint64_t, cint32_t, cint32_t)
+BENCH_SC2(sc_mul_long_s16, int32_t, int16_t, int16_t)
+BENCH_SC2(sc_mul_long_s32, int64_t, int32_t, int32_t)
+BENCH_SC2R(sc_mul_s16, int16_t, int16_t, int16_t)
+BENCH_SC2R(sc_mul_s32, int32_t, int32_t, int32_t)
+BENCH_SC2R(sc_mul_sat_c16, cint16_t, cint16_t, cint16_t)
+BENCH_SC2R(sc_mul_sat_c32, cint32_t, cint32_t, cint32_t)
+BENCH_SC2R(sc_mul_sat_s16, int16_t, int16_t, int16_t)
+BENCH_SC2R(sc_mul_sat_s32, int32_t, int32_t, int32_t)
+BENCH_SC1R(sc_norm_c16, cint16_t, cint16_t)
+BENCH_SC1R(sc_norm_c32, cint32_t, cint32_t)
+BENCH_SC1R(sc_rcp_s16, int16_t, int16_t)
+BENCH_SC1R(sc_rcp_s32, int32_t, int32_t)
+BENCH_SC1R(sc_sin_s16, int16_t, int16_t)
+BENCH_SC1R(sc_sin_s32, int32_t, int32_t)
+BENCH_SC1R(sc_sqr_c16, uint16_t, cint16_t)
+BENCH_SC1R(sc_sqr_c32, uint32_t, cint32_t)
+BENCH_SC1(sc_sqr_long_c16, uint32_t, cint16_t)
+BENCH_SC1(sc_sqr_long_c32, uint64_t, cint32_t)
+BENCH_SC1(sc_sqr_long_s16, uint32_t, int16_t)
+BENCH_SC1(sc_sqr_long_s32, uint64_t, int32_t)
+BENCH_SC1R(sc_sqr_s16, uint16_t, int16_t)
+BENCH_SC1R(sc_sqr_s32, uint32_t, int32_t)
+BENCH_SC1R(sc_sqr_sat_s16, uint16_t, int16_t)
+BENCH_SC1R(sc_sqr_sat_s32, uint32_t, int32_t)
+BENCH_SC1R(sc_sqr_sat_c16, uint16_t, cint16_t)
+BENCH_SC1R(sc_sqr_sat_c32, uint32_t, cint32_t)
+BENCH_SC1(sc_sqr_xlong_s64, uint128_t, int64_t)
+BENCH_SC1(sc_sqrt_u32, uint16_t, uint32_t)
+BENCH_SC1(sc_sqrt_u64, uint32_t, uint64_t)
+BENCH_SC2(sc_sub_c16, cint16_t, cint16_t, cint16_t)
+BENCH_SC2(sc_sub_c32, cint32_t, cint32_t, cint32_t)
+
+/* Vector math library, block floating point vectors are set over buffers */
+
+static void bench_vec_bfp_add_s16(int len, int radix)
+{
+    vec_bfp_s16_t z = {(int16_t *)pBufZ, len, 0};
+    vec_bfp_s16_t x = {(int16_t *)pBufX, len, -2};
+    vec_bfp_s16_t y = {(int16_t *)pBufY, len, -3};
+
+    (void)radix;
+    vec_bfp_add_s16(&z, &x, &y);
+}
+
+static void bench_vec_bfp_from_s16(int len, int radix)
+{
+    vec_bfp_s16_t y = {(int16_t *)pBufZ, len, 0};
+
+    vec_bfp_from_s16(&y, (const int16_t *)pBufX, radix);
+}
+
+static void bench_vec_bfp_from_s32(int len, int radix)
+{
+    vec_bfp_s16_t y = {(int16_t *)pBufZ, len, 0};
+
+    vec_bfp_from_s32(&y, (const int32_t *)pBufX, radix);
+}
+
+static void bench_vec_bfp_headroom_s16(int len, int radix)
+{
+    vec_bfp_s16_t x = {(int16_t *)pBufX, len, -2};
+
+    (void)radix;
+    (void)vec_bfp_headroom_s16(&x);
+}
+
+static void bench_vec_bfp_mac_s16(int len, int radix)
+{
+    vec_bfp_s16_t z = {(int16_t *)pBufZ, len, -2};
+    vec_bfp_s16_t x = {(int16_t *)pBufX, len, -2};
+    vec_bfp_s16_t y = {(int16_t *)pBufY, len, -3};
+
+    (void)radix;
+    vec_bfp_mac_s16(&z, &x, &y);
+}
+
+static void bench_vec_bfp_mul_s16(int len, int radix)
+{
+    vec_bfp_s16_t z = {(int16_t *)pBufZ, len, 0};
+    vec_bfp_s16_t x = {(int16_t *)pBufX, len, -2};
+    vec_bfp_s16_t y = {(int16_t *)pBufY, len, -3};
+
+    (void)radix;
+    vec_bfp_mul_s16(&z, &x, &y);
+}
+
+static void bench_vec_bfp_norm_s16(int len, int radix)
+{
+    vec_bfp_s16_t x = {(int16_t *)pBufZ, len, 0};
+
+    (void)radix;
+    vec_bfp_norm_s16(&x);
+}
+
+static void bench_vec_bfp_scale_s16(int len, int radix)
+{
+    vec_bfp_s16_t y = {(int16_t *)pBufZ, len, 0};
+    vec_bfp_s16_t x = {(int16_t *)pBufX, len, -2};
+
+    vec_bfp_scale_s16(&y, &x, (int16_t)(1 << (radix - 1)), radix);
+}
+
+static void bench_vec_bfp_sum_sqr_s16(int len, int radix)
+{
+    int exp;
+    vec_bfp_s16_t x = {(int16_t *)pBufX, len, -2};
+
+    (void)radix;
+    (void)vec_bfp_sum_sqr_s16(&exp, &x);
+}
+
+static void bench_vec_bfp_to_s16(int len, int radix)
+{
+    vec_bfp_s16_t x = {(int16_t *)pBufX, len, -2};
+
+    vec_bfp_to_s16((int16_t *)pBufZ, &x, radix);
+}
+
+static void bench_vec_bfp_to_s32(int len, int radix)
+{
+    vec_bfp_s16_t x = {(int16_t *)pBufX, len, -2};
+
+    vec_bfp_to_s32((int32_t *)pBufZ, &x, radix);
+}
+
+BENCH_YX(vec_abs_s16, int16_t, int16_t)
+BENCH_YX(vec_abs_s32, int32_t, int32_t)
+BENCH_YX(vec_abs_s64, int64_t, int64_t)
+BENCH_ZXY(vec_add_c16, cint16_t, cint16_t, cint16_t)
+BENCH_ZPXPYP(vec_add_c16p, int16_t)
+BENCH_ZXY(vec_add_c32, cint32_t, cint32_t, cint32_t)
+BENCH_ZPXPYP(vec_add_c32p, int32_t)
+BENCH_ZXY(vec_add_c64, cint64_t, cint64_t, cint64_t)
+BENCH_YXC(vec_add_const_c16, cint16_t)
+BENCH_YXC(vec_add_const_c32, cint32_t)
+BENCH_YXC(vec_add_const_s16, int16_t)
+BENCH_YXC(vec_add_const_s32, int32_t)
+BENCH_YXC(vec_add_const_sat_c16, cint16_t)
+BENCH_YXC(vec_add_const_sat_c32, cint32_t)
+BENCH_YXC(vec_add_const_sat_s16, int16_t)
+BENCH_YXC(vec_add_const_sat_s32, int32_t)
+BENCH_ZXY(vec_add_s16, int16_t, int16_t, int16_t)
+BENCH_ZXY(vec_add_s32, int32_t, int32_t, int32_t)
+BENCH_ZXY(vec_add_s64, int64_t, int64_t, int64_t)
+BENCH_ZXY(vec_add_sat_c16, cint16_t, cint16_t, cint16_t)
+BENCH_ZXY(vec_add_sat_c32, cint32_t, cint32_t, cint32_t)
+BENCH_ZXY(vec_add_sat_s16, int16_t, int16_t, int16_t)
+BENCH_ZXY(vec_add_sat_s32, int32_t, int32_t, int32_t)
+BENCH_RXR(vec_cent_mass_s16, int16_t)
+BENCH_RXR(vec_cent_mass_s32, int32_t)
+BENCH_RXR(vec_cent_mass_u16, uint16_t)
+BENCH_RXR(vec_cent_mass_u32, uint32_t)
+BENCH_YPX(vec_deinterleave_c16, int16_t, cint16_t)
+BENCH_YPX(vec_deinterleave_c32, int32_t, cint32_t)
+BENCH_EMA(vec_ema_s16, int16_t)
+BENCH_EMA(vec_ema_s32, int32_t)
+BENCH_YRFX(vec_from_double_c16, cint16_t, double, pBufD)
+BENCH_YRFX(vec_from_double_c32, cint32_t, double, pBufD)
+BENCH_YRFX(vec_from_double_s16, int16_t, double, pBufD)
+BENCH_YRFX(vec_from_double_s32, int32_t, double, pBufD)
+BENCH_YRFX(vec_from_float_c16, cint16_t, float, pBufF)
+BENCH_YRFX(vec_from_float_c32, cint32_t, float, pBufF)
+BENCH_YRFX(vec_from_float_s16, int16_t, float, pBufF)
+BENCH_YRFX(vec_from_float_s32, int32_t, float, pBufF)
+BENCH_YXP(vec_interleave_c16, cint16_t, int16_t)
+BENCH_YXP(vec_interleave_c32, cint32_t, int32_t)
+BENCH_ZRXY(vec_mac_c16, cint16_t, cint16_t, cint16_t)
+BENCH_ZPRXPYP(vec_mac_c16p, int16_t)
+BENCH_ZRXY(vec_mac_c32, cint32_t, cint32_t, cint32_t)
+BENCH_ZPRXPYP(vec_mac_c32p, int32_t)
+BENCH_ZRXY(vec_mac_cj_c16, cint16_t, cint16_t, cint16_t)
+BENCH_ZRXY(vec_mac_cj_c32, cint32_t, cint32_t, cint32_t)
+BENCH_ZXY(vec_mac_cj_long_c16, cint32_t, cint16_t, cint16_t)
+BENCH_ZXY(vec_mac_cj_long_c32, cint64_t, cint32_t, cint32_t)
+BENCH_ZRXY(vec_mac_cj_sat_c16, cint16_t, cint16_t, cint16_t)
+BENCH_ZRXY(vec_mac_cj_sat_c32, cint32_t, cint32_t, cint32_t)
+BENCH_ZRXYO(vec_mac_cj_scale_sat_c16, cint16_t)
+BENCH_ZRXYO(vec_mac_cj_scale_sat_c32, cint32_t)
+BENCH_ZXY(vec_mac_long_c16, cint32_t, cint16_t, cint16_t)
+BENCH_ZXY(vec_mac_long_c32, cint64_t, cint32_t, cint32_t)
+BENCH_ZXY(vec_mac_long_s16, int32_t, int16_t, int16_t)
+BENCH_ZXY(vec_mac_long_s32, int64_t, int32_t, int32_t)
+BENCH_ZRXY(vec_mac_s16, int16_t, int16_t, int16_t)
+BENCH_ZRXY(vec_mac_s32, int32_t, int32_t, int32_t)
+BENCH_ZRXY(vec_mac_sat_c16, cint16_t, cint16_t, cint16_t)
+BENCH_ZRXY(vec_mac_sat_c32, cint32_t, cint32_t, cint32_t)
+BENCH_ZRXY(vec_mac_sat_s16, int16_t, int16_t, int16_t)
+BENCH_ZRXY(vec_mac_sat_s32, int32_t, int32_t, int32_t)
+BENCH_YX(vec_mag_c16, uint16_t, cint16_t)
+BENCH_YXP(vec_mag_c16p, uint16_t, int16_t)
+BENCH_YX(vec_mag_c32, uint32_t, cint32_t)
+BENCH_YXP(vec_mag_c32p, uint32_t, int32_t)
+BENCH_RIX(vec_max_s16, int16_t)
+BENCH_RIX(vec_max_s32, int32_t)
+BENCH_RIXR(vec_max_sqr_c16, cint16_t)
+BENCH_RIXR(vec_max_sqr_c32, cint32_t)
+BENCH_RIXR(vec_max_sqr_s16, int16_t)
+BENCH_RIXR(vec_max_sqr_s32, int32_t)
+BENCH_RIXR(vec_max_sqr_sat_c16, cint16_t)
+BENCH_RIXR(vec_max_sqr_sat_c32, cint32_t)
+BENCH_RIXR(vec_max_sqr_sat_s16, int16_t)
+BENCH_RIXR(vec_max_sqr_sat_s32, int32_t)
+BENCH_RIX(vec_min_s16, int16_t)
+BENCH_RIX(vec_min_s32, int32_t)
+BENCH_RIXR(vec_min_sqr_c16, cint16_t)
+BENCH_RIXR(vec_min_sqr_c32, cint32_t)
+BENCH_RIXR(vec_min_sqr_s16, int16_t)
+BENCH_RIXR(vec_min_sqr_s32, int32_t)
+BENCH_RIXR(vec_min_sqr_sat_c16, cint16_t)
+BENCH_RIXR(vec_min_sqr_sat_c32, cint32_t)
+BENCH_RIXR(vec_min_sqr_sat_s16, int16_t)
+BENCH_RIXR(vec_min_sqr_sat_s32, int32_t)
+BENCH_ZRXYW(vec_mul_add_sat_c16, cint16_t)
+BENCH_ZRXYW(vec_mul_add_sat_c32, cint32_t)
+BENCH_ZRXYW(vec_mul_add_sat_s16, int16_t)
+BENCH_ZRXYW(vec_mul_add_sat_s32, int32_t)
+BENCH_ZRXY(vec_mul_c16, cint16_t, cint16_t, cint16_t)
+BENCH_ZPRXPYP(vec_mul_c16p, int16_t)
+BENCH_ZRXY(vec_mul_c16s16, cint16_t, cint16_t, int16_t)
+BENCH_ZRXY(vec_mul_c32, cint32_t, cint32_t, cint32_t)
+BENCH_ZPRXPYP(vec_mul_c32p, int32_t)
+BENCH_ZRXY(vec_mul_c32s32, cint32_t, cint32_t, int32_t)
+BENCH_ZRXY(vec_mul_cj_c16, cint16_t, cint16_t, cint16_t)
+BENCH_ZRXY(vec_mul_cj_c32, cint32_t, cint32_t, cint32_t)
+BENCH_ZXY(vec_mul_cj_long_c16, cint32_t, cint16_t, cint16_t)
+BENCH_ZXY(vec_mul_cj_long_c32, cint64_t, cint32_t, cint32_t)
+BENCH_ZRXY(vec_mul_cj_sat_c16, cint16_t, cint16_t, cint16_t)
+BENCH_ZRXY(vec_mul_cj_sat_c32, cint32_t, cint32_t, cint32_t)
+BENCH_ZRXCY(vec_mul_const_add_sat_c16, cint16_t)
+BENCH_ZRXCY(vec_mul_const_add_sat_c32, cint32_t)
+BENCH_ZRXCY(vec_mul_const_add_sat_s16, int16_t)
+BENCH_ZRXCY(vec_mul_const_add_sat_s32, int32_t)
+BENCH_YRXC(vec_mul_const_c16, cint16_t)
+BENCH_YRXC(vec_mul_const_c32, cint32_t)
+BENCH_YRXC(vec_mul_const_s16, int16_t)
+BENCH_YRXC(vec_mul_const_s32, int32_t)
+BENCH_YRXC(vec_mul_const_sat_c16, cint16_t)
+BENCH_YRXC(vec_mul_const_sat_c32, cint32_t)
+BENCH_YRXC(vec_mul_const_sat_s16, int16_t)
+BENCH_YRXC(vec_mul_const_sat_s32, int32_t)
+BENCH_ZXY(vec_mul_long_c16, cint32_t, cint16_t, cint16_t)
+BENCH_ZXY(vec_mul_long_c32, cint64_t, cint32_t, cint32_t)
+BENCH_ZXY(vec_mul_long_s16, int32_t, int16_t, int16_t)
+BENCH_ZXY(vec_mul_long_s32, int64_t, int32_t, int32_t)
+BENCH_ZRXY(vec_mul_mag_c16, uint16_t, cint16_t, cint16_t)
+BENCH_ZRXY(vec_mul_mag_c32, uint32_t, cint32_t, cint32_t)
+BENCH_ZRXY(vec_mul_s16, int16_t, int16_t, int16_t)
+BENCH_ZRXY(vec_mul_s16_a, int16_t, int16_t, int16_t)
+BENCH_ZRXY(vec_mul_s32, int32_t, int32_t, int32_t)
+BENCH_ZRXY(vec_mul_sat_c16, cint16_t, cint16_t, cint16_t)
+BENCH_ZRXY(vec_mul_sat_c32, cint32_t, cint32_t, cint32_t)
+BENCH_ZRXY(vec_mul_sat_s16, int16_t, int16_t, int16_t)
+BENCH_ZRXY(vec_mul_sat_s32, int32_t, int32_t, int32_t)
+BENCH_YRX(vec_narrow_sat_c64_c32, cint32_t, cint64_t)
+BENCH_YRX(vec_narrow_sat_s32_s16, int16_t, int32_t)
+BENCH_YRX(vec_narrow_sat_s64_s32, int32_t, int64_t)
+BENCH_YRX(vec_scale_radix_s16, int16_t, int16_t)
+BENCH_YRX(vec_scale_radix_s32, int32_t, int32_t)
+BENCH_YRX(vec_sqr_c16, uint16_t, cint16_t)
+BENCH_YRX(vec_sqr_c32, uint32_t, cint32_t)
+BENCH_YX(vec_sqr_long_c16, uint32_t, cint16_t)
+BENCH_YXP(vec_sqr_long_c16p, uint32_t, int16_t)
+BENCH_YX(vec_sqr_long_c32, uint64_t, cint32_t)
+BENCH_YXP(vec_sqr_long_c32p, uint64_t, int32_t)
+BENCH_YX(vec_sqr_long_s16, uint32_t, int16_t)
+BENCH_YX(vec_sqr_long_s32, uint64_t, int32_t)
+BENCH_YRX(vec_sqr_s16, uint16_t, int16_t)
+BENCH_YRX(vec_sqr_s32, uint32_t, int32_t)
+BENCH_YRX(vec_sqr_sat_c16, uint16_t, cint16_t)
+BENCH_YRX(vec_sqr_sat_c32, uint32_t, cint32_t)
+BENCH_YRX(vec_sqr_sat_c64, uint64_t, cint64_t)
+BENCH_YRX(vec_sqr_sat_s16, uint16_t, int16_t)
+BENCH_YRX(vec_sqr_sat_s32, uint32_t, int32_t)
+BENCH_YRX(vec_sqr_sat_s64, uint64_t, int64_t)
+BENCH_AX(vec_sqra_long_c16, uint32_t, cint16_t)
+BENCH_AX(vec_sqra_long_c32, uint64_t, cint32_t)
+BENCH_AX(vec_sqra_long_s16, uint32_t, int16_t)
+BENCH_AX(vec_sqra_long_s32, uint64_t, int32_t)
+BENCH_YX(vec_sqrt_u64, uint32_t, uint64_t)
+BENCH_ZXY(vec_sub_c16, cint16_t, cint16_t, cint16_t)
+BENCH_ZPXPYP(vec_sub_c16p, int16_t)
+BENCH_ZXY(vec_sub_c32, cint32_t, cint32_t, cint32_t)
+BENCH_ZPXPYP(vec_sub_c32p, int32_t)
+BENCH_ZXY(vec_sub_c64, cint64_t, cint64_t, cint64_t)
+BENCH_ZXY(vec_sub_s16, int16_t, int16_t, int16_t)
+BENCH_ZXY(vec_sub_s32, int32_t, int32_t, int32_t)
+BENCH_ZXY(vec_sub_s64, int64_t, int64_t, int64_t)
+BENCH_ZXY(vec_sub_sat_c16, cint16_t, cint16_t, cint16_t)
+BENCH_ZXY(vec_sub_sat_c32, cint32_t, cint32_t, cint32_t)
+BENCH_ZXY(vec_sub_sat_s16, int16_t, int16_t, int16_t)
+BENCH_ZXY(vec_sub_sat_s32, int32_t, int32_t, int32_t)
+BENCH_RX(vec_sum_c16, cint16_t)
+BENCH_RX(vec_sum_c32, cint32_t)
+BENCH_RX(vec_sum_c64, cint64_t)
+BENCH_RXY(vec_sum_diff_c16, cint16_t, cint16_t)
+BENCH_RXY(vec_sum_diff_c32, cint32_t, cint32_t)
+BENCH_RXY(vec_sum_diff_s16, int16_t, int16_t)
+BENCH_RXY(vec_sum_diff_s32, int32_t, int32_t)
+BENCH_RX(vec_sum_mag_c16, cint16_t)
+BENCH_RX(vec_sum_mag_c32, cint32_t)
+BENCH_RXYR(vec_sum_mul_c16, cint16_t, cint16_t)
+BENCH_RXYR(vec_sum_mul_c16s16, cint16_t, int16_t)
+BENCH_RXYR(vec_sum_mul_c32, cint32_t, cint32_t)
+BENCH_RXYR(vec_sum_mul_c32s32, cint32_t, int32_t)
+BENCH_RXYR(vec_sum_mul_cj_c16, cint16_t, cint16_t)
+BENCH_RXPYPR(vec_sum_mul_cj_c16p, int16_t)
+BENCH_RXYR(vec_sum_mul_cj_c32, cint32_t, cint32_t)
+BENCH_RXPYPR(vec_sum_mul_cj_c32p, int32_t)
+BENCH_RXYR(vec_sum_mul_s16, int16_t, int16_t)
+BENCH_RXYR(vec_sum_mul_s16_a, int16_t, int16_t)
+BENCH_RXYR(vec_sum_mul_s32, int32_t, int32_t)
+BENCH_RX(vec_sum_s16, int16_t)
+BENCH_RX(vec_sum_s32, int32_t)
+BENCH_RX(vec_sum_s64, int64_t)
+BENCH_RXR(vec_sum_sqr_c16, cint16_t)
+BENCH_RXR(vec_sum_sqr_c32, cint32_t)
+BENCH_RXYR(vec_sum_sqr_diff_c16, cint16_t, cint16_t)
+BENCH_RXYR(vec_sum_sqr_diff_c32, cint32_t, cint32_t)
+BENCH_RXYR(vec_sum_sqr_diff_s16, int16_t, int16_t)
+BENCH_RXYR(vec_sum_sqr_diff_s32, int32_t, int32_t)
+BENCH_RX(vec_sum_sqr_long_c16, cint16_t)
+BENCH_RX(vec_sum_sqr_long_c32, cint32_t)
+BENCH_RX(vec_sum_sqr_long_s16, int16_t)
+BENCH_RX(vec_sum_sqr_long_s32, int32_t)
+BENCH_RXR(vec_sum_sqr_s16, int16_t)
+BENCH_RXR(vec_sum_sqr_s32, int32_t)
+BENCH_RX(vec_sum_sqr_xlong_c32, cint32_t)
+BENCH_RX(vec_sum_sqr_xlong_s32, int32_t)
+BENCH_YRX(vec_to_double_c16, double, cint16_t)
+BENCH_YRX(vec_to_double_c32, double, cint32_t)
+BENCH_YRX(vec_to_double_s16, double, int16_t)
+BENCH_YRX(vec_to_double_s32, double, int32_t)
+BENCH_YRX(vec_to_float_c16, float, cint16_t)
+BENCH_YRX(vec_to_float_c32, float, cint32_t)
+BENCH_YRX(vec_to_float_s16, float, int16_t)
+BENCH_YRX(vec_to_float_s32, float, int32_t)
+BENCH_YRX(vec_widen_s16_s32, int32_t, int16_t)
+BENCH_YRX(vec_widen_s32_s64, int64_t, int32_t)
+
+
+/* -----------------------------------------------------------------------------
+ * Bench entries
+ * ---------------------------------------------------------------------------*/
+
+/* Bench entries, all libraries */
+static const bench_entry_t entries[] = {
+    /* Frame math library */
+    BENCH_ENTRY(frm_cic_decim_s16,          2,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(frm_cic_interp_s16,        10,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(frm_ema_blk_s32,            8,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(frm_ema_s16,                4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(frm_ema_s32,                8,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(frm_goertzel_s16,           2,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(frm_movavg_s16,             4,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(frm_movavg_s32,             8,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(frm_movsum_sqr_c16,        12,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(frm_movsum_sqr_s16,        10,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(frm_sdft_c16,               4,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(frm_stats_s16,              2,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(frm_stats_s32,              4,  4, BENCH_RDX_32,   0),
+
+    /* Memory operations library */
+    BENCH_ENTRY(mem_kth_min_s16,            4,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(mem_kth_min_s32,            8,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(mem_kth_min_ws_s16,         2,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(mem_kth_min_ws_s32,         4,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(mem_median_s16,             4,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(mem_median_s32,             8,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(mem_median_ws_s16,          2,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(mem_median_ws_s32,          4,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(mem_sort_s16,               4,  2, BENCH_RDX_NONE, LEN_SORT),
+    BENCH_ENTRY(mem_sort_s32,               8,  4, BENCH_RDX_NONE, LEN_SORT),
+
+    /* Parallel backend library */
+    BENCH_ENTRY(par_mem_kth_min_ws_s32,     4,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(par_mem_median_ws_s32,      4,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(par_mem_sort_ws_s32,        8,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(par_vec_max_s32,            4,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(par_vec_mul_c16,           12,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(par_vec_mul_c32,           24,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(par_vec_sum_s32,            4,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(par_vec_sum_sqr_long_s32,   4,  4, BENCH_RDX_NONE, 0),
+
+    /* Scalar math library */
+    BENCH_ENTRY(sc_add_c16,                12,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_add_c32,                24,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_add_sat_c16,            12,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_add_sat_c32,            24,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_add_sat_s16,             6,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_add_sat_s32,            12,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_atan2_s16,               6,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_atan2_s32,              12,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_cos_s16,                 4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_cos_s32,                 8,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_div_c16,                12,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_div_c32,                24,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_div_s16,                 6,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_div_s32,                12,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_ema_s16,                 8,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_ema_s32,                16,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_ln_u16,                  4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_ln_u32,                  8,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_log10_u16,               4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_log10_u32,               8,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_log2_int_u16,            6,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_log2_int_u32,            8,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_log2_int_u64,           12,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_log2_u16,                4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_log2_u32,                8,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_mac_c16,                16,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_mac_c32,                32,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_mac_cj_c16,             16,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_mac_cj_c32,             32,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_mac_cj_long_c16,        24,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_mac_cj_long_c32,        48, 16, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_mac_long_c16,           24,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_mac_long_c32,           48, 16, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_mac_long_s16,           12,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_mac_long_s32,           24,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_mac_s16,                 8,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_mac_s32,                16,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_mac_sat_c16,            16,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_mac_sat_c32,            32,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_mac_sat_s16,             8,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_mac_sat_s32,            16,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_mag_c16,                 6,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_mag_c32,                12,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_max_s16,                 6,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_max_s32,                12,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_min_s16,                 6,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_min_s32,                12,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_mul_c16,                12,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_mul_c16s16,             10,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_mul_c32,                24,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_mul_c32s32,             20,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_mul_cj_c16,             12,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_mul_cj_c32,             24,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_mul_cj_long_c16,        16,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_mul_cj_long_c32,        32, 16, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_mul_cj_sat_c16,         12,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_mul_cj_sat_c32,         24,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_mul_long_c16,           16,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_mul_long_c32,           32, 16, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_mul_long_s16,            8,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_mul_long_s32,           16,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_mul_s16,                 6,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_mul_s32,                12,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_mul_sat_c16,            12,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_mul_sat_c32,            24,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_mul_sat_s16,             6,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_mul_sat_s32,            12,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_norm_c16,                8,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_norm_c32,               16,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_rcp_s16,                 4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_rcp_s32,                 8,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_sin_s16,                 4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_sin_s32,                 8,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_sqr_c16,                 6,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_sqr_c32,                12,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_sqr_long_c16,            8,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_sqr_long_c32,           16,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_sqr_long_s16,            6,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_sqr_long_s32,           12,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_sqr_s16,                 4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_sqr_s32,                 8,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_sqr_sat_c16,             6,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_sqr_sat_c32,            12,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_sqr_sat_s16,             4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(sc_sqr_sat_s32,             8,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(sc_sqr_xlong_s64,          24, 16, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_sqrt_u32,                6,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_sqrt_u64,               12,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_sub_c16,                12,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(sc_sub_c32,                24,  8, BENCH_RDX_NONE, 0),
+
+    /* Vector math library */
+    BENCH_ENTRY(vec_abs_s16,                4,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_abs_s32,                8,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_abs_s64,               16,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_c16,               12,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_c16p,              12,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_c32,               24,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_c32p,              24,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_c64,               48, 16, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_const_c16,          8,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_const_c32,         16,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_const_s16,          4,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_const_s32,          8,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_const_sat_c16,      8,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_const_sat_c32,     16,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_const_sat_s16,      4,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_const_sat_s32,      8,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_s16,                6,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_s32,               12,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_s64,               24,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_sat_c16,           12,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_sat_c32,           24,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_sat_s16,            6,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_add_sat_s32,           12,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_bfp_add_s16,            6,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_bfp_from_s16,           4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_bfp_from_s32,           6,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_bfp_headroom_s16,       2,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_bfp_mac_s16,            8,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_bfp_mul_s16,            6,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_bfp_norm_s16,           4,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_bfp_scale_s16,          4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_bfp_sum_sqr_s16,        2,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_bfp_to_s16,             4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_bfp_to_s32,             6,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_cent_mass_s16,          2,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_cent_mass_s32,          4,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_cent_mass_u16,          2,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_cent_mass_u32,          4,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_deinterleave_c16,       8,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_deinterleave_c32,      16, 16, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_ema_s16,                6,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_ema_s32,               12,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_from_double_c16,       20, 16, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_from_double_c32,       24, 16, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_from_double_s16,       10,  8, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_from_double_s32,       12,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_from_float_c16,        12,  8, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_from_float_c32,        16,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_from_float_s16,         6,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_from_float_s32,         8,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_interleave_c16,         8,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_interleave_c32,        16, 16, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_mac_c16,               16,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mac_c16p,              14,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mac_c32,               32,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mac_c32p,              28,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mac_cj_c16,            16,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mac_cj_c32,            32,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mac_cj_long_c16,       24,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_mac_cj_long_c32,       48, 16, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_mac_cj_sat_c16,        16,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mac_cj_sat_c32,        32,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mac_cj_scale_sat_c16,  16,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mac_cj_scale_sat_c32,  32,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mac_long_c16,          24,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_mac_long_c32,          48, 16, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_mac_long_s16,          12,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_mac_long_s32,          24,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_mac_s16,                8,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mac_s32,               16,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mac_sat_c16,           16,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mac_sat_c32,           32,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mac_sat_s16,            8,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mac_sat_s32,           16,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mag_c16,                6,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_mag_c16p,               6,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_mag_c32,               12,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_mag_c32p,              12,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_max_s16,                2,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_max_s32,                4,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_max_sqr_c16,            4,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_max_sqr_c32,            8,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_max_sqr_s16,            2,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_max_sqr_s32,            4,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_max_sqr_sat_c16,        4,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_max_sqr_sat_c32,        8,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_max_sqr_sat_s16,        2,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_max_sqr_sat_s32,        4,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_min_s16,                2,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_min_s32,                4,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_min_sqr_c16,            4,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_min_sqr_c32,            8,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_min_sqr_s16,            2,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_min_sqr_s32,            4,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_min_sqr_sat_c16,        4,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_min_sqr_sat_c32,        8,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_min_sqr_sat_s16,        2,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_min_sqr_sat_s32,        4,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mul_add_sat_c16,       16,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mul_add_sat_c32,       32,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mul_add_sat_s16,        8,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mul_add_sat_s32,       16,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mul_c16,               12,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mul_c16p,              12,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mul_c16s16,            10,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mul_c32,               24,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mul_c32p,              24,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mul_c32s32,            20,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mul_cj_c16,            12,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mul_cj_c32,            24,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mul_cj_long_c16,       16,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_mul_cj_long_c32,       32, 16, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_mul_cj_sat_c16,        12,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mul_cj_sat_c32,        24,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mul_const_add_sat_c16, 12,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mul_const_add_sat_c32, 24,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mul_const_add_sat_s16,  6,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mul_const_add_sat_s32, 12,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mul_const_c16,          8,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mul_const_c32,         16,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mul_const_s16,          4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mul_const_s32,          8,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mul_const_sat_c16,      8,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mul_const_sat_c32,     16,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mul_const_sat_s16,      4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mul_const_sat_s32,      8,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mul_long_c16,          16,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_mul_long_c32,          32, 16, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_mul_long_s16,           8,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_mul_long_s32,          16,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_mul_mag_c16,           10,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mul_mag_c32,           20,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mul_s16,                6,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mul_s16_a,              6,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mul_s32,               12,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mul_sat_c16,           12,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mul_sat_c32,           24,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_mul_sat_s16,            6,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_mul_sat_s32,           12,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_narrow_sat_c64_c32,    24, 16, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_narrow_sat_s32_s16,     6,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_narrow_sat_s64_s32,    12,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_scale_radix_s16,        4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_scale_radix_s32,        8,  4, BENCH_RDX_OFS,  0),
+    BENCH_ENTRY(vec_sqr_c16,                6,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_sqr_c32,               12,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_sqr_long_c16,           8,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sqr_long_c16p,          8,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sqr_long_c32,          16,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sqr_long_c32p,         16, 16, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sqr_long_s16,           6,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sqr_long_s32,          12,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sqr_s16,                4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_sqr_s32,                8,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_sqr_sat_c16,            6,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_sqr_sat_c32,           12,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_sqr_sat_c64,           24, 16, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_sqr_sat_s16,            4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_sqr_sat_s32,            8,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_sqr_sat_s64,           16,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_sqra_long_c16,         12,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sqra_long_c32,         24,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sqra_long_s16,         10,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sqra_long_s32,         20,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sqrt_u64,              12,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sub_c16,               12,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sub_c16p,              12,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sub_c32,               24,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sub_c32p,              24,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sub_c64,               48, 16, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sub_s16,                6,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sub_s32,               12,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sub_s64,               24,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sub_sat_c16,           12,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sub_sat_c32,           24,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sub_sat_s16,            6,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sub_sat_s32,           12,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sum_c16,                4,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sum_c32,                8,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sum_c64,               16, 16, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sum_diff_c16,           8,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sum_diff_c32,          16,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sum_diff_s16,           4,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sum_diff_s32,           8,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sum_mag_c16,            4,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sum_mag_c32,            8,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sum_mul_c16,            8,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_sum_mul_c16s16,         6,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_sum_mul_c32,           16,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_sum_mul_c32s32,        12,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_sum_mul_cj_c16,         8,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_sum_mul_cj_c16p,        8,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_sum_mul_cj_c32,        16,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_sum_mul_cj_c32p,       16,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_sum_mul_s16,            4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_sum_mul_s16_a,          4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_sum_mul_s32,            8,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_sum_s16,                2,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sum_s32,                4,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sum_s64,                8,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sum_sqr_c16,            4,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_sum_sqr_c32,            8,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_sum_sqr_diff_c16,       8,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_sum_sqr_diff_c32,      16,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_sum_sqr_diff_s16,       4,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_sum_sqr_diff_s32,       8,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_sum_sqr_long_c16,       4,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sum_sqr_long_c32,       8,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sum_sqr_long_s16,       2,  2, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sum_sqr_long_s32,       4,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sum_sqr_s16,            2,  2, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_sum_sqr_s32,            4,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_sum_sqr_xlong_c32,      8,  8, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_sum_sqr_xlong_s32,      4,  4, BENCH_RDX_NONE, 0),
+    BENCH_ENTRY(vec_to_double_c16,         20, 16, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_to_double_c32,         24, 16, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_to_double_s16,         10,  8, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_to_double_s32,         12,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_to_float_c16,          12,  8, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_to_float_c32,          16,  8, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_to_float_s16,           6,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_to_float_s32,           8,  4, BENCH_RDX_32,   0),
+    BENCH_ENTRY(vec_widen_s16_s32,          6,  4, BENCH_RDX_16,   0),
+    BENCH_ENTRY(vec_widen_s32_s64,         12,  8, BENCH_RDX_32,   0)
+};
+
+
+/* -----------------------------------------------------------------------------
+ * Local functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function fills bench buffers by pseudo random values. Each 16 bit
+ * word has magnitude in [2^13..2^14) and random sign, so divisors are never
+ * zero and products of 32 bit values fit 64 bits.
+ *
+ * @param[in]  len  Length of buffers, in 16 bit words.
+ ******************************************************************************/
+static void bench_fill(int len)
+{
+    int n;
+    uint32_t seed = 1u;
+    uint16_t rnd;
+    int16_t x;
+
+    for (n = 0; n < len; n++) {
+        seed = seed * 1664525u + 1013904223u;
+        rnd = (uint16_t)(seed >> 16);
+        x = (int16_t)(0x2000 | (rnd & 0x1FFF));
+        x = ((rnd & 0x8000) != 0) ? (int16_t)-x : x;
+
+        ((int16_t *)pBufX)[n] = x;
+        ((int16_t *)pBufY)[n] = (int16_t)(x ^ 0x0F0F);
+        ((int16_t *)pBufW)[n] = (int16_t)(x ^ 0x00FF);
+        ((int16_t *)pBufZ)[n] = x;
+    }
+
+    for (n = 0; n < len / 2; n++) {
+        if (n < len / 4) {
+            pBufD[n] = CIMLIB_DOUBLE(((int16_t *)pBufX)[n], 14);
+        }
+        pBufF[n] = CIMLIB_FLOAT(((int16_t *)pBufX)[n], 14);
+    }
+}
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * All libraries bench. Thread pool of parallel backend is created before
+ * caller thread is pinned, so its workers are not pinned to the same core.
+ *
+ * @param[in]  pCfg  Pointer to bench configuration.
+ *
+ * @return           'true' if bench is done, 'false' - otherwise.
+ ******************************************************************************/
+bool bench_all(const bench_cfg_t *pCfg)
+{
+    bool flOk = false;
+    size_t bufBytes, arenaBytes;
+    void *pArenaBuf = NULL;
+    bench_cfg_t cfg = *pCfg;
+
+    bufBytes = (size_t)cfg.maxLen * BUF_ELEM_BYTES;
+    arenaBytes = par_mem_sort_ws_size_s32(cfg.maxLen);
+    if (arenaBytes < mem_median_ws_size_s32(cfg.maxLen)) {
+        arenaBytes = mem_median_ws_size_s32(cfg.maxLen);
+    }
+    if (arenaBytes < par_mem_kth_min_ws_size_s32(cfg.maxLen)) {
+        arenaBytes = par_mem_kth_min_ws_size_s32(cfg.maxLen);
+    }
+
+    pBufX = pBufY = pBufW = pBufZ = NULL;
+    pBufD = NULL;
+    pBufF = NULL;
+    if ((posix_memalign((void **)&pBufX, CIMLIB_ALIGN_BYTES, bufBytes) == 0) &&
+        (posix_memalign((void **)&pBufY, CIMLIB_ALIGN_BYTES, bufBytes) == 0) &&
+        (posix_memalign((void **)&pBufW, CIMLIB_ALIGN_BYTES, bufBytes) == 0) &&
+        (posix_memalign((void **)&pBufZ, CIMLIB_ALIGN_BYTES, bufBytes) == 0) &&
+        (posix_memalign((void **)&pBufD, CIMLIB_ALIGN_BYTES, bufBytes) == 0) &&
+        (posix_memalign((void **)&pBufF, CIMLIB_ALIGN_BYTES, bufBytes) == 0) &&
+        (posix_memalign(&pArenaBuf, CIMLIB_ALIGN_BYTES, arenaBytes) == 0)) {
+        bench_fill((int)(bufBytes / sizeof(int16_t)));
+        mem_arena_init(&arena, pArenaBuf, arenaBytes);
+
+        pPool = par_pool_create(cfg.nrThreads);
+        cfg.nrThreads = par_pool_threads(pPool);
+
+        if ((cfg.cpu >= 0) && !bench_pin_cpu(cfg.cpu)) {
+            printf("Can not pin bench to core %d.\n", cfg.cpu);
+            cfg.cpu = -1;
+        }
+
+        printf("\nBench '%s' platform libraries, core %d, %d threads, "
+               "median of %d runs:\n", cfg.platform, cfg.cpu, cfg.nrThreads,
+               cfg.nrRuns);
+
+        flOk = bench_run(&cfg, entries, sizeof(entries) / sizeof(entries[0]),
+                         bufBytes);
+
+        par_pool_destroy(pPool);
+    } else {
+        printf("There is no memory for bench buffers.\n");
+    }
+
+    free(pArenaBuf);
+    free(pBufF);
+    free(pBufD);
+    free(pBufZ);
+    free(pBufW);
+    free(pBufY);
+    free(pBufX);
+
+    return flOk;
+}
+
+
+#if (CIMLIB_BUILD_BENCH_STANDALONE == 1)
+/*******************************************************************************
+ * Main function for standalone bench.
+ *
+ * Usage: bench <platform> [-f prefix] [-l min_len] [-m max_len] [-n runs]
+ *                         [-c core] [-t threads] [-o json_path] [-p 0|1]
+ ******************************************************************************/
+int main(int argc, char *argv[])
+{
+    int opt;
+    long nrCpus;
+    bench_cfg_t cfg;
+
+    nrCpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    cfg.platform = (argc > 1) ? argv[1] : "unknown";
+    cfg.pFilter = NULL;
+    cfg.minLen = BENCH_MIN_LEN;
+    cfg.maxLen = BENCH_MAX_LEN;
+    cfg.nrRuns = BENCH_NR_RUNS;
+    cfg.cpu = 0;
+    cfg.nrThreads = (nrCpus > 0) ? (int)nrCpus : 1;
+    cfg.pPathJson = NULL;
+    cfg.flPerf = true;
+
+    /* Options follow platform name */
+    optind = 2;
+    while ((opt = getopt(argc, argv, "f:l:m:n:c:t:o:p:")) != -1) {
+        switch (opt) {
+        case 'f': cfg.pFilter = optarg; break;
+        case 'l': cfg.minLen = atoi(optarg); break;
+        case 'm': cfg.maxLen = atoi(optarg); break;
+        case 'n': cfg.nrRuns = atoi(optarg); break;
+        case 'c': cfg.cpu = atoi(optarg); break;
+        case 't': cfg.nrThreads = atoi(optarg); break;
+        case 'o': cfg.pPathJson = optarg; break;
+        case 'p': cfg.flPerf = (atoi(optarg) != 0); break;
+        default:
+            printf("Usage: %s <platform> [-f prefix] [-l min_len] "
+                   "[-m max_len] [-n runs] [-c core] [-t threads] "
+                   "[-o json_path] [-p 0|1]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    /* Length is stepped by 4 up to the maximum, it shall not overflow */
+    if ((cfg.minLen < 1) || (cfg.maxLen < cfg.minLen) ||
+        (cfg.maxLen > INT_MAX / 4)) {
+        printf("Invalid length range.\n");
+        return 1;
+    }
+
+    /* Bench platform library */
+    return bench_all(&cfg) ? 0 : 1;
+}
+#endif /* (CIMLIB_BUILD_BENCH_STANDALONE == 1) */
@@ -0,0 +1,409 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#define _GNU_SOURCE
+#include <stdio.h>           /* Standard IO library */
+#include <stdlib.h>          /* Standard library */
+#include <string.h>          /* Standard string library */
+#include <time.h>            /* Standard time library */
+#include <sched.h>           /* Scheduler, CPU affinity */
+#include "bench_libs.h"      /* Libraries bench functions */
+#include "bench_perf.h"      /* Hardware counters of bench */
+
+
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Duration of one timed run, in ns. Short functions are repeated */
+#define RUN_NS      (200000.0)
+
+/* Number of radices of radix sweep */
+#define NR_RADICES  (2)
+
+
+/* -----------------------------------------------------------------------------
+ * Types
+ * ---------------------------------------------------------------------------*/
+
+/** Measurement result of one function, radix and length */
+typedef struct {
+    int reps;                            /**< Calls per timed run */
+    double nsElem;                       /**< Median time, ns per element */
+    double nsElemMin;                    /**< Minimum time, ns per element */
+    double nsElemMax;                    /**< Maximum time, ns per element */
+    double samples[BENCH_MAX_RUNS];      /**< Times of runs, ns per element */
+    double perf[BENCH_PERF_NR];          /**< Hardware counts per element,
+                                              negative - not available */
+
+} bench_res_t;
+
+
+/* -----------------------------------------------------------------------------
+ * Global variables
+ * ---------------------------------------------------------------------------*/
+
+/* Radices of radix sweeps, the first one is specialised by
+ * 'CIMLIB_RADIX_SWITCH', the second one is runtime. Radices are valid for
+ * all functions, logarithms included */
+static const int radices[][NR_RADICES] = {
+    {0, 0},                              /* BENCH_RDX_NONE */
+    {12, 13},                            /* BENCH_RDX_16 */
+    {24, 27},                            /* BENCH_RDX_32 */
+    {-4, 4}                              /* BENCH_RDX_OFS */
+};
+
+
+/* -----------------------------------------------------------------------------
+ * Local functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function compares two doubles for 'qsort' function.
+ ******************************************************************************/
+static int bench_cmp(const void *pA, const void *pB)
+{
+    double a = *(const double *)pA;
+    double b = *(const double *)pB;
+
+    return (a > b) - (a < b);
+}
+
+
+/*******************************************************************************
+ * This function measures function, 'nrRuns' timed runs. Number of calls per
+ * run is chosen so run lasts about 'RUN_NS', median of runs is result.
+ * Hardware counters are read over one more run, so they do not disturb
+ * timed runs.
+ *
+ * @param[out]  pRes    Pointer to measurement result.
+ * @param[in]   func    Bench function.
+ * @param[in]   len     Vector length.
+ * @param[in]   radix   Radix.
+ * @param[in]   nrRuns  Number of timed runs.
+ * @param[in]   flPerf  Flag, if 'true' hardware counters are read.
+ ******************************************************************************/
+static void bench_measure(bench_res_t *pRes, bench_func_t func, int len,
+                          int radix, int nrRuns, bool flPerf)
+{
+    int k, r;
+    double t;
+    double sorted[BENCH_MAX_RUNS];
+
+    /* Warm up caches and pages, calibrate number of calls */
+    func(len, radix);
+    t = bench_time_ns();
+    func(len, radix);
+    t = bench_time_ns() - t;
+
+    pRes->reps = (t >= RUN_NS) ? 1 : (int)(RUN_NS / (t + 1.0)) + 1;
+
+    for (k = 0; k < nrRuns; k++) {
+        t = bench_time_ns();
+        for (r = 0; r < pRes->reps; r++) {
+            func(len, radix);
+        }
+        t = bench_time_ns() - t;
+
+        pRes->samples[k] = t / ((double)pRes->reps * len);
+        sorted[k] = pRes->samples[k];
+    }
+
+    qsort(sorted, nrRuns, sizeof(double), bench_cmp);
+    pRes->nsElem = sorted[nrRuns / 2];
+    pRes->nsElemMin = sorted[0];
+    pRes->nsElemMax = sorted[nrRuns - 1];
+
+    for (k = 0; k < BENCH_PERF_NR; k++) {
+        pRes->perf[k] = -1.0;
+    }
+    if (flPerf) {
+        bench_perf_start();
+        for (r = 0; r < pRes->reps; r++) {
+            func(len, radix);
+        }
+        bench_perf_stop(pRes->perf);
+
+        for (k = 0; k < BENCH_PERF_NR; k++) {
+            if (pRes->perf[k] >= 0.0) {
+                pRes->perf[k] /= (double)pRes->reps * len;
+            }
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * This function returns instructions per cycle of measurement result.
+ *
+ * @return  IPC, negative - not available.
+ ******************************************************************************/
+static double bench_ipc(const bench_res_t *pRes)
+{
+    if ((pRes->perf[BENCH_PERF_CYCLES] > 0.0) &&
+        (pRes->perf[BENCH_PERF_INSTR] >= 0.0)) {
+        return pRes->perf[BENCH_PERF_INSTR] / pRes->perf[BENCH_PERF_CYCLES];
+    }
+
+    return -1.0;
+}
+
+
+/*******************************************************************************
+ * This function prints hardware counters of measurement result as table
+ * columns: cycles per element, IPC, and branch, L1 and LLC misses per
+ * element.
+ ******************************************************************************/
+static void bench_print_perf(const bench_res_t *pRes)
+{
+    int k;
+    double v;
+
+    for (k = 0; k < BENCH_PERF_NR; k++) {
+        v = (k == BENCH_PERF_INSTR) ? bench_ipc(pRes) : pRes->perf[k];
+        if (v < 0.0) {
+            printf(" %8s", "-");
+        } else if (k <= BENCH_PERF_INSTR) {
+            printf(" %8.2f", v);
+        } else {
+            printf(" %8.4f", v);
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * This function writes measurement result to JSON file, as one element of
+ * results array.
+ ******************************************************************************/
+static void bench_json_res(FILE *pFile, bool flFirst, const char *name,
+                           int bytes, int radix, bool flRadix, int len,
+                           int nrRuns, bool flPerf, const bench_res_t *pRes)
+{
+    int k;
+    double v;
+
+    fprintf(pFile, "%s\n    {\"name\": \"%s\", \"family\": \"%.*s\", ",
+            flFirst ? "" : ",", name, (int)strcspn(name, "_"), name);
+    if (flRadix) {
+        fprintf(pFile, "\"radix\": %d, ", radix);
+    } else {
+        fprintf(pFile, "\"radix\": null, ");
+    }
+    fprintf(pFile, "\"len\": %d, \"bytes\": %d, \"reps\": %d,\n", len, bytes,
+            pRes->reps);
+    fprintf(pFile, "     \"ns_per_elem\": %.6g, \"elems_per_s\": %.6g, "
+            "\"gb_per_s\": %.6g,\n", pRes->nsElem, 1.0e9 / pRes->nsElem,
+            bytes / pRes->nsElem);
+    fprintf(pFile, "     \"ns_per_elem_min\": %.6g, \"ns_per_elem_max\": "
+            "%.6g,\n     \"samples\": [", pRes->nsElemMin, pRes->nsElemMax);
+    for (k = 0; k < nrRuns; k++) {
+        fprintf(pFile, "%s%.6g", (k == 0) ? "" : ", ", pRes->samples[k]);
+    }
+    fprintf(pFile, "]");
+
+    /* Hardware counts per element, null - not available */
+    if (flPerf) {
+        fprintf(pFile, ",\n     \"perf\": {");
+        for (k = 0; k <= BENCH_PERF_NR; k++) {
+            v = (k == BENCH_PERF_NR) ? bench_ipc(pRes) : pRes->perf[k];
+            fprintf(pFile, "%s\"%s\": ", (k == 0) ? "" : ", ",
+                    (k == BENCH_PERF_NR) ? "ipc" : bench_perf_name(k));
+            if (v < 0.0) {
+                fprintf(pFile, "null");
+            } else {
+                fprintf(pFile, "%.6g", v);
+            }
+        }
+        fprintf(pFile, "}");
+    }
+    fprintf(pFile, "}");
+}
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function returns monotonic time.
+ *
+ * @return  Time, in ns.
+ ******************************************************************************/
+double bench_time_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec * 1.0e9 + (double)ts.tv_nsec;
+}
+
+
+/*******************************************************************************
+ * This function pins calling thread to core, so measurements are not
+ * disturbed by migrations.
+ *
+ * @param[in]  cpu  Core number.
+ *
+ * @return          'true' if thread is pinned, 'false' - otherwise.
+ ******************************************************************************/
+bool bench_pin_cpu(int cpu)
+{
+#if defined(__linux__)
+    cpu_set_t set;
+
+    if ((cpu < 0) || (cpu >= CPU_SETSIZE)) {
+        return false;
+    }
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+
+    return (sched_setaffinity(0, sizeof(set), &set) == 0);
+#else
+    (void)cpu;
+
+    return false;
+#endif
+}
+
+
+/*******************************************************************************
+ * This function runs bench entries over lengths from minimum to maximum one,
+ * length is multiplied by 4, and over radix sweep of each entry. Results are
+ * printed and written to JSON file. Hardware counters are read if they are
+ * enabled and available, bench is timing only otherwise.
+ *
+ * @param[in]  pCfg       Pointer to bench configuration.
+ * @param[in]  pEntries   Pointer to bench entries.
+ * @param[in]  nrEntries  Number of bench entries.
+ * @param[in]  bufBytes   Size of each bench buffer, in bytes, it limits
+ *                        length of entries with large elements.
+ *
+ * @return                'true' if bench is done, 'false' - JSON file can
+ *                        not be written.
+ ******************************************************************************/
+bool bench_run(const bench_cfg_t *pCfg, const bench_entry_t *pEntries,
+               int nrEntries, size_t bufBytes)
+{
+    int n, k, len, radix, nrRdx, nrRuns;
+    bool flFirst = true;
+    bool flPerf = false;
+    FILE *pFile = NULL;
+    const bench_entry_t *pEnt;
+    static bench_res_t res;
+
+    nrRuns = pCfg->nrRuns;
+    if (nrRuns < 1) {
+        nrRuns = 1;
+    } else if (nrRuns > BENCH_MAX_RUNS) {
+        nrRuns = BENCH_MAX_RUNS;
+    }
+
+    if (pCfg->pPathJson != NULL) {
+        pFile = fopen(pCfg->pPathJson, "w");
+        if (pFile == NULL) {
+            printf("Can not open '%s' file.\n", pCfg->pPathJson);
+            return false;
+        }
+    }
+
+    if (pCfg->flPerf) {
+        flPerf = (bench_perf_open() > 0);
+        if (!flPerf) {
+            printf("Hardware counters are not available, timing only.\n");
+        }
+        for (k = 0; flPerf && (k < BENCH_PERF_NR); k++) {
+            if (!bench_perf_avail(k)) {
+                printf("Hardware counter '%s' is not available.\n",
+                       bench_perf_name(k));
+            }
+        }
+    }
+
+    if (pFile != NULL) {
+        fprintf(pFile, "{\n  \"platform\": \"%s\", \"cpu\": %d, "
+                "\"threads\": %d, \"runs\": %d,\n  \"perf\": [",
+                pCfg->platform, pCfg->cpu, pCfg->nrThreads, nrRuns);
+        for (n = 0, k = 0; flPerf && (k < BENCH_PERF_NR); k++) {
+            if (bench_perf_avail(k)) {
+                fprintf(pFile, "%s\"%s\"", (n++ == 0) ? "" : ", ",
+                        bench_perf_name(k));
+            }
+        }
+        fprintf(pFile, "],\n  \"results\": [");
+    }
+
+    printf("\n  %-28s %6s %9s %10s %10s %8s", "function", "radix", "len",
+           "ns/elem", "Melem/s", "GB/s");
+    if (flPerf) {
+        printf(" %8s %8s %8s %8s %8s", "cyc/el", "IPC", "brm/el",
+               "L1m/el", "LLCm/el");
+    }
+    printf("\n");
+
+    for (n = 0; n < nrEntries; n++) {
+        pEnt = &pEntries[n];
+
+        if ((pCfg->pFilter != NULL) &&
+            (strncmp(pEnt->name, pCfg->pFilter, strlen(pCfg->pFilter)) != 0)) {
+            continue;
+        }
+
+        nrRdx = (pEnt->rdx == BENCH_RDX_NONE) ? 1 : NR_RADICES;
+
+        for (k = 0; k < nrRdx; k++) {
+            radix = radices[pEnt->rdx][k];
+
+            for (len = pCfg->minLen; len <= pCfg->maxLen; len *= 4) {
+                if (((pEnt->maxLen != 0) && (len > pEnt->maxLen)) ||
+                    ((size_t)len * pEnt->size > bufBytes)) {
+                    break;
+                }
+
+                bench_measure(&res, pEnt->func, len, radix, nrRuns, flPerf);
+
+                if (pEnt->rdx == BENCH_RDX_NONE) {
+                    printf("  %-28s %6s", pEnt->name, "-");
+                } else {
+                    printf("  %-28s %6d", pEnt->name, radix);
+                }
+                printf(" %9d %10.3f %10.1f %8.2f", len, res.nsElem,
+                       1.0e3 / res.nsElem, pEnt->bytes / res.nsElem);
+                if (flPerf) {
+                    bench_print_perf(&res);
+                }
+                printf("\n");
+
+                if (pFile != NULL) {
+                    bench_json_res(pFile, flFirst, pEnt->name, pEnt->bytes,
+                                   radix, pEnt->rdx != BENCH_RDX_NONE, len,
+                                   nrRuns, flPerf, &res);
+                    flFirst = false;
+                }
+
+                /* Next length is out of range, stop before overflow */
+                if (len > pCfg->maxLen / 4) {
+                    break;
+                }
+            }
+        }
+    }
+
+    if (pFile != NULL) {
+        fprintf(pFile, "\n  ]\n}\n");
+        fclose(pFile);
+    }
+
+    bench_perf_close();
+
+    return true;
+}
@@ -0,0 +1,196 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#define _GNU_SOURCE
+#include <stdint.h>          /* Standard integer types */
+#include <string.h>          /* Standard string library */
+#if defined(__linux__)
+#include <unistd.h>          /* POSIX API */
+#include <sys/ioctl.h>       /* Device control */
+#include <sys/syscall.h>     /* System calls */
+#include <linux/perf_event.h> /* Performance counters */
+#endif
+#include "bench_perf.h"      /* Hardware counters of bench */
+
+
+/* -----------------------------------------------------------------------------
+ * Global variables
+ * ---------------------------------------------------------------------------*/
+
+/* Names of counters */
+static const char *names[BENCH_PERF_NR] = {
+    "cycles", "instructions", "branch_misses", "l1d_misses", "llc_misses"
+};
+
+#if defined(__linux__)
+/* File descriptors of counters, negative - counter is not available */
+static int fds[BENCH_PERF_NR] = {-1, -1, -1, -1, -1};
+
+/* Types and configurations of counters */
+static const uint32_t types[BENCH_PERF_NR] = {
+    PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+    PERF_TYPE_HW_CACHE, PERF_TYPE_HW_CACHE
+};
+static const uint64_t configs[BENCH_PERF_NR] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_BRANCH_MISSES,
+    PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+    PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)
+};
+#endif
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function opens hardware counters of calling thread, user space only,
+ * so it works with default 'perf_event_paranoid' setting. Counters are
+ * opened one by one, not as group, so counter not supported by CPU or
+ * hypervisor does not disable others. Counters of parallel backend workers
+ * are not counted.
+ *
+ * @return  Number of opened counters, 0 - counters are not available (not
+ *          Linux, no PMU in VM or container, or no permission).
+ ******************************************************************************/
+int bench_perf_open(void)
+{
+    int nrOpened = 0;
+#if defined(__linux__)
+    int n;
+    struct perf_event_attr attr;
+
+    for (n = 0; n < BENCH_PERF_NR; n++) {
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = types[n];
+        attr.config = configs[n];
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED |
+                           PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        fds[n] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        nrOpened += (fds[n] >= 0);
+    }
+#endif
+
+    return nrOpened;
+}
+
+
+/*******************************************************************************
+ * This function closes hardware counters.
+ ******************************************************************************/
+void bench_perf_close(void)
+{
+#if defined(__linux__)
+    int n;
+
+    for (n = 0; n < BENCH_PERF_NR; n++) {
+        if (fds[n] >= 0) {
+            close(fds[n]);
+            fds[n] = -1;
+        }
+    }
+#endif
+}
+
+
+/*******************************************************************************
+ * This function checks if hardware counter is opened.
+ *
+ * @param[in]  counter  Counter, 'BENCH_PERF_*'.
+ *
+ * @return              'true' if counter is available, 'false' - otherwise.
+ ******************************************************************************/
+bool bench_perf_avail(int counter)
+{
+#if defined(__linux__)
+    return (fds[counter] >= 0);
+#else
+    (void)counter;
+
+    return false;
+#endif
+}
+
+
+/*******************************************************************************
+ * This function returns name of hardware counter, as used in JSON file.
+ *
+ * @param[in]  counter  Counter, 'BENCH_PERF_*'.
+ *
+ * @return              Name of counter.
+ ******************************************************************************/
+const char *bench_perf_name(int counter)
+{
+    return names[counter];
+}
+
+
+/*******************************************************************************
+ * This function resets and starts opened hardware counters.
+ ******************************************************************************/
+void bench_perf_start(void)
+{
+#if defined(__linux__)
+    int n;
+
+    for (n = 0; n < BENCH_PERF_NR; n++) {
+        if (fds[n] >= 0) {
+            (void)ioctl(fds[n], PERF_EVENT_IOC_RESET, 0);
+        }
+    }
+    for (n = 0; n < BENCH_PERF_NR; n++) {
+        if (fds[n] >= 0) {
+            (void)ioctl(fds[n], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+}
+
+
+/*******************************************************************************
+ * This function stops hardware counters and reads them. If kernel
+ * multiplexes counters, count is scaled by enabled to running time ratio.
+ *
+ * @param[out]  counts  Counts, negative - counter is not available or has
+ *                      not been scheduled.
+ ******************************************************************************/
+void bench_perf_stop(double counts[BENCH_PERF_NR])
+{
+    int n;
+#if defined(__linux__)
+    uint64_t val[3];
+
+    for (n = 0; n < BENCH_PERF_NR; n++) {
+        if (fds[n] >= 0) {
+            (void)ioctl(fds[n], PERF_EVENT_IOC_DISABLE, 0);
+        }
+    }
+#endif
+
+    for (n = 0; n < BENCH_PERF_NR; n++) {
+        counts[n] = -1.0;
+#if defined(__linux__)
+        if ((fds[n] >= 0) &&
+            (read(fds[n], val, sizeof(val)) == (ssize_t)sizeof(val)) &&
+            (val[2] != 0)) {
+            counts[n] = (double)val[0] * ((double)val[1] / (double)val[2]);
+        }
+#endif
+    }
+}
@@ -0,0 +1,25 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+#ifndef BENCH_ALL_H_
+#define BENCH_ALL_H_
+
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include <stdbool.h>         /* Standard boolean types */
+#include "bench_libs.h"      /* Libraries bench functions */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+bool bench_all(const bench_cfg_t *pCfg);
+
+
+#endif /* BENCH_ALL_H_ */
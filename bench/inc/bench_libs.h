@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+#ifndef BENCH_LIBS_H_
+#define BENCH_LIBS_H_
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include <stddef.h>          /* Standard definitions */
+#include <stdint.h>          /* Standard integer types */
+#include <stdbool.h>         /* Standard boolean types */
+
+
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Radix sweep of bench entry */
+#define BENCH_RDX_NONE  (0)         /* Function without radix */
+#define BENCH_RDX_16    (1)         /* 16 bit radices, specialised and not */
+#define BENCH_RDX_32    (2)         /* 32 bit radices, specialised and not */
+#define BENCH_RDX_OFS   (3)         /* Radix offsets, right and left shifts */
+
+/* Default parameters */
+#define BENCH_MIN_LEN   (16)        /* Minimum vector length */
+#define BENCH_MAX_LEN   (1 << 24)   /* Maximum vector length */
+#define BENCH_NR_RUNS   (11)        /* Number of timed runs, median is used */
+#define BENCH_MAX_RUNS  (101)       /* Maximum number of timed runs */
+
+
+/* -----------------------------------------------------------------------------
+ * Types
+ * ---------------------------------------------------------------------------*/
+
+/** Bench function, processes 'len' elements with given radix */
+typedef void (*bench_func_t)(int len, int radix);
+
+/** Bench entry, one library function */
+typedef struct {
+    const char *name;                    /**< Function name */
+    bench_func_t func;                   /**< Bench function */
+    int bytes;                           /**< Bytes read and written per
+                                              element */
+    int size;                            /**< Bytes per element of largest
+                                              buffer */
+    int rdx;                             /**< Radix sweep, 'BENCH_RDX_*' */
+    int maxLen;                          /**< Maximum length, 0 - no limit */
+
+} bench_entry_t;
+
+/** Bench configuration */
+typedef struct {
+    const char *platform;                /**< Platform name */
+    const char *pFilter;                 /**< Function name prefix, NULL -
+                                              all functions */
+    int minLen;                          /**< Minimum vector length */
+    int maxLen;                          /**< Maximum vector length */
+    int nrRuns;                          /**< Number of timed runs */
+    int cpu;                             /**< Pinned core, negative - not
+                                              pinned */
+    int nrThreads;                       /**< Number of parallel backend
+                                              threads */
+    const char *pPathJson;               /**< JSON output path, NULL - no
+                                              JSON */
+    bool flPerf;                         /**< Hardware counters are read */
+
+} bench_cfg_t;
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+bool bench_pin_cpu(int cpu);
+
+bool bench_run(const bench_cfg_t *pCfg, const bench_entry_t *pEntries,
+               int nrEntries, size_t bufBytes);
+
+double bench_time_ns(void);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* BENCH_LIBS_H_ */
@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+#ifndef BENCH_PERF_H_
+#define BENCH_PERF_H_
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include <stdbool.h>         /* Standard boolean types */
+
+
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Hardware counters */
+#define BENCH_PERF_CYCLES    (0)    /* CPU cycles */
+#define BENCH_PERF_INSTR     (1)    /* Retired instructions */
+#define BENCH_PERF_BR_MISS   (2)    /* Mispredicted branches */
+#define BENCH_PERF_L1D_MISS  (3)    /* L1 data cache read misses */
+#define BENCH_PERF_LLC_MISS  (4)    /* Last level cache read misses */
+#define BENCH_PERF_NR        (5)    /* Number of counters */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+int bench_perf_open(void);
+
+void bench_perf_close(void);
+
+bool bench_perf_avail(int counter);
+
+const char *bench_perf_name(int counter);
+
+void bench_perf_start(void);
+
+void bench_perf_stop(double counts[BENCH_PERF_NR]);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* BENCH_PERF_H_ */
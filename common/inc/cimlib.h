@@ -17,8 +17,10 @@ extern "C"
 /* -----------------------------------------------------------------------------
  * Includes
  * ---------------------------------------------------------------------------*/
+#include <stddef.h>          /* Standard definitions */
 #include <stdint.h>          /* Standard integer types */
 #include <stdbool.h>         /* Standard boolean types */
+#include "cimlib_prof.h"     /* Profiled functions */
 #if (CIMLIB_BUILD_TEST == 1)
 #include "test_libs.h"       /* Libraries test functions */
 #endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -87,9 +89,12 @@ extern "C"
 /* TODO Add 'FRAC' definition */
 
 
-/* Saturate signed value */
+/* Saturate signed integer value, floating point one is saturated by
+ * 'CIMLIB_SAT_FLT' */
 #define CIMLIB_SAT_INT(Y, LIM, X)                                              \
 {                                                                              \
+    CIMLIB_PROF_SAT((int64_t)(X), ((X) > (LIM)) || ((X) < (-(LIM) - 1)),      \
+                    (uint64_t)(LIM))                                           \
     (Y) = (X);                                                                 \
     if ((X) > (LIM)) (Y) = (LIM);                                              \
     if ((X) < (-(LIM) - 1)) (Y) = (-(LIM) - 1);                                \
@@ -98,10 +103,49 @@ extern "C"
 /* Saturate unsigned value */
 #define CIMLIB_SAT_UINT(Y, LIM, X)                                             \
 {                                                                              \
+    CIMLIB_PROF_SAT(prof_sat_u64(X), (X) > (LIM), (uint64_t)(LIM))             \
     (Y) = (X);                                                                 \
     if ((X) > (LIM)) (Y) = (LIM);                                              \
 }
 
+/* Saturate 128 bit unsigned value, 'uint128_t', to 64 bits */
+#define CIMLIB_SAT_UINT128(Y, X)                                               \
+{                                                                              \
+    CIMLIB_PROF_SAT(((X).hi != 0) ? INT64_MAX : prof_sat_u64((X).lo),          \
+                    (X).hi != 0, UINT64_MAX)                                   \
+    (Y) = ((X).hi != 0) ? UINT64_MAX : (X).lo;                                 \
+}
+
+/* Saturate floating point value to signed range, NaN is 0, so result can be
+ * converted to integer type */
+#define CIMLIB_SAT_FLT(Y, LIM, X)                                              \
+{                                                                              \
+    CIMLIB_PROF_SAT(prof_sat_flt(X), ((X) > (LIM)) ||                          \
+                    ((X) < (-(LIM) - 1)) || ((X) != (X)), (uint64_t)(LIM))     \
+    (Y) = ((X) != (X)) ? 0 : (X);                                              \
+    if ((X) > (LIM)) (Y) = (LIM);                                              \
+    if ((X) < (-(LIM) - 1)) (Y) = (-(LIM) - 1);                                \
+}
+
+
+/* Radix specialisation of loops. 'LOOP' is loop macro with radix parameter,
+ * it is expanded with constant radix for commonly used radices, so compiler
+ * uses immediate shifts; other radices use runtime value. It is used only
+ * by kernels where benchmark shows the gain, see 'vec_mul_s16' */
+#define CIMLIB_RADIX_SWITCH(RADIX, LOOP)                                       \
+{                                                                              \
+    switch (RADIX) {                                                           \
+    case 8:  LOOP(8);  break;                                                  \
+    case 12: LOOP(12); break;                                                  \
+    case 14: LOOP(14); break;                                                  \
+    case 15: LOOP(15); break;                                                  \
+    case 24: LOOP(24); break;                                                  \
+    case 28: LOOP(28); break;                                                  \
+    case 30: LOOP(30); break;                                                  \
+    default: LOOP(RADIX); break;                                               \
+    }                                                                          \
+}
+
 
 /* Converts time constant to EMA averaging constant
  *
@@ -125,6 +169,104 @@ extern "C"
 #define CIMLIB_PI  (3.141592653590)
 
 
+/* Frame statistics selection flags */
+#define CIMLIB_STATS_MIN        (1u << 0)    /* Minimum and its index */
+#define CIMLIB_STATS_MAX        (1u << 1)    /* Maximum and its index */
+#define CIMLIB_STATS_SUM        (1u << 2)    /* Sum */
+#define CIMLIB_STATS_SUM_SQR    (1u << 3)    /* Sum of squares */
+#define CIMLIB_STATS_CENT_MASS  (1u << 4)    /* Center of mass */
+#define CIMLIB_STATS_ALL        (0x1Fu)      /* All statistics */
+
+
+/* CIC filter registers buffer length, in 64 bit words */
+#define CIMLIB_CIC_REG_LEN(ORDER, NR_CH)  (2 * (ORDER) * (NR_CH))
+
+
+/* Float to fixed point vector conversion flags */
+#define CIMLIB_CONV_TRUNC  (0u)         /* Truncation toward zero */
+#define CIMLIB_CONV_RND    (1u << 0)    /* Rounding, halves away from zero */
+#define CIMLIB_CONV_SAT    (1u << 1)    /* Saturation control */
+
+
+/* Alignment of scratch buffers and '_a' fast path functions arguments */
+#define CIMLIB_ALIGN_BYTES  (32)
+
+/* Block length of '_a' fast path functions, in elements, vector length should
+ * be multiple of it, tail is processed by scalar loop */
+#define CIMLIB_ALIGN_LEN    (16)
+
+/* Pointer aligned to 'CIMLIB_ALIGN_BYTES', compiler uses aligned vector loads
+ * and stores without peeling; it is pointer itself for other compilers */
+#if defined(__GNUC__)
+#define CIMLIB_ASSUME_ALIGNED(P)                                               \
+    __builtin_assume_aligned((P), CIMLIB_ALIGN_BYTES)
+#else
+#define CIMLIB_ASSUME_ALIGNED(P)  (P)
+#endif
+
+/* Size rounded up to alignment, in bytes */
+#define CIMLIB_ALIGN_SIZE(SIZE)                                                \
+    (((size_t)(SIZE) + CIMLIB_ALIGN_BYTES - 1) &                               \
+     ~((size_t)CIMLIB_ALIGN_BYTES - 1))
+
+
+/* Parallel backend, vectors shorter than this length are processed by caller
+ * thread, thread pool overhead is bigger than gain */
+#define CIMLIB_PAR_MIN_LEN      (32768)
+
+/* Parallel backend chunk size, in bytes of one vector, fits L2 cache */
+#define CIMLIB_PAR_CHUNK_BYTES  (65536)
+
+/* Parallel backend maximum number of chunks and threads */
+#define CIMLIB_PAR_MAX_CHUNKS   (1024)
+#define CIMLIB_PAR_MAX_THREADS  (64)
+
+/* Parallel backend cache line size, in bytes, data written by different
+ * threads is padded to it */
+#define CIMLIB_PAR_CACHE_LINE   (64)
+
+
+/* Profile dump formats */
+#define CIMLIB_PROF_TEXT  (0)           /* Text table */
+#define CIMLIB_PROF_JSON  (1)           /* JSON object */
+
+/* Profiled function identifier */
+#define CIMLIB_PROF_ID(NAME)  (CIMLIB_PROF_ID_##NAME)
+#define CIMLIB_PROF_ENUM(NAME)  CIMLIB_PROF_ID_##NAME,
+
+/* Instrumentation of exported functions, it is expanded only in instrumented
+ * build, 'CIMLIB_PROFILE' is 1. 'CIMLIB_PROF_FUNC' starts function body, it
+ * counts call and 'LEN' elements and adds TSC cycles until function returns.
+ * 'CIMLIB_PROF_CALL' counts call and elements only, it is used by short
+ * functions (scalar ones etc.) which are shorter than time stamp read. Both
+ * count saturations of function body in scope variable, they are added to
+ * statistics of thread once, at scope exit. 'CIMLIB_PROF_SAT' counts
+ * saturation of 'X' value to 'LIM' upper limit by 'CIMLIB_SAT_*' macros,
+ * 'CLIP' is clip condition evaluated in type of value, 'X' is value as 64
+ * bit signed one, greater unsigned values are counted as 'INT64_MAX'.
+ * Observed range is tracked if 'CIMLIB_PROFILE_RANGE' is 1 too. Outside of
+ * profiled scope, e.g. in application code, saturation is not counted */
+#if (CIMLIB_PROFILE == 1)
+#if !defined(__GNUC__)
+#error "Instrumented build requires GCC compatible compiler"
+#endif
+#define CIMLIB_PROF_FUNC(NAME, LEN)                                            \
+    prof_scope_t cimlibProfScope __attribute__((cleanup(prof_exit), unused)) = \
+        prof_enter(CIMLIB_PROF_ID(NAME), (LEN))
+
+#define CIMLIB_PROF_CALL(NAME, LEN)                                            \
+    prof_scope_t cimlibProfScope __attribute__((cleanup(prof_ret), unused)) =  \
+        prof_call(CIMLIB_PROF_ID(NAME), (LEN))
+
+#define CIMLIB_PROF_SAT(X, CLIP, LIM)                                          \
+    prof_sat(&cimlibProfScope, (X), (CLIP), (LIM));
+#else
+#define CIMLIB_PROF_FUNC(NAME, LEN)
+#define CIMLIB_PROF_CALL(NAME, LEN)
+#define CIMLIB_PROF_SAT(X, CLIP, LIM)
+#endif /* (CIMLIB_PROFILE == 1) */
+
+
 /* -----------------------------------------------------------------------------
  * Types
  * ---------------------------------------------------------------------------*/
@@ -153,34 +295,419 @@ typedef struct {
 } cint64_t;
 
 
+/** Unsigned 128 bit integer type, portable */
+typedef struct {
+    uint64_t hi;                         /**< High word */
+    uint64_t lo;                         /**< Low word */
+
+} uint128_t;
+
+
+/** CIC filter states, 16 bit signed */
+typedef struct {
+    uint64_t *pReg;                      /**< Integrators and combs registers */
+    int nrCh;                            /**< Number of interleaved channels */
+    int order;                           /**< Filter order */
+    int rate;                            /**< Decimation/interpolation rate */
+    int shift;                           /**< Bit growth scale, right shifts */
+    int cnt;                             /**< Rate counter */
+
+} frm_cic_s16_t;
+
+
+/** Moving average states, 16 bit signed */
+typedef struct {
+    int16_t *pHist;                      /**< Input history */
+    int len;                             /**< Window length */
+    int idx;                             /**< Input history index */
+    int32_t sum;                         /**< Running sum */
+    uint32_t rcp;                        /**< Window length reciprocal */
+    int shift;                           /**< Window length reciprocal radix */
+
+} frm_movavg_s16_t;
+
+
+/** Moving average states, 32 bit signed */
+typedef struct {
+    int32_t *pHist;                      /**< Input history */
+    int len;                             /**< Window length */
+    int idx;                             /**< Input history index */
+    int64_t sum;                         /**< Running sum */
+    uint32_t rcp;                        /**< Window length reciprocal */
+    int shift;                           /**< Window length reciprocal radix */
+
+} frm_movavg_s32_t;
+
+
+/** Moving sum of squares states, 16 bit complex */
+typedef struct {
+    cint16_t *pHist;                     /**< Input history */
+    int len;                             /**< Window length */
+    int idx;                             /**< Input history index */
+    uint64_t sum;                        /**< Running sum of squares */
+
+} frm_movsum_sqr_c16_t;
+
+
+/** Moving sum of squares states, 16 bit signed */
+typedef struct {
+    int16_t *pHist;                      /**< Input history */
+    int len;                             /**< Window length */
+    int idx;                             /**< Input history index */
+    uint64_t sum;                        /**< Running sum of squares */
+
+} frm_movsum_sqr_s16_t;
+
+
+/** Frame statistics, 16 bit signed */
+typedef struct {
+    int16_t min;                         /**< Minimum */
+    int idxMin;                          /**< Minimum index */
+    int16_t max;                         /**< Maximum */
+    int idxMax;                          /**< Maximum index */
+    int32_t sum;                         /**< Sum */
+    uint32_t sumSqr;                     /**< Sum of squares */
+    uint32_t centMass;                   /**< Center of mass, radix applied */
+
+} frm_stats_s16_t;
+
+
+/** Frame statistics, 32 bit signed */
+typedef struct {
+    int32_t min;                         /**< Minimum */
+    int idxMin;                          /**< Minimum index */
+    int32_t max;                         /**< Maximum */
+    int idxMax;                          /**< Maximum index */
+    int64_t sum;                         /**< Sum */
+    uint64_t sumSqr;                     /**< Sum of squares */
+    uint32_t centMass;                   /**< Center of mass, radix applied */
+
+} frm_stats_s32_t;
+
+
+/** Sliding DFT states, 16 bit complex */
+typedef struct {
+    cint32_t *pBins;                     /**< Bins */
+    const cint32_t *pW;                  /**< Bins twiddles */
+    int nrBins;                          /**< Number of bins */
+    cint16_t *pHist;                     /**< Input history */
+    int len;                             /**< DFT length */
+    int idx;                             /**< Input history index */
+    int radix;                           /**< Twiddles radix */
+
+} frm_sdft_c16_t;
+
+
+/** Scratch arena, bump allocator over memory block provided by caller */
+typedef struct {
+    uint8_t *pBuf;                       /**< Aligned memory block */
+    size_t size;                         /**< Memory block size, in bytes */
+    size_t used;                         /**< Allocated size, in bytes */
+
+} mem_arena_t;
+
+
+/** Block floating point vector, 16 bit mantissas with shared exponent,
+ *  element value is 'pMant[n] * 2^exp' */
+typedef struct {
+    int16_t *pMant;                      /**< Mantissas */
+    int len;                             /**< Vector length */
+    int exp;                             /**< Shared exponent */
+
+} vec_bfp_s16_t;
+
+
+/** Parallel backend thread pool, opaque */
+typedef struct par_pool_s par_pool_t;
+
+
+/** Parallel backend job function, processes one chunk of job */
+typedef void (*par_job_t)(void *pCtx, int chunk);
+
+
+/** Parallel backend work stealing scheduler, opaque */
+typedef struct par_sched_s par_sched_t;
+
+
+/** Ring buffer, indexes run free and are masked by ring length. Indexes
+ *  written by producers and by consumer are padded onto separate cache
+ *  lines, so they do not share line with each other or ring parameters */
+typedef struct {
+    uint8_t *pBuf;                       /**< Elements buffer */
+    unsigned int mask;                   /**< Ring length minus 1 */
+    size_t size;                         /**< Element size, in bytes */
+    uint8_t pad1[CIMLIB_PAR_CACHE_LINE]; /**< Padding */
+    unsigned int head;                   /**< Reserved by producers */
+    unsigned int commit;                 /**< Committed by producers */
+    uint8_t pad2[CIMLIB_PAR_CACHE_LINE]; /**< Padding */
+    unsigned int tail;                   /**< Released by consumer */
+    uint8_t pad3[CIMLIB_PAR_CACHE_LINE]; /**< Padding */
+
+} par_ring_t;
+
+
+/** Ring buffer view, up to two contiguous spans, the second one is used at
+ *  wrap around */
+typedef struct {
+    unsigned int pos;                    /**< Position of the first element */
+    void *pX1;                           /**< The first span */
+    int len1;                            /**< The first span length */
+    void *pX2;                           /**< The second span */
+    int len2;                            /**< The second span length */
+
+} par_ring_view_t;
+
+
+/** Profiled function identifiers, 'CIMLIB_PROF_ID(NAME)' */
+typedef enum {
+    CIMLIB_PROF_FUNCS(CIMLIB_PROF_ENUM)
+    CIMLIB_PROF_NR_FUNCS                 /**< Number of profiled functions */
+
+} prof_id_t;
+
+
+/** Profile counters of one function */
+typedef struct {
+    uint64_t calls;                      /**< Number of calls */
+    uint64_t elems;                      /**< Number of elements */
+    uint64_t cycles;                     /**< TSC cycles, called functions
+                                              included */
+
+} prof_cnt_t;
+
+
+/** Profile snapshot */
+typedef struct {
+    int nrThreads;                       /**< Number of counted threads */
+    prof_cnt_t cnt[CIMLIB_PROF_NR_FUNCS];  /**< Counters by function
+                                                identifier */
+
+} prof_snap_t;
+
+
+/** Saturation statistics of one function */
+typedef struct {
+    uint64_t sats;                       /**< Number of saturated values */
+    uint64_t clips;                      /**< Number of clipped values */
+    int64_t min;                         /**< Minimum value before
+                                              saturation */
+    int64_t max;                         /**< Maximum value before
+                                              saturation, greater values
+                                              are 'INT64_MAX' */
+    uint64_t lim;                        /**< Upper saturation limit, the
+                                              widest one of function, 0 -
+                                              range is not tracked */
+
+} prof_sat_t;
+
+
+/** Profiled function scope of instrumented build */
+typedef struct {
+    prof_cnt_t *pCnt;                    /**< Counters of function */
+    uint64_t tsc;                        /**< Time stamp at entry */
+    prof_sat_t *pSat;                    /**< Saturation statistics of
+                                              function */
+    prof_sat_t sat;                      /**< Saturations counted in
+                                              scope */
+
+} prof_scope_t;
+
+
 /* -----------------------------------------------------------------------------
  * Exported functions
  * ---------------------------------------------------------------------------*/
 
 /** Frame math library */
 
+int frm_cic_decim_s16(int16_t *pY, frm_cic_s16_t *pStates, const int16_t *pX,
+                      int len);
+
+void frm_cic_decim_init_s16(frm_cic_s16_t *pStates, uint64_t *pReg, int nrCh,
+                            int order, int rate);
+
+int frm_cic_interp_s16(int16_t *pY, frm_cic_s16_t *pStates, const int16_t *pX,
+                       int len);
+
+void frm_cic_interp_init_s16(frm_cic_s16_t *pStates, uint64_t *pReg, int nrCh,
+                             int order, int rate);
+
+int32_t frm_ema_blk_s32(int32_t *pX, int len, int32_t acc, int32_t alpha,
+                        int radix);
+
 int16_t frm_ema_s16(int16_t *pX, int len, int16_t acc, int16_t alpha,
                     int radix);
 
 int32_t frm_ema_s32(int32_t *pX, int len, int32_t acc, int32_t alpha,
                     int radix);
 
+void frm_goertzel_s16(uint64_t *pPow, int nrBins, const int16_t *pX, int len,
+                      const cint32_t *pW, int radix);
+
+void frm_movavg_init_s16(frm_movavg_s16_t *pStates, int16_t *pHist, int len);
+
+void frm_movavg_init_s32(frm_movavg_s32_t *pStates, int32_t *pHist, int len);
+
+void frm_movavg_s16(int16_t *pY, frm_movavg_s16_t *pStates, const int16_t *pX,
+                    int len);
+
+void frm_movavg_s32(int32_t *pY, frm_movavg_s32_t *pStates, const int32_t *pX,
+                    int len);
+
+void frm_movsum_sqr_c16(uint64_t *pY, frm_movsum_sqr_c16_t *pStates,
+                        const cint16_t *pX, int len);
+
+void frm_movsum_sqr_init_c16(frm_movsum_sqr_c16_t *pStates, cint16_t *pHist,
+                             int len);
+
+void frm_movsum_sqr_init_s16(frm_movsum_sqr_s16_t *pStates, int16_t *pHist,
+                             int len);
+
+void frm_movsum_sqr_s16(uint64_t *pY, frm_movsum_sqr_s16_t *pStates,
+                        const int16_t *pX, int len);
+
+void frm_sdft_c16(uint64_t *pPow, frm_sdft_c16_t *pStates, const cint16_t *pX,
+                  int len);
+
+void frm_sdft_init_c16(frm_sdft_c16_t *pStates, cint32_t *pBins,
+                       const cint32_t *pW, int nrBins, cint16_t *pHist,
+                       int len, int radix);
+
+void frm_stats_s16(frm_stats_s16_t *pStats, unsigned int flags,
+                   const int16_t *pX, int len, int radix);
+
+void frm_stats_s32(frm_stats_s32_t *pStats, unsigned int flags,
+                   const int32_t *pX, int len, int radix);
+
 
 /** Memory operations library */
 
+void *mem_arena_alloc(mem_arena_t *pArena, size_t size);
+
+void mem_arena_init(mem_arena_t *pArena, void *pBuf, size_t size);
+
+size_t mem_arena_mark(const mem_arena_t *pArena);
+
+void mem_arena_reset(mem_arena_t *pArena, size_t mark);
+
 int16_t mem_kth_min_s16(int16_t *pX, int len, int k);
 
 int32_t mem_kth_min_s32(int32_t *pX, int len, int k);
 
+bool mem_kth_min_ws_s16(int16_t *pKth, mem_arena_t *pArena, const int16_t *pX,
+                       int len, int k);
+
+bool mem_kth_min_ws_s32(int32_t *pKth, mem_arena_t *pArena, const int32_t *pX,
+                       int len, int k);
+
+size_t mem_kth_min_ws_size_s16(int len);
+
+size_t mem_kth_min_ws_size_s32(int len);
+
 int16_t mem_median_s16(int16_t *pX, int len);
 
 int32_t mem_median_s32(int32_t *pX, int len);
 
+bool mem_median_ws_s16(int16_t *pMed, mem_arena_t *pArena, const int16_t *pX,
+                      int len);
+
+bool mem_median_ws_s32(int32_t *pMed, mem_arena_t *pArena, const int32_t *pX,
+                      int len);
+
+size_t mem_median_ws_size_s16(int len);
+
+size_t mem_median_ws_size_s32(int len);
+
 void mem_sort_s16(int16_t *pX, int len);
 
 void mem_sort_s32(int32_t *pX, int len);
 
 
+/** Parallel backend library */
+
+int par_chunks(int *pChunkLen, int len, int size);
+
+bool par_mem_kth_min_ws_s32(par_pool_t *pPool, int32_t *pKth,
+                            mem_arena_t *pArena, const int32_t *pX, int len,
+                            int k);
+
+size_t par_mem_kth_min_ws_size_s32(int len);
+
+bool par_mem_median_ws_s32(par_pool_t *pPool, int32_t *pMed,
+                           mem_arena_t *pArena, const int32_t *pX, int len);
+
+bool par_mem_sort_ws_s32(par_pool_t *pPool, mem_arena_t *pArena, int32_t *pX,
+                         int len);
+
+size_t par_mem_sort_ws_size_s32(int len);
+
+par_pool_t *par_pool_create(int nrThreads);
+
+void par_pool_destroy(par_pool_t *pPool);
+
+void par_pool_run(par_pool_t *pPool, par_job_t job, void *pCtx, int nrChunks);
+
+int par_pool_threads(const par_pool_t *pPool);
+
+void par_ring_commit(par_ring_t *pRing, const par_ring_view_t *pView);
+
+void par_ring_commit_mp(par_ring_t *pRing, const par_ring_view_t *pView);
+
+bool par_ring_init(par_ring_t *pRing, void *pBuf, int len, size_t size);
+
+int par_ring_peek(par_ring_t *pRing, par_ring_view_t *pView, int len);
+
+void par_ring_release(par_ring_t *pRing, int len);
+
+int par_ring_reserve(par_ring_t *pRing, par_ring_view_t *pView, int len);
+
+int par_ring_reserve_mp(par_ring_t *pRing, par_ring_view_t *pView, int len);
+
+par_sched_t *par_sched_create(int nrThreads, int capacity);
+
+void par_sched_destroy(par_sched_t *pSched);
+
+bool par_sched_submit(par_sched_t *pSched, par_job_t job, void *pCtx, int arg);
+
+void par_sched_wait(par_sched_t *pSched);
+
+int32_t par_vec_max_s32(par_pool_t *pPool, int *pIdxMax, const int32_t *pX,
+                        int len);
+
+void par_vec_mul_c16(par_pool_t *pPool, cint16_t *pZ, int len, int radix,
+                     const cint16_t *pX, const cint16_t *pY);
+
+void par_vec_mul_c32(par_pool_t *pPool, cint32_t *pZ, int len, int radix,
+                     const cint32_t *pX, const cint32_t *pY);
+
+int64_t par_vec_sum_s32(par_pool_t *pPool, const int32_t *pX, int len);
+
+uint64_t par_vec_sum_sqr_long_s32(par_pool_t *pPool, const int32_t *pX,
+                                  int len);
+
+
+/** Profile library */
+
+int prof_dump(char *pBuf, size_t size, const prof_snap_t *pSnap,
+              unsigned int format);
+
+const char *prof_name(int id);
+
+prof_cnt_t *prof_register(void);
+
+void prof_reset(void);
+
+int prof_sat_dump(char *pBuf, size_t size, const prof_sat_t *pSat,
+                  unsigned int format);
+
+int prof_sat_headroom(const prof_sat_t *pSat);
+
+void prof_sat_reset(void);
+
+bool prof_sat_snapshot(prof_sat_t *pSat);
+
+bool prof_snapshot(prof_snap_t *pSnap, bool flAllThreads);
+
+
 /** Scalar math library */
 
 cint16_t sc_add_c16(cint16_t x, cint16_t y);
@@ -353,6 +880,8 @@ uint16_t sc_sqr_sat_c16(cint16_t x, int radix);
 
 uint32_t sc_sqr_sat_c32(cint32_t x, int radix);
 
+uint128_t sc_sqr_xlong_s64(int64_t x);
+
 uint16_t sc_sqrt_u32(uint32_t x);
 
 uint32_t sc_sqrt_u64(uint64_t x);
@@ -372,8 +901,18 @@ void vec_abs_s64(int64_t *pY, int len, const int64_t *pX);
 
 void vec_add_c16(cint16_t *pZ, int len, const cint16_t *pX, const cint16_t *pY);
 
+void vec_add_c16p(int16_t *pZRe, int16_t *pZIm, int len, const int16_t *pXRe,
+                  const int16_t *pXIm, const int16_t *pYRe,
+                  const int16_t *pYIm);
+
 void vec_add_c32(cint32_t *pZ, int len, const cint32_t *pX, const cint32_t *pY);
 
+void vec_add_c32p(int32_t *pZRe, int32_t *pZIm, int len, const int32_t *pXRe,
+                  const int32_t *pXIm, const int32_t *pYRe,
+                  const int32_t *pYIm);
+
+void vec_add_c64(cint64_t *pZ, int len, const cint64_t *pX, const cint64_t *pY);
+
 void vec_add_const_c16(cint16_t *pY, int len, const cint16_t *pX,
                        cint16_t cnst);
 
@@ -400,6 +939,8 @@ void vec_add_s16(int16_t *pZ, int len, const int16_t *pX, const int16_t *pY);
 
 void vec_add_s32(int32_t *pZ, int len, const int32_t *pX, const int32_t *pY);
 
+void vec_add_s64(int64_t *pZ, int len, const int64_t *pX, const int64_t *pY);
+
 void vec_add_sat_c16(cint16_t *pZ, int len, const cint16_t *pX,
                      const cint16_t *pY);
 
@@ -412,6 +953,34 @@ void vec_add_sat_s16(int16_t *pZ, int len, const int16_t *pX,
 void vec_add_sat_s32(int32_t *pZ, int len, const int32_t *pX,
                      const int32_t *pY);
 
+void vec_bfp_add_s16(vec_bfp_s16_t *pZ, const vec_bfp_s16_t *pX,
+                     const vec_bfp_s16_t *pY);
+
+void vec_bfp_from_s16(vec_bfp_s16_t *pY, const int16_t *pX, int radix);
+
+void vec_bfp_from_s32(vec_bfp_s16_t *pY, const int32_t *pX, int radix);
+
+int vec_bfp_headroom_s16(const vec_bfp_s16_t *pX);
+
+void vec_bfp_init_s16(vec_bfp_s16_t *pX, int16_t *pMant, int len);
+
+void vec_bfp_mac_s16(vec_bfp_s16_t *pZ, const vec_bfp_s16_t *pX,
+                     const vec_bfp_s16_t *pY);
+
+void vec_bfp_mul_s16(vec_bfp_s16_t *pZ, const vec_bfp_s16_t *pX,
+                     const vec_bfp_s16_t *pY);
+
+void vec_bfp_norm_s16(vec_bfp_s16_t *pX);
+
+void vec_bfp_scale_s16(vec_bfp_s16_t *pY, const vec_bfp_s16_t *pX,
+                       int16_t scale, int radix);
+
+uint64_t vec_bfp_sum_sqr_s16(int *pExp, const vec_bfp_s16_t *pX);
+
+void vec_bfp_to_s16(int16_t *pY, const vec_bfp_s16_t *pX, int radix);
+
+void vec_bfp_to_s32(int32_t *pY, const vec_bfp_s16_t *pX, int radix);
+
 uint32_t vec_cent_mass_s16(const int16_t *pX, int len, int radix);
 
 uint32_t vec_cent_mass_s32(const int32_t *pX, int len, int radix);
@@ -420,18 +989,70 @@ uint32_t vec_cent_mass_u16(const uint16_t *pX, int len, int radix);
 
 uint32_t vec_cent_mass_u32(const uint32_t *pX, int len, int radix);
 
+void vec_deinterleave_c16(int16_t *pYRe, int16_t *pYIm, int len,
+                          const cint16_t *pX);
+
+void vec_deinterleave_c32(int32_t *pYRe, int32_t *pYIm, int len,
+                          const cint32_t *pX);
+
 void vec_ema_s16(int16_t *pAcc, int len, int16_t alpha, int radix,
                  const int16_t *pX);
 
 void vec_ema_s32(int32_t *pAcc, int len, int32_t alpha, int radix,
                  const int32_t *pX);
 
+void vec_from_double_c16(cint16_t *pY, int len, int radix, unsigned int flags,
+                         const double *pX);
+
+void vec_from_double_c32(cint32_t *pY, int len, int radix, unsigned int flags,
+                         const double *pX);
+
+void vec_from_double_s16(int16_t *pY, int len, int radix, unsigned int flags,
+                         const double *pX);
+
+void vec_from_double_s32(int32_t *pY, int len, int radix, unsigned int flags,
+                         const double *pX);
+
+void vec_from_float_c16(cint16_t *pY, int len, int radix, unsigned int flags,
+                        const float *pX);
+
+void vec_from_float_c32(cint32_t *pY, int len, int radix, unsigned int flags,
+                        const float *pX);
+
+void vec_from_float_s16(int16_t *pY, int len, int radix, unsigned int flags,
+                        const float *pX);
+
+void vec_from_float_s32(int32_t *pY, int len, int radix, unsigned int flags,
+                        const float *pX);
+
+void vec_interleave_c16(cint16_t *pY, int len, const int16_t *pXRe,
+                        const int16_t *pXIm);
+
+void vec_interleave_c32(cint32_t *pY, int len, const int32_t *pXRe,
+                        const int32_t *pXIm);
+
 void vec_mac_c16(cint16_t *pZ, int len, int radix, const cint16_t *pX,
                  const cint16_t *pY);
 
+void vec_mac_c16p(int16_t *pZRe, int16_t *pZIm, int len, int radix,
+                  const int16_t *pXRe, const int16_t *pXIm, const int16_t *pYRe,
+                  const int16_t *pYIm);
+
 void vec_mac_c32(cint32_t *pZ, int len, int radix, const cint32_t *pX,
                  const cint32_t *pY);
 
+void vec_mac_c32p(int32_t *pZRe, int32_t *pZIm, int len, int radix,
+                  const int32_t *pXRe, const int32_t *pXIm, const int32_t *pYRe,
+                  const int32_t *pYIm);
+
+void vec_mac_cj_scale_sat_c16(cint16_t *pZ, int len, int radix,
+                              const cint16_t *pX, const cint16_t *pY,
+                              int offset);
+
+void vec_mac_cj_scale_sat_c32(cint32_t *pZ, int len, int radix,
+                              const cint32_t *pX, const cint32_t *pY,
+                              int offset);
+
 void vec_mac_s16(int16_t *pZ, int len, int radix, const int16_t *pX,
                  const int16_t *pY);
 
@@ -482,8 +1103,14 @@ void vec_mac_long_s32(int64_t *pZ, int len, const int32_t *pX,
 
 void vec_mag_c16(uint16_t *pY, int len, const cint16_t *pX);
 
+void vec_mag_c16p(uint16_t *pY, int len, const int16_t *pXRe,
+                  const int16_t *pXIm);
+
 void vec_mag_c32(uint32_t *pY, int len, const cint32_t *pX);
 
+void vec_mag_c32p(uint32_t *pY, int len, const int32_t *pXRe,
+                  const int32_t *pXIm);
+
 int16_t vec_max_s16(int *pIdxMax, const int16_t *pX, int len);
 
 int32_t vec_max_s32(int *pIdxMax, const int32_t *pX, int len);
@@ -532,15 +1159,35 @@ uint16_t vec_min_sqr_sat_s16(int *pIdxMin, const int16_t *pX, int len,
 uint32_t vec_min_sqr_sat_s32(int *pIdxMin, const int32_t *pX, int len,
                              int radix);
 
+void vec_mul_add_sat_c16(cint16_t *pZ, int len, int radix, const cint16_t *pX,
+                         const cint16_t *pY, const cint16_t *pW);
+
+void vec_mul_add_sat_c32(cint32_t *pZ, int len, int radix, const cint32_t *pX,
+                         const cint32_t *pY, const cint32_t *pW);
+
+void vec_mul_add_sat_s16(int16_t *pZ, int len, int radix, const int16_t *pX,
+                         const int16_t *pY, const int16_t *pW);
+
+void vec_mul_add_sat_s32(int32_t *pZ, int len, int radix, const int32_t *pX,
+                         const int32_t *pY, const int32_t *pW);
+
 void vec_mul_c16(cint16_t *pZ, int len, int radix, const cint16_t *pX,
                  const cint16_t *pY);
 
+void vec_mul_c16p(int16_t *pZRe, int16_t *pZIm, int len, int radix,
+                  const int16_t *pXRe, const int16_t *pXIm, const int16_t *pYRe,
+                  const int16_t *pYIm);
+
 void vec_mul_c16s16(cint16_t *pZ, int len, int radix, const cint16_t *pX,
                     const int16_t *pY);
 
 void vec_mul_c32(cint32_t *pZ, int len, int radix, const cint32_t *pX,
                  const cint32_t *pY);
 
+void vec_mul_c32p(int32_t *pZRe, int32_t *pZIm, int len, int radix,
+                  const int32_t *pXRe, const int32_t *pXIm, const int32_t *pYRe,
+                  const int32_t *pYIm);
+
 void vec_mul_c32s32(cint32_t *pZ, int len, int radix, const cint32_t *pX,
                     const int32_t *pY);
 
@@ -562,6 +1209,22 @@ void vec_mul_cj_sat_c16(cint16_t *pZ, int len, int radix, const cint16_t *pX,
 void vec_mul_cj_sat_c32(cint32_t *pZ, int len, int radix, const cint32_t *pX,
                         const cint32_t *pY);
 
+void vec_mul_const_add_sat_c16(cint16_t *pZ, int len, int radix,
+                               const cint16_t *pX, cint16_t cnst,
+                               const cint16_t *pY);
+
+void vec_mul_const_add_sat_c32(cint32_t *pZ, int len, int radix,
+                               const cint32_t *pX, cint32_t cnst,
+                               const cint32_t *pY);
+
+void vec_mul_const_add_sat_s16(int16_t *pZ, int len, int radix,
+                               const int16_t *pX, int16_t cnst,
+                               const int16_t *pY);
+
+void vec_mul_const_add_sat_s32(int32_t *pZ, int len, int radix,
+                               const int32_t *pX, int32_t cnst,
+                               const int32_t *pY);
+
 void vec_mul_const_c16(cint16_t *pY, int len, int radix, const cint16_t *pX,
                        cint16_t cnst);
 
@@ -598,9 +1261,18 @@ void vec_mul_long_s16(int32_t *pZ, int len, const int16_t *pX,
 void vec_mul_long_s32(int64_t *pZ, int len, const int32_t *pX,
                       const int32_t *pY);
 
+void vec_mul_mag_c16(uint16_t *pZ, int len, int radix, const cint16_t *pX,
+                     const cint16_t *pY);
+
+void vec_mul_mag_c32(uint32_t *pZ, int len, int radix, const cint32_t *pX,
+                     const cint32_t *pY);
+
 void vec_mul_s16(int16_t *pZ, int len, int radix, const int16_t *pX,
                  const int16_t *pY);
 
+void vec_mul_s16_a(int16_t *pZ, int len, int radix, const int16_t *pX,
+                   const int16_t *pY);
+
 void vec_mul_s32(int32_t *pZ, int len, int radix, const int32_t *pX,
                  const int32_t *pY);
 
@@ -616,6 +1288,13 @@ void vec_mul_sat_s16(int16_t *pZ, int len, int radix, const int16_t *pX,
 void vec_mul_sat_s32(int32_t *pZ, int len, int radix, const int32_t *pX,
                      const int32_t *pY);
 
+void vec_narrow_sat_c64_c32(cint32_t *pY, int len, int radix,
+                            const cint64_t *pX);
+
+void vec_narrow_sat_s32_s16(int16_t *pY, int len, int radix, const int32_t *pX);
+
+void vec_narrow_sat_s64_s32(int32_t *pY, int len, int radix, const int64_t *pX);
+
 void vec_scale_radix_s16(int16_t *pY, int len, int radix, const int16_t *pX);
 
 void vec_scale_radix_s32(int32_t *pY, int len, int offset, const int32_t *pX);
@@ -626,8 +1305,14 @@ void vec_sqr_c32(uint32_t *pY, int len, int radix, const cint32_t *pX);
 
 void vec_sqr_long_c16(uint32_t *pY, int len, const cint16_t *pX);
 
+void vec_sqr_long_c16p(uint32_t *pY, int len, const int16_t *pXRe,
+                       const int16_t *pXIm);
+
 void vec_sqr_long_c32(uint64_t *pY, int len, const cint32_t *pX);
 
+void vec_sqr_long_c32p(uint64_t *pY, int len, const int32_t *pXRe,
+                       const int32_t *pXIm);
+
 void vec_sqr_long_s16(uint32_t *pY, int len, const int16_t *pX);
 
 void vec_sqr_long_s32(uint64_t *pY, int len, const int32_t *pX);
@@ -640,10 +1325,14 @@ void vec_sqr_sat_c16(uint16_t *pY, int len, int radix, const cint16_t *pX);
 
 void vec_sqr_sat_c32(uint32_t *pY, int len, int radix, const cint32_t *pX);
 
+void vec_sqr_sat_c64(uint64_t *pY, int len, int radix, const cint64_t *pX);
+
 void vec_sqr_sat_s16(uint16_t *pY, int len, int radix, const int16_t *pX);
 
 void vec_sqr_sat_s32(uint32_t *pY, int len, int radix, const int32_t *pX);
 
+void vec_sqr_sat_s64(uint64_t *pY, int len, int radix, const int64_t *pX);
+
 void vec_sqra_long_c16(uint32_t *pYAcc, int len, const cint16_t *pX);
 
 void vec_sqra_long_c32(uint64_t *pYAcc, int len, const cint32_t *pX);
@@ -652,14 +1341,28 @@ void vec_sqra_long_s16(uint32_t *pYAcc, int len, const int16_t *pX);
 
 void vec_sqra_long_s32(uint64_t *pYAcc, int len, const int32_t *pX);
 
+void vec_sqrt_u64(uint32_t *pY, int len, const uint64_t *pX);
+
 void vec_sub_c16(cint16_t *pZ, int len, const cint16_t *pX, const cint16_t *pY);
 
+void vec_sub_c16p(int16_t *pZRe, int16_t *pZIm, int len, const int16_t *pXRe,
+                  const int16_t *pXIm, const int16_t *pYRe,
+                  const int16_t *pYIm);
+
 void vec_sub_c32(cint32_t *pZ, int len, const cint32_t *pX, const cint32_t *pY);
 
+void vec_sub_c32p(int32_t *pZRe, int32_t *pZIm, int len, const int32_t *pXRe,
+                  const int32_t *pXIm, const int32_t *pYRe,
+                  const int32_t *pYIm);
+
+void vec_sub_c64(cint64_t *pZ, int len, const cint64_t *pX, const cint64_t *pY);
+
 void vec_sub_s16(int16_t *pZ, int len, const int16_t *pX, const int16_t *pY);
 
 void vec_sub_s32(int32_t *pZ, int len, const int32_t *pX, const int32_t *pY);
 
+void vec_sub_s64(int64_t *pZ, int len, const int64_t *pX, const int64_t *pY);
+
 void vec_sub_sat_c16(cint16_t *pZ, int len, const cint16_t *pX,
                      const cint16_t *pY);
 
@@ -676,6 +1379,8 @@ cint32_t vec_sum_c16(const cint16_t *pX, int len);
 
 cint64_t vec_sum_c32(const cint32_t *pX, int len);
 
+cint64_t vec_sum_c64(const cint64_t *pX, int len);
+
 cint32_t vec_sum_diff_c16(const cint16_t *pX, const cint16_t *pY, int len);
 
 cint64_t vec_sum_diff_c32(const cint32_t *pX, const cint32_t *pY, int len);
@@ -703,12 +1408,23 @@ cint64_t vec_sum_mul_c32s32(const cint32_t *pX, const int32_t *pY, int len,
 cint32_t vec_sum_mul_cj_c16(const cint16_t *pX, const cint16_t *pY, int len,
                             int radix);
 
+cint32_t vec_sum_mul_cj_c16p(const int16_t *pXRe, const int16_t *pXIm,
+                             const int16_t *pYRe, const int16_t *pYIm, int len,
+                             int radix);
+
 cint64_t vec_sum_mul_cj_c32(const cint32_t *pX, const cint32_t *pY, int len,
                             int radix);
 
+cint64_t vec_sum_mul_cj_c32p(const int32_t *pXRe, const int32_t *pXIm,
+                             const int32_t *pYRe, const int32_t *pYIm, int len,
+                             int radix);
+
 int32_t vec_sum_mul_s16(const int16_t *pX, const int16_t *pY, int len,
                         int radix);
 
+int32_t vec_sum_mul_s16_a(const int16_t *pX, const int16_t *pY, int len,
+                          int radix);
+
 int64_t vec_sum_mul_s32(const int32_t *pX, const int32_t *pY, int len,
                         int radix);
 
@@ -716,6 +1432,8 @@ int32_t vec_sum_s16(const int16_t *pX, int len);
 
 int64_t vec_sum_s32(const int32_t *pX, int len);
 
+int64_t vec_sum_s64(const int64_t *pX, int len);
+
 uint32_t vec_sum_sqr_c16(const cint16_t *pX, int len, int radix);
 
 uint64_t vec_sum_sqr_c32(const cint32_t *pX, int len, int radix);
@@ -744,23 +1462,252 @@ uint32_t vec_sum_sqr_s16(const int16_t *pX, int len, int radix);
 
 uint64_t vec_sum_sqr_s32(const int32_t *pX, int len, int radix);
 
+uint128_t vec_sum_sqr_xlong_c32(const cint32_t *pX, int len);
+
+uint128_t vec_sum_sqr_xlong_s32(const int32_t *pX, int len);
+
+void vec_to_double_c16(double *pY, int len, int radix, const cint16_t *pX);
+
+void vec_to_double_c32(double *pY, int len, int radix, const cint32_t *pX);
+
+void vec_to_double_s16(double *pY, int len, int radix, const int16_t *pX);
+
+void vec_to_double_s32(double *pY, int len, int radix, const int32_t *pX);
+
+void vec_to_float_c16(float *pY, int len, int radix, const cint16_t *pX);
+
+void vec_to_float_c32(float *pY, int len, int radix, const cint32_t *pX);
+
+void vec_to_float_s16(float *pY, int len, int radix, const int16_t *pX);
+
+void vec_to_float_s32(float *pY, int len, int radix, const int32_t *pX);
+
+void vec_widen_s16_s32(int32_t *pY, int len, int radix, const int16_t *pX);
+
+void vec_widen_s32_s64(int64_t *pY, int len, int radix, const int32_t *pX);
+
+
+
+#if (CIMLIB_PROFILE == 1)
+
+/** Profile counters and saturation statistics of calling thread, NULL -
+ * thread is not registered */
+extern __thread prof_cnt_t *prof_pThreadCnt;
+extern __thread prof_sat_t *prof_pThreadSat;
+
+/** Scope of 'CIMLIB_SAT_*' macros outside of profiled functions, scope
+ * variable of function hides it. It is never added to statistics, so
+ * saturations outside of profiled scope are not counted */
+static __thread prof_scope_t cimlibProfScope __attribute__((unused));
+
+
+/*******************************************************************************
+ * This function reads time stamp counter, CPU cycles on x86, virtual counter
+ * on ARMv8. Other platforms have no cycles.
+ ******************************************************************************/
+static inline uint64_t prof_tsc(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+    uint64_t tsc;
+
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(tsc));
+
+    return tsc;
+#else
+    return 0;
+#endif
+}
+
+
+/*******************************************************************************
+ * This function enters profiled function scope without time stamp, it counts
+ * call of function and its elements, thread is registered at the first call.
+ * Saturations are counted in scope until it exits.
+ ******************************************************************************/
+static inline prof_scope_t prof_call(int id, int len)
+{
+    prof_scope_t scope;
+    prof_cnt_t *pCnt = prof_pThreadCnt;
+
+    if (pCnt == NULL) {
+        pCnt = prof_register();
+    }
+
+    pCnt += id;
+    pCnt->calls++;
+    pCnt->elems += (len > 0) ? (uint64_t)len : 0;
+
+    scope.pCnt = pCnt;
+    scope.tsc = 0;
+    scope.pSat = prof_pThreadSat + id;
+    scope.sat.sats = 0;
+    scope.sat.clips = 0;
+    scope.sat.min = INT64_MAX;
+    scope.sat.max = INT64_MIN;
+    scope.sat.lim = 0;
+
+    return scope;
+}
+
+
+/*******************************************************************************
+ * This function exits profiled function scope without time stamp, it is
+ * called by compiler when scope variable goes out of scope. Saturations
+ * counted in scope are added to statistics of function.
+ ******************************************************************************/
+static inline void prof_ret(prof_scope_t *pScope)
+{
+    prof_sat_t *pSat = pScope->pSat;
+
+    if (pScope->sat.sats == 0) {
+        return;
+    }
+
+#if (CIMLIB_PROFILE_RANGE == 1)
+    if ((pSat->sats == 0) || (pScope->sat.min < pSat->min)) {
+        pSat->min = pScope->sat.min;
+    }
+    if ((pSat->sats == 0) || (pScope->sat.max > pSat->max)) {
+        pSat->max = pScope->sat.max;
+    }
+    if (pScope->sat.lim > pSat->lim) {
+        pSat->lim = pScope->sat.lim;
+    }
+#endif
+    pSat->sats += pScope->sat.sats;
+    pSat->clips += pScope->sat.clips;
+}
+
+
+/*******************************************************************************
+ * This function enters profiled function scope, it counts call and starts
+ * time stamp.
+ ******************************************************************************/
+static inline prof_scope_t prof_enter(int id, int len)
+{
+    prof_scope_t scope;
+
+    scope = prof_call(id, len);
+    scope.tsc = prof_tsc();
+
+    return scope;
+}
+
+
+/*******************************************************************************
+ * This function exits profiled function scope, it is called by compiler when
+ * scope variable goes out of scope.
+ ******************************************************************************/
+static inline void prof_exit(prof_scope_t *pScope)
+{
+    pScope->pCnt->cycles += prof_tsc() - pScope->tsc;
+    prof_ret(pScope);
+}
+
+
+/*******************************************************************************
+ * This function counts saturation of value in profiled function scope, value
+ * is clipped if 'flClip' is 'true'. Minimum and maximum values and limit are
+ * tracked if 'CIMLIB_PROFILE_RANGE' is 1.
+ ******************************************************************************/
+static inline void prof_sat(prof_scope_t *pScope, int64_t x, bool flClip,
+                            uint64_t lim)
+{
+    pScope->sat.sats++;
+    pScope->sat.clips += flClip ? 1 : 0;
+#if (CIMLIB_PROFILE_RANGE == 1)
+    pScope->sat.min = (x < pScope->sat.min) ? x : pScope->sat.min;
+    pScope->sat.max = (x > pScope->sat.max) ? x : pScope->sat.max;
+    pScope->sat.lim = (lim > pScope->sat.lim) ? lim : pScope->sat.lim;
+#else
+    (void)x;
+    (void)lim;
+#endif
+}
+
+
+/*******************************************************************************
+ * This function converts unsigned value counted by 'prof_sat' to 64 bit
+ * signed one, greater values are 'INT64_MAX'.
+ ******************************************************************************/
+static inline int64_t prof_sat_u64(uint64_t x)
+{
+    return (x > (uint64_t)INT64_MAX) ? INT64_MAX : (int64_t)x;
+}
+
+
+/*******************************************************************************
+ * This function converts floating point value counted by 'prof_sat' to 64
+ * bit signed one, it is clamped before conversion, NaN is 0.
+ ******************************************************************************/
+static inline int64_t prof_sat_flt(double x)
+{
+    if (x >= 9223372036854775808.0) {
+        return INT64_MAX;
+    }
+    if (x < -9223372036854775808.0) {
+        return INT64_MIN;
+    }
+
+    return (x == x) ? (int64_t)x : 0;
+}
+
+#endif /* (CIMLIB_PROFILE == 1) */
 
 #if (CIMLIB_BUILD_TEST == 1)
 
 /** Tests for scalar math library */
+bool test_frm_cic_decim_s16(void);
+bool test_frm_cic_interp_s16(void);
+bool test_frm_ema_blk_s32(void);
 bool test_frm_ema_s16(void);
 bool test_frm_ema_s32(void);
+bool test_frm_goertzel_s16(void);
+bool test_frm_movavg_s16(void);
+bool test_frm_movavg_s32(void);
+bool test_frm_movsum_sqr_c16(void);
+bool test_frm_movsum_sqr_s16(void);
+bool test_frm_sdft_c16(void);
+bool test_frm_stats_s16(void);
+bool test_frm_stats_s32(void);
 
 
 /** Tests for memory operations library */
+bool test_mem_arena(void);
 bool test_mem_kth_min_s16(void);
 bool test_mem_kth_min_s32(void);
+bool test_mem_kth_min_ws_s16(void);
+bool test_mem_kth_min_ws_s32(void);
 bool test_mem_median_s16(void);
 bool test_mem_median_s32(void);
+bool test_mem_median_ws_s16(void);
+bool test_mem_median_ws_s32(void);
 bool test_mem_sort_s16(void);
 bool test_mem_sort_s32(void);
 
 
+/** Tests for parallel backend library */
+bool test_par_mem_kth_min_ws_s32(void);
+bool test_par_mem_median_ws_s32(void);
+bool test_par_mem_sort_ws_s32(void);
+bool test_par_pool(void);
+bool test_par_ring(void);
+bool test_par_sched(void);
+bool test_par_vec_max_s32(void);
+bool test_par_vec_mul_c16(void);
+bool test_par_vec_mul_c32(void);
+bool test_par_vec_sum_s32(void);
+bool test_par_vec_sum_sqr_long_s32(void);
+
+
+/** Tests for profile library */
+bool test_prof_cnt(void);
+bool test_prof_dump(void);
+bool test_prof_sat(void);
+
+
 /** Tests for scalar math library */
 bool test_sc_add_c16(void);
 bool test_sc_add_c32(void);
@@ -847,6 +1794,7 @@ bool test_sc_sqr_sat_c16(void);
 bool test_sc_sqr_sat_c32(void);
 bool test_sc_sqr_sat_s16(void);
 bool test_sc_sqr_sat_s32(void);
+bool test_sc_sqr_xlong_s64(void);
 bool test_sc_sqrt_u32(void);
 bool test_sc_sqrt_u64(void);
 bool test_sc_sub_c16(void);
@@ -858,7 +1806,10 @@ bool test_vec_abs_s16(void);
 bool test_vec_abs_s32(void);
 bool test_vec_abs_s64(void);
 bool test_vec_add_c16(void);
+bool test_vec_add_c16p(void);
 bool test_vec_add_c32(void);
+bool test_vec_add_c32p(void);
+bool test_vec_add_c64(void);
 bool test_vec_add_const_c16(void);
 bool test_vec_add_const_c32(void);
 bool test_vec_add_const_s16(void);
@@ -869,24 +1820,52 @@ bool test_vec_add_const_sat_s16(void);
 bool test_vec_add_const_sat_s32(void);
 bool test_vec_add_s16(void);
 bool test_vec_add_s32(void);
+bool test_vec_add_s64(void);
 bool test_vec_add_sat_c16(void);
 bool test_vec_add_sat_c32(void);
 bool test_vec_add_sat_s16(void);
 bool test_vec_add_sat_s32(void);
+bool test_vec_bfp_add_s16(void);
+bool test_vec_bfp_from_s16(void);
+bool test_vec_bfp_from_s32(void);
+bool test_vec_bfp_headroom_s16(void);
+bool test_vec_bfp_mac_s16(void);
+bool test_vec_bfp_mul_s16(void);
+bool test_vec_bfp_norm_s16(void);
+bool test_vec_bfp_scale_s16(void);
+bool test_vec_bfp_sum_sqr_s16(void);
+bool test_vec_bfp_to_s16(void);
+bool test_vec_bfp_to_s32(void);
 bool test_vec_cent_mass_s16(void);
 bool test_vec_cent_mass_s32(void);
 bool test_vec_cent_mass_u16(void);
 bool test_vec_cent_mass_u32(void);
+bool test_vec_deinterleave_c16(void);
+bool test_vec_deinterleave_c32(void);
 bool test_vec_ema_s16(void);
 bool test_vec_ema_s32(void);
+bool test_vec_from_double_c16(void);
+bool test_vec_from_double_c32(void);
+bool test_vec_from_double_s16(void);
+bool test_vec_from_double_s32(void);
+bool test_vec_from_float_c16(void);
+bool test_vec_from_float_c32(void);
+bool test_vec_from_float_s16(void);
+bool test_vec_from_float_s32(void);
+bool test_vec_interleave_c16(void);
+bool test_vec_interleave_c32(void);
 bool test_vec_mac_c16(void);
+bool test_vec_mac_c16p(void);
 bool test_vec_mac_c32(void);
+bool test_vec_mac_c32p(void);
 bool test_vec_mac_cj_c16(void);
 bool test_vec_mac_cj_c32(void);
 bool test_vec_mac_cj_long_c16(void);
 bool test_vec_mac_cj_long_c32(void);
 bool test_vec_mac_cj_sat_c16(void);
 bool test_vec_mac_cj_sat_c32(void);
+bool test_vec_mac_cj_scale_sat_c16(void);
+bool test_vec_mac_cj_scale_sat_c32(void);
 bool test_vec_mac_long_c16(void);
 bool test_vec_mac_long_c32(void);
 bool test_vec_mac_long_s16(void);
@@ -898,7 +1877,9 @@ bool test_vec_mac_sat_c32(void);
 bool test_vec_mac_sat_s16(void);
 bool test_vec_mac_sat_s32(void);
 bool test_vec_mag_c16(void);
+bool test_vec_mag_c16p(void);
 bool test_vec_mag_c32(void);
+bool test_vec_mag_c32p(void);
 bool test_vec_max_s16(void);
 bool test_vec_max_s32(void);
 bool test_vec_max_sqr_c16(void);
@@ -919,9 +1900,15 @@ bool test_vec_min_sqr_sat_c16(void);
 bool test_vec_min_sqr_sat_c32(void);
 bool test_vec_min_sqr_sat_s16(void);
 bool test_vec_min_sqr_sat_s32(void);
+bool test_vec_mul_add_sat_c16(void);
+bool test_vec_mul_add_sat_c32(void);
+bool test_vec_mul_add_sat_s16(void);
+bool test_vec_mul_add_sat_s32(void);
 bool test_vec_mul_c16(void);
+bool test_vec_mul_c16p(void);
 bool test_vec_mul_c16s16(void);
 bool test_vec_mul_c32(void);
+bool test_vec_mul_c32p(void);
 bool test_vec_mul_c32s32(void);
 bool test_vec_mul_cj_c16(void);
 bool test_vec_mul_cj_c32(void);
@@ -929,6 +1916,10 @@ bool test_vec_mul_cj_long_c16(void);
 bool test_vec_mul_cj_long_c32(void);
 bool test_vec_mul_cj_sat_c16(void);
 bool test_vec_mul_cj_sat_c32(void);
+bool test_vec_mul_const_add_sat_c16(void);
+bool test_vec_mul_const_add_sat_c32(void);
+bool test_vec_mul_const_add_sat_s16(void);
+bool test_vec_mul_const_add_sat_s32(void);
 bool test_vec_mul_const_c16(void);
 bool test_vec_mul_const_c32(void);
 bool test_vec_mul_const_s16(void);
@@ -941,40 +1932,56 @@ bool test_vec_mul_long_c16(void);
 bool test_vec_mul_long_c32(void);
 bool test_vec_mul_long_s16(void);
 bool test_vec_mul_long_s32(void);
+bool test_vec_mul_mag_c16(void);
+bool test_vec_mul_mag_c32(void);
 bool test_vec_mul_s16(void);
+bool test_vec_mul_s16_a(void);
 bool test_vec_mul_s32(void);
 bool test_vec_mul_sat_c16(void);
 bool test_vec_mul_sat_c32(void);
 bool test_vec_mul_sat_s16(void);
 bool test_vec_mul_sat_s32(void);
+bool test_vec_narrow_sat_c64_c32(void);
+bool test_vec_narrow_sat_s32_s16(void);
+bool test_vec_narrow_sat_s64_s32(void);
 bool test_vec_scale_radix_s16(void);
 bool test_vec_scale_radix_s32(void);
 bool test_vec_sqr_c16(void);
 bool test_vec_sqr_c32(void);
 bool test_vec_sqr_long_c16(void);
+bool test_vec_sqr_long_c16p(void);
 bool test_vec_sqr_long_c32(void);
+bool test_vec_sqr_long_c32p(void);
 bool test_vec_sqr_long_s16(void);
 bool test_vec_sqr_long_s32(void);
 bool test_vec_sqr_s16(void);
 bool test_vec_sqr_s32(void);
 bool test_vec_sqr_sat_c16(void);
 bool test_vec_sqr_sat_c32(void);
+bool test_vec_sqr_sat_c64(void);
 bool test_vec_sqr_sat_s16(void);
 bool test_vec_sqr_sat_s32(void);
+bool test_vec_sqr_sat_s64(void);
 bool test_vec_sqra_long_c16(void);
 bool test_vec_sqra_long_c32(void);
 bool test_vec_sqra_long_s16(void);
 bool test_vec_sqra_long_s32(void);
+bool test_vec_sqrt_u64(void);
 bool test_vec_sub_c16(void);
+bool test_vec_sub_c16p(void);
 bool test_vec_sub_c32(void);
+bool test_vec_sub_c32p(void);
+bool test_vec_sub_c64(void);
 bool test_vec_sub_s16(void);
 bool test_vec_sub_s32(void);
+bool test_vec_sub_s64(void);
 bool test_vec_sub_sat_c16(void);
 bool test_vec_sub_sat_c32(void);
 bool test_vec_sub_sat_s16(void);
 bool test_vec_sub_sat_s32(void);
 bool test_vec_sum_c16(void);
 bool test_vec_sum_c32(void);
+bool test_vec_sum_c64(void);
 bool test_vec_sum_diff_c16(void);
 bool test_vec_sum_diff_c32(void);
 bool test_vec_sum_diff_s16(void);
@@ -986,11 +1993,15 @@ bool test_vec_sum_mul_c16s16(void);
 bool test_vec_sum_mul_c32(void);
 bool test_vec_sum_mul_c32s32(void);
 bool test_vec_sum_mul_cj_c16(void);
+bool test_vec_sum_mul_cj_c16p(void);
 bool test_vec_sum_mul_cj_c32(void);
+bool test_vec_sum_mul_cj_c32p(void);
 bool test_vec_sum_mul_s16(void);
+bool test_vec_sum_mul_s16_a(void);
 bool test_vec_sum_mul_s32(void);
 bool test_vec_sum_s16(void);
 bool test_vec_sum_s32(void);
+bool test_vec_sum_s64(void);
 bool test_vec_sum_sqr_c16(void);
 bool test_vec_sum_sqr_c32(void);
 bool test_vec_sum_sqr_diff_c16(void);
@@ -1003,6 +2014,18 @@ bool test_vec_sum_sqr_long_s16(void);
 bool test_vec_sum_sqr_long_s32(void);
 bool test_vec_sum_sqr_s16(void);
 bool test_vec_sum_sqr_s32(void);
+bool test_vec_sum_sqr_xlong_c32(void);
+bool test_vec_sum_sqr_xlong_s32(void);
+bool test_vec_to_double_c16(void);
+bool test_vec_to_double_c32(void);
+bool test_vec_to_double_s16(void);
+bool test_vec_to_double_s32(void);
+bool test_vec_to_float_c16(void);
+bool test_vec_to_float_c32(void);
+bool test_vec_to_float_s16(void);
+bool test_vec_to_float_s32(void);
+bool test_vec_widen_s16_s32(void);
+bool test_vec_widen_s32_s64(void);
 #endif /* (CIMLIB_BUILD_TEST == 1) */
 
 
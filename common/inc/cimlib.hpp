@@ -0,0 +1,740 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+#ifndef CIMLIB_HPP
+#define CIMLIB_HPP
+
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include <limits>            /* Numeric limits */
+#include <type_traits>       /* Type traits */
+#include "cimlib.h"          /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Vector expressions
+ *
+ * Header only C++11 front end. Vector expressions over spans are built
+ * lazily and evaluated by one loop on assignment, without temporary vectors
+ * and memory allocation. Expression which maps exactly to one library
+ * kernel is evaluated by that kernel.
+ *
+ * Expressions are calculated in wide type (32 bit for 16 bit signed spans,
+ * 64 bit for 32 bit signed), products are not shifted, use '>>' for radix:
+ *
+ *     cimlib::span<int16_t> z(zBuf, len);
+ *     cimlib::span<const int16_t> x(xBuf, len), y(yBuf, len), w(wBuf, len);
+ *
+ *     z = cimlib::sat((x * y >> RADIX) + w);    // vec_mul_add_sat_s16
+ *
+ * Result is converted to span type by truncation, if 'sat' is not used.
+ * All spans of expression must have at least output span length elements.
+ * ---------------------------------------------------------------------------*/
+namespace cimlib
+{
+
+/* Wide type used for calculation of expressions */
+template <typename T> struct wide;
+template <> struct wide<int16_t> { typedef int32_t type; };
+template <> struct wide<int32_t> { typedef int64_t type; };
+
+/* Complex type of the same precision */
+template <typename T> struct cplx;
+template <> struct cplx<int16_t> { typedef cint16_t type; };
+template <> struct cplx<int32_t> { typedef cint32_t type; };
+
+
+/* Base class of all expressions, 'D' is derived expression class */
+template <typename D>
+struct expr
+{
+    const D &self() const { return static_cast<const D &>(*this); }
+};
+
+
+template <typename T, typename E>
+void assign(T *pZ, int len, const E &e);
+
+
+/*******************************************************************************
+ * Vector view over memory provided by caller, 'T' is 'int16_t' or 'int32_t',
+ * const qualified for input only vectors. Assignment of expression or span
+ * writes vector elements, it never rebinds view.
+ ******************************************************************************/
+template <typename T>
+struct span : expr<span<T> >
+{
+    typedef typename std::remove_const<T>::type value_type;
+    typedef typename wide<value_type>::type wide_type;
+
+    T *p;
+    int len;
+
+    span(T *p, int len) : p(p), len(len) {}
+
+    span(const span &x) : expr<span<T> >(), p(x.p), len(x.len) {}
+
+    wide_type at(int n) const { return p[n]; }
+
+    span &operator=(const span &x)
+    {
+        assign(p, len, x);
+        return *this;
+    }
+
+    template <typename E>
+    span &operator=(const expr<E> &e)
+    {
+        assign(p, len, e.self());
+        return *this;
+    }
+};
+
+
+/* Scalar constant, broadcast to all elements */
+template <typename T>
+struct scalar : expr<scalar<T> >
+{
+    typedef T value_type;
+    typedef typename wide<T>::type wide_type;
+
+    T k;
+
+    explicit scalar(T k) : k(k) {}
+
+    wide_type at(int) const { return k; }
+};
+
+
+/* Binary operation, 'OP' is functor on wide type */
+template <typename OP, typename L, typename R>
+struct binary : expr<binary<OP, L, R> >
+{
+    typedef typename L::value_type value_type;
+    typedef typename L::wide_type wide_type;
+
+    static_assert(std::is_same<value_type, typename R::value_type>::value,
+                  "cimlib: expression operands must have the same type");
+
+    L l;
+    R r;
+
+    binary(const L &l, const R &r) : l(l), r(r) {}
+
+    wide_type at(int n) const { return OP::apply(l.at(n), r.at(n)); }
+};
+
+
+struct op_add
+{
+    template <typename W> static W apply(W x, W y) { return x + y; }
+};
+
+struct op_sub
+{
+    template <typename W> static W apply(W x, W y) { return x - y; }
+};
+
+struct op_mul
+{
+    template <typename W> static W apply(W x, W y) { return x * y; }
+};
+
+
+/* Arithmetic shift right, radix of products */
+template <typename E>
+struct shr : expr<shr<E> >
+{
+    typedef typename E::value_type value_type;
+    typedef typename E::wide_type wide_type;
+
+    E e;
+    int radix;
+
+    shr(const E &e, int radix) : e(e), radix(radix) {}
+
+    wide_type at(int n) const { return e.at(n) >> radix; }
+};
+
+
+/* Saturation to range of expression type */
+template <typename E>
+struct saturate : expr<saturate<E> >
+{
+    typedef typename E::value_type value_type;
+    typedef typename E::wide_type wide_type;
+
+    E e;
+
+    explicit saturate(const E &e) : e(e) {}
+
+    wide_type at(int n) const
+    {
+        const wide_type hi = std::numeric_limits<value_type>::max();
+        const wide_type lo = std::numeric_limits<value_type>::min();
+        wide_type tmp = e.at(n);
+
+        /* Not 'CIMLIB_SAT_INT', expression is not profiled function */
+        return (tmp > hi) ? hi : ((tmp < lo) ? lo : tmp);
+    }
+};
+
+
+/* Expression operators */
+template <typename L, typename R>
+inline binary<op_add, L, R> operator+(const expr<L> &l, const expr<R> &r)
+{
+    return binary<op_add, L, R>(l.self(), r.self());
+}
+
+template <typename L, typename R>
+inline binary<op_sub, L, R> operator-(const expr<L> &l, const expr<R> &r)
+{
+    return binary<op_sub, L, R>(l.self(), r.self());
+}
+
+template <typename L, typename R>
+inline binary<op_mul, L, R> operator*(const expr<L> &l, const expr<R> &r)
+{
+    return binary<op_mul, L, R>(l.self(), r.self());
+}
+
+template <typename L>
+inline binary<op_mul, L, scalar<typename L::value_type> >
+operator*(const expr<L> &l, typename L::value_type k)
+{
+    typedef scalar<typename L::value_type> S;
+    return binary<op_mul, L, S>(l.self(), S(k));
+}
+
+template <typename R>
+inline binary<op_mul, R, scalar<typename R::value_type> >
+operator*(typename R::value_type k, const expr<R> &r)
+{
+    typedef scalar<typename R::value_type> S;
+    return binary<op_mul, R, S>(r.self(), S(k));
+}
+
+template <typename E>
+inline shr<E> operator>>(const expr<E> &e, int radix)
+{
+    return shr<E>(e.self(), radix);
+}
+
+template <typename E>
+inline saturate<E> sat(const expr<E> &e)
+{
+    return saturate<E>(e.self());
+}
+
+
+/* Library kernels, overloaded by type */
+namespace kernel
+{
+
+inline void add(int16_t *pZ, int len, const int16_t *pX, const int16_t *pY)
+{
+    vec_add_s16(pZ, len, pX, pY);
+}
+
+inline void add(int32_t *pZ, int len, const int32_t *pX, const int32_t *pY)
+{
+    vec_add_s32(pZ, len, pX, pY);
+}
+
+inline void add_sat(int16_t *pZ, int len, const int16_t *pX,
+                    const int16_t *pY)
+{
+    vec_add_sat_s16(pZ, len, pX, pY);
+}
+
+inline void add_sat(int32_t *pZ, int len, const int32_t *pX,
+                    const int32_t *pY)
+{
+    vec_add_sat_s32(pZ, len, pX, pY);
+}
+
+inline void sub_sat(int16_t *pZ, int len, const int16_t *pX,
+                    const int16_t *pY)
+{
+    vec_sub_sat_s16(pZ, len, pX, pY);
+}
+
+inline void sub_sat(int32_t *pZ, int len, const int32_t *pX,
+                    const int32_t *pY)
+{
+    vec_sub_sat_s32(pZ, len, pX, pY);
+}
+
+inline void mul(int16_t *pZ, int len, int radix, const int16_t *pX,
+                const int16_t *pY)
+{
+    vec_mul_s16(pZ, len, radix, pX, pY);
+}
+
+inline void mul(int32_t *pZ, int len, int radix, const int32_t *pX,
+                const int32_t *pY)
+{
+    vec_mul_s32(pZ, len, radix, pX, pY);
+}
+
+inline void mul_sat(int16_t *pZ, int len, int radix, const int16_t *pX,
+                    const int16_t *pY)
+{
+    vec_mul_sat_s16(pZ, len, radix, pX, pY);
+}
+
+inline void mul_sat(int32_t *pZ, int len, int radix, const int32_t *pX,
+                    const int32_t *pY)
+{
+    vec_mul_sat_s32(pZ, len, radix, pX, pY);
+}
+
+inline void mul_const_sat(int16_t *pZ, int len, int radix, const int16_t *pX,
+                          int16_t cnst)
+{
+    vec_mul_const_sat_s16(pZ, len, radix, pX, cnst);
+}
+
+inline void mul_const_sat(int32_t *pZ, int len, int radix, const int32_t *pX,
+                          int32_t cnst)
+{
+    vec_mul_const_sat_s32(pZ, len, radix, pX, cnst);
+}
+
+inline void mul_add_sat(int16_t *pZ, int len, int radix, const int16_t *pX,
+                        const int16_t *pY, const int16_t *pW)
+{
+    vec_mul_add_sat_s16(pZ, len, radix, pX, pY, pW);
+}
+
+inline void mul_add_sat(int32_t *pZ, int len, int radix, const int32_t *pX,
+                        const int32_t *pY, const int32_t *pW)
+{
+    vec_mul_add_sat_s32(pZ, len, radix, pX, pY, pW);
+}
+
+inline void mul_const_add_sat(int16_t *pZ, int len, int radix,
+                              const int16_t *pX, int16_t cnst,
+                              const int16_t *pY)
+{
+    vec_mul_const_add_sat_s16(pZ, len, radix, pX, cnst, pY);
+}
+
+inline void mul_const_add_sat(int32_t *pZ, int len, int radix,
+                              const int32_t *pX, int32_t cnst,
+                              const int32_t *pY)
+{
+    vec_mul_const_add_sat_s32(pZ, len, radix, pX, cnst, pY);
+}
+
+inline void mul(cint16_t *pZ, int len, int radix, const cint16_t *pX,
+                const cint16_t *pY)
+{
+    vec_mul_c16(pZ, len, radix, pX, pY);
+}
+
+inline void mul(cint32_t *pZ, int len, int radix, const cint32_t *pX,
+                const cint32_t *pY)
+{
+    vec_mul_c32(pZ, len, radix, pX, pY);
+}
+
+inline void mul_sat(cint16_t *pZ, int len, int radix, const cint16_t *pX,
+                    const cint16_t *pY)
+{
+    vec_mul_sat_c16(pZ, len, radix, pX, pY);
+}
+
+inline void mul_sat(cint32_t *pZ, int len, int radix, const cint32_t *pX,
+                    const cint32_t *pY)
+{
+    vec_mul_sat_c32(pZ, len, radix, pX, pY);
+}
+
+} /* namespace kernel */
+
+
+/* Output and expression must have the same element type, kernel overloads
+ * check it too, so mismatched expression is not bound to converting one */
+template <typename T, typename E>
+inline void assign_check(const E &)
+{
+    static_assert(std::is_same<T, typename E::value_type>::value,
+                  "cimlib: expression and output span must have same type");
+}
+
+
+/*******************************************************************************
+ * These functions evaluate expression into output vector. Generic version
+ * runs one loop over all elements, overloads for expressions which map to
+ * one library kernel call that kernel.
+ *
+ * @param[out]  pZ   Pointer to output vector.
+ * @param[in]   len  Vector length.
+ * @param[in]   e    Expression.
+ ******************************************************************************/
+template <typename T, typename E>
+inline void assign(T *pZ, int len, const E &e)
+{
+    assign_check<T>(e);
+    int n;
+
+    for (n = 0; n < len; n++) {
+        pZ[n] = (T)e.at(n);
+    }
+}
+
+template <typename T, typename X, typename Y>
+inline void assign(T *pZ, int len, const binary<op_add, span<X>, span<Y> > &e)
+{
+    assign_check<T>(e);
+    kernel::add(pZ, len, e.l.p, e.r.p);
+}
+
+template <typename T, typename X, typename Y>
+inline void assign(T *pZ, int len,
+                   const saturate<binary<op_add, span<X>, span<Y> > > &e)
+{
+    assign_check<T>(e);
+    kernel::add_sat(pZ, len, e.e.l.p, e.e.r.p);
+}
+
+template <typename T, typename X, typename Y>
+inline void assign(T *pZ, int len,
+                   const saturate<binary<op_sub, span<X>, span<Y> > > &e)
+{
+    assign_check<T>(e);
+    kernel::sub_sat(pZ, len, e.e.l.p, e.e.r.p);
+}
+
+template <typename T, typename X, typename Y>
+inline void assign(T *pZ, int len,
+                   const shr<binary<op_mul, span<X>, span<Y> > > &e)
+{
+    assign_check<T>(e);
+    kernel::mul(pZ, len, e.radix, e.e.l.p, e.e.r.p);
+}
+
+template <typename T, typename X, typename Y>
+inline void assign(T *pZ, int len,
+                   const saturate<shr<binary<op_mul, span<X>, span<Y> > > > &e)
+{
+    assign_check<T>(e);
+    kernel::mul_sat(pZ, len, e.e.radix, e.e.e.l.p, e.e.e.r.p);
+}
+
+template <typename T, typename X, typename K>
+inline void assign(T *pZ, int len,
+                   const saturate<shr<binary<op_mul, span<X>,
+                       scalar<K> > > > &e)
+{
+    assign_check<T>(e);
+    kernel::mul_const_sat(pZ, len, e.e.radix, e.e.e.l.p, e.e.e.r.k);
+}
+
+template <typename T, typename X, typename Y, typename W>
+inline void assign(T *pZ, int len,
+                   const saturate<binary<op_add,
+                       shr<binary<op_mul, span<X>, span<Y> > >,
+                       span<W> > > &e)
+{
+    assign_check<T>(e);
+    kernel::mul_add_sat(pZ, len, e.e.l.radix, e.e.l.e.l.p, e.e.l.e.r.p,
+                        e.e.r.p);
+}
+
+template <typename T, typename X, typename K, typename Y>
+inline void assign(T *pZ, int len,
+                   const saturate<binary<op_add,
+                       shr<binary<op_mul, span<X>, scalar<K> > >,
+                       span<Y> > > &e)
+{
+    assign_check<T>(e);
+    kernel::mul_const_add_sat(pZ, len, e.e.l.radix, e.e.l.e.l.p,
+                              e.e.l.e.r.k, e.e.r.p);
+}
+
+
+/* -----------------------------------------------------------------------------
+ * Fixed point types
+ *
+ * Fixed point value types with compile time radix 'R', 'T' is 'int16_t' or
+ * 'int32_t'. Shifts and rounding constants are immediate, values with
+ * different radix are different types, so radix mismatch is compile error,
+ * use 'radix_cast' for explicit radix change:
+ *
+ *     typedef cimlib::fixed<12, int16_t> q12_t;
+ *
+ *     constexpr q12_t k(1.25);                  // CIMLIB_CONST_S16(1.25, 12)
+ *     q12_t y = k * x + q12_t(0.5);
+ *
+ * Arithmetic operators wrap around, products are truncated as by
+ * 'sc_mul_s16' function, 'sat_*' functions have the same results as
+ * 'sc_add_sat_s16' and 'sc_mul_sat_s16' functions. Arrays of these types
+ * are processed by 'vec_mul', 'vec_mul_sat' (real and complex) and
+ * 'vec_mul_add_sat' (real) overloads below, radix is taken from type. Other
+ * library kernels take arrays converted by 'raw' function and radix
+ * 'fixed<R, T>::radix'.
+ * ---------------------------------------------------------------------------*/
+
+/* Tag of constructor from raw fixed point value */
+struct raw_t {};
+
+
+/* Real fixed point type, same layout as 'T' */
+template <int R, typename T>
+struct fixed
+{
+    typedef T value_type;
+    typedef typename wide<T>::type wide_type;
+
+    static_assert((R >= 0) && (R < (int)(sizeof(T) * 8 - 1)),
+                  "cimlib: radix is out of range of fixed point type");
+
+    static const int radix = R;
+
+    T v;
+
+    fixed() : v(0) {}
+
+    constexpr explicit fixed(double x)
+        : v((T)CIMLIB_ROUND(x * ((wide_type)1 << R))) {}
+
+    constexpr fixed(raw_t, T v) : v(v) {}
+
+    constexpr double to_double() const
+    {
+        return (double)v / ((wide_type)1 << R);
+    }
+
+    constexpr fixed operator-() const
+    {
+        return fixed(raw_t(), (T)-(wide_type)v);
+    }
+
+    fixed &operator+=(fixed x) { return *this = *this + x; }
+    fixed &operator-=(fixed x) { return *this = *this - x; }
+    fixed &operator*=(fixed x) { return *this = *this * x; }
+
+    friend constexpr fixed operator+(fixed x, fixed y)
+    {
+        return fixed(raw_t(), (T)((wide_type)x.v + y.v));
+    }
+
+    friend constexpr fixed operator-(fixed x, fixed y)
+    {
+        return fixed(raw_t(), (T)((wide_type)x.v - y.v));
+    }
+
+    friend constexpr fixed operator*(fixed x, fixed y)
+    {
+        return fixed(raw_t(), (T)(((wide_type)x.v * y.v) >> R));
+    }
+
+    friend constexpr bool operator==(fixed x, fixed y) { return x.v == y.v; }
+    friend constexpr bool operator!=(fixed x, fixed y) { return x.v != y.v; }
+    friend constexpr bool operator<(fixed x, fixed y) { return x.v < y.v; }
+    friend constexpr bool operator>(fixed x, fixed y) { return x.v > y.v; }
+    friend constexpr bool operator<=(fixed x, fixed y) { return x.v <= y.v; }
+    friend constexpr bool operator>=(fixed x, fixed y) { return x.v >= y.v; }
+};
+
+
+/* Complex fixed point type, same layout as 'cint16_t' and 'cint32_t' */
+template <int R, typename T>
+struct cfixed
+{
+    typedef T value_type;
+    typedef typename wide<T>::type wide_type;
+    typedef fixed<R, T> real_type;
+
+    static const int radix = R;
+
+    real_type re;
+    real_type im;
+
+    cfixed() {}
+
+    constexpr cfixed(double re, double im) : re(re), im(im) {}
+
+    constexpr cfixed(real_type re, real_type im) : re(re), im(im) {}
+
+    friend constexpr cfixed operator+(cfixed x, cfixed y)
+    {
+        return cfixed(x.re + y.re, x.im + y.im);
+    }
+
+    friend constexpr cfixed operator-(cfixed x, cfixed y)
+    {
+        return cfixed(x.re - y.re, x.im - y.im);
+    }
+
+    friend constexpr cfixed operator*(cfixed x, cfixed y)
+    {
+        return cfixed(real_type(raw_t(), (T)(((wide_type)x.re.v * y.re.v -
+                                              (wide_type)x.im.v * y.im.v) >>
+                                             R)),
+                      real_type(raw_t(), (T)(((wide_type)x.im.v * y.re.v +
+                                              (wide_type)x.re.v * y.im.v) >>
+                                             R)));
+    }
+
+    friend constexpr bool operator==(cfixed x, cfixed y)
+    {
+        return (x.re == y.re) && (x.im == y.im);
+    }
+
+    friend constexpr bool operator!=(cfixed x, cfixed y)
+    {
+        return !(x == y);
+    }
+};
+
+
+/* Saturation of wide value to fixed point type */
+template <int R, typename T>
+constexpr fixed<R, T> sat_wide(typename wide<T>::type x)
+{
+    return fixed<R, T>(raw_t(),
+                       (T)((x > std::numeric_limits<T>::max()) ?
+                           std::numeric_limits<T>::max() :
+                           (x < std::numeric_limits<T>::min()) ?
+                           std::numeric_limits<T>::min() : x));
+}
+
+template <int R, typename T>
+constexpr fixed<R, T> sat_add(fixed<R, T> x, fixed<R, T> y)
+{
+    return sat_wide<R, T>((typename wide<T>::type)x.v + y.v);
+}
+
+template <int R, typename T>
+constexpr fixed<R, T> sat_sub(fixed<R, T> x, fixed<R, T> y)
+{
+    return sat_wide<R, T>((typename wide<T>::type)x.v - y.v);
+}
+
+template <int R, typename T>
+constexpr fixed<R, T> sat_mul(fixed<R, T> x, fixed<R, T> y)
+{
+    return sat_wide<R, T>(((typename wide<T>::type)x.v * y.v) >> R);
+}
+
+
+/* Radix change of raw value by 'S' bits, multiply for higher radix, so
+ * negative values are not shifted left, shift right - for lower one */
+template <int S, typename T, bool UP = (S >= 0)>
+struct radix_shift
+{
+    static constexpr T apply(T v)
+    {
+        return (T)((typename wide<T>::type)v *
+                   ((typename wide<T>::type)1 << S));
+    }
+};
+
+template <int S, typename T>
+struct radix_shift<S, T, false>
+{
+    static constexpr T apply(T v) { return (T)(v >> -S); }
+};
+
+
+/* Radix change, shift right for lower radix, left - for higher one */
+template <int R2, int R, typename T>
+constexpr fixed<R2, T> radix_cast(fixed<R, T> x)
+{
+    static_assert((R >= 0) && (R < (int)(sizeof(T) * 8 - 1)),
+                  "cimlib: source radix is out of range of fixed point type");
+    static_assert((R2 >= 0) && (R2 < (int)(sizeof(T) * 8 - 1)),
+                  "cimlib: target radix is out of range of fixed point type");
+
+    return fixed<R2, T>(raw_t(), radix_shift<R2 - R, T>::apply(x.v));
+}
+
+
+/* Raw fixed point arrays, 'T *', 'cint16_t *' or 'cint32_t *' */
+template <int R, typename T>
+inline T *raw(fixed<R, T> *p)
+{
+    static_assert(sizeof(fixed<R, T>) == sizeof(T),
+                  "cimlib: fixed point type must have layout of raw type");
+    return reinterpret_cast<T *>(p);
+}
+
+template <int R, typename T>
+inline const T *raw(const fixed<R, T> *p)
+{
+    return raw(const_cast<fixed<R, T> *>(p));
+}
+
+template <int R, typename T>
+inline typename cplx<T>::type *raw(cfixed<R, T> *p)
+{
+    static_assert(sizeof(cfixed<R, T>) == sizeof(typename cplx<T>::type),
+                  "cimlib: fixed point type must have layout of raw type");
+    return reinterpret_cast<typename cplx<T>::type *>(p);
+}
+
+template <int R, typename T>
+inline const typename cplx<T>::type *raw(const cfixed<R, T> *p)
+{
+    return raw(const_cast<cfixed<R, T> *>(p));
+}
+
+
+/*******************************************************************************
+ * These functions process arrays of fixed point values by library kernels,
+ * radix is taken from type.
+ *
+ * @param[out]  pZ   Pointer to output array.
+ * @param[in]   len  Array length.
+ * @param[in]   pX   Pointer to input array.
+ * @param[in]   pY   Pointer to input array.
+ * @param[in]   pW   Pointer to input addend array.
+ ******************************************************************************/
+template <int R, typename T>
+inline void vec_mul(fixed<R, T> *pZ, int len, const fixed<R, T> *pX,
+                    const fixed<R, T> *pY)
+{
+    kernel::mul(raw(pZ), len, R, raw(pX), raw(pY));
+}
+
+template <int R, typename T>
+inline void vec_mul_sat(fixed<R, T> *pZ, int len, const fixed<R, T> *pX,
+                        const fixed<R, T> *pY)
+{
+    kernel::mul_sat(raw(pZ), len, R, raw(pX), raw(pY));
+}
+
+template <int R, typename T>
+inline void vec_mul_add_sat(fixed<R, T> *pZ, int len, const fixed<R, T> *pX,
+                            const fixed<R, T> *pY, const fixed<R, T> *pW)
+{
+    kernel::mul_add_sat(raw(pZ), len, R, raw(pX), raw(pY), raw(pW));
+}
+
+template <int R, typename T>
+inline void vec_mul(cfixed<R, T> *pZ, int len, const cfixed<R, T> *pX,
+                    const cfixed<R, T> *pY)
+{
+    kernel::mul(raw(pZ), len, R, raw(pX), raw(pY));
+}
+
+template <int R, typename T>
+inline void vec_mul_sat(cfixed<R, T> *pZ, int len, const cfixed<R, T> *pX,
+                        const cfixed<R, T> *pY)
+{
+    kernel::mul_sat(raw(pZ), len, R, raw(pX), raw(pY));
+}
+
+} /* namespace cimlib */
+
+
+#endif /* CIMLIB_HPP */
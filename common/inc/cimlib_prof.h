@@ -0,0 +1,400 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+#ifndef CIMLIB_PROF_H
+#define CIMLIB_PROF_H
+
+
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Profiled functions of instrumented build, 'X' macro is expanded for each
+ * exported function. Position in list is function identifier, so list is
+ * extended together with exported functions of 'cimlib.h' */
+#define CIMLIB_PROF_FUNCS(X)                                                   \
+    X(frm_cic_decim_init_s16)                                                  \
+    X(frm_cic_decim_s16)                                                       \
+    X(frm_cic_interp_init_s16)                                                 \
+    X(frm_cic_interp_s16)                                                      \
+    X(frm_ema_blk_s32)                                                         \
+    X(frm_ema_s16)                                                             \
+    X(frm_ema_s32)                                                             \
+    X(frm_goertzel_s16)                                                        \
+    X(frm_movavg_init_s16)                                                     \
+    X(frm_movavg_init_s32)                                                     \
+    X(frm_movavg_s16)                                                          \
+    X(frm_movavg_s32)                                                          \
+    X(frm_movsum_sqr_c16)                                                      \
+    X(frm_movsum_sqr_init_c16)                                                 \
+    X(frm_movsum_sqr_init_s16)                                                 \
+    X(frm_movsum_sqr_s16)                                                      \
+    X(frm_sdft_c16)                                                            \
+    X(frm_sdft_init_c16)                                                       \
+    X(frm_stats_s16)                                                           \
+    X(frm_stats_s32)                                                           \
+    X(mem_arena_alloc)                                                         \
+    X(mem_arena_init)                                                          \
+    X(mem_arena_mark)                                                          \
+    X(mem_arena_reset)                                                         \
+    X(mem_kth_min_s16)                                                         \
+    X(mem_kth_min_s32)                                                         \
+    X(mem_kth_min_ws_s16)                                                      \
+    X(mem_kth_min_ws_s32)                                                      \
+    X(mem_kth_min_ws_size_s16)                                                 \
+    X(mem_kth_min_ws_size_s32)                                                 \
+    X(mem_median_s16)                                                          \
+    X(mem_median_s32)                                                          \
+    X(mem_median_ws_s16)                                                       \
+    X(mem_median_ws_s32)                                                       \
+    X(mem_median_ws_size_s16)                                                  \
+    X(mem_median_ws_size_s32)                                                  \
+    X(mem_sort_s16)                                                            \
+    X(mem_sort_s32)                                                            \
+    X(par_chunks)                                                              \
+    X(par_mem_kth_min_ws_s32)                                                  \
+    X(par_mem_kth_min_ws_size_s32)                                             \
+    X(par_mem_median_ws_s32)                                                   \
+    X(par_mem_sort_ws_s32)                                                     \
+    X(par_mem_sort_ws_size_s32)                                                \
+    X(par_pool_create)                                                         \
+    X(par_pool_destroy)                                                        \
+    X(par_pool_run)                                                            \
+    X(par_pool_threads)                                                        \
+    X(par_ring_commit)                                                         \
+    X(par_ring_commit_mp)                                                      \
+    X(par_ring_init)                                                           \
+    X(par_ring_peek)                                                           \
+    X(par_ring_release)                                                        \
+    X(par_ring_reserve)                                                        \
+    X(par_ring_reserve_mp)                                                     \
+    X(par_sched_create)                                                        \
+    X(par_sched_destroy)                                                       \
+    X(par_sched_submit)                                                        \
+    X(par_sched_wait)                                                          \
+    X(par_vec_max_s32)                                                         \
+    X(par_vec_mul_c16)                                                         \
+    X(par_vec_mul_c32)                                                         \
+    X(par_vec_sum_s32)                                                         \
+    X(par_vec_sum_sqr_long_s32)                                                \
+    X(sc_add_c16)                                                              \
+    X(sc_add_c32)                                                              \
+    X(sc_add_sat_c16)                                                          \
+    X(sc_add_sat_c32)                                                          \
+    X(sc_add_sat_s16)                                                          \
+    X(sc_add_sat_s32)                                                          \
+    X(sc_atan2_s16)                                                            \
+    X(sc_atan2_s32)                                                            \
+    X(sc_cos_s16)                                                              \
+    X(sc_cos_s32)                                                              \
+    X(sc_div_c16)                                                              \
+    X(sc_div_c32)                                                              \
+    X(sc_div_s16)                                                              \
+    X(sc_div_s32)                                                              \
+    X(sc_ema_s16)                                                              \
+    X(sc_ema_s32)                                                              \
+    X(sc_ln_u16)                                                               \
+    X(sc_ln_u32)                                                               \
+    X(sc_log10_u16)                                                            \
+    X(sc_log10_u32)                                                            \
+    X(sc_log2_int_u16)                                                         \
+    X(sc_log2_int_u32)                                                         \
+    X(sc_log2_int_u64)                                                         \
+    X(sc_log2_u16)                                                             \
+    X(sc_log2_u32)                                                             \
+    X(sc_mac_c16)                                                              \
+    X(sc_mac_c32)                                                              \
+    X(sc_mac_cj_c16)                                                           \
+    X(sc_mac_cj_c32)                                                           \
+    X(sc_mac_cj_long_c16)                                                      \
+    X(sc_mac_cj_long_c32)                                                      \
+    X(sc_mac_long_c16)                                                         \
+    X(sc_mac_long_c32)                                                         \
+    X(sc_mac_long_s16)                                                         \
+    X(sc_mac_long_s32)                                                         \
+    X(sc_mac_s16)                                                              \
+    X(sc_mac_s32)                                                              \
+    X(sc_mac_sat_c16)                                                          \
+    X(sc_mac_sat_c32)                                                          \
+    X(sc_mac_sat_s16)                                                          \
+    X(sc_mac_sat_s32)                                                          \
+    X(sc_mag_c16)                                                              \
+    X(sc_mag_c32)                                                              \
+    X(sc_max_s16)                                                              \
+    X(sc_max_s32)                                                              \
+    X(sc_min_s16)                                                              \
+    X(sc_min_s32)                                                              \
+    X(sc_mul_c16)                                                              \
+    X(sc_mul_c16s16)                                                           \
+    X(sc_mul_c32)                                                              \
+    X(sc_mul_c32s32)                                                           \
+    X(sc_mul_cj_c16)                                                           \
+    X(sc_mul_cj_c32)                                                           \
+    X(sc_mul_cj_long_c16)                                                      \
+    X(sc_mul_cj_long_c32)                                                      \
+    X(sc_mul_cj_sat_c16)                                                       \
+    X(sc_mul_cj_sat_c32)                                                       \
+    X(sc_mul_long_c16)                                                         \
+    X(sc_mul_long_c32)                                                         \
+    X(sc_mul_long_s16)                                                         \
+    X(sc_mul_long_s32)                                                         \
+    X(sc_mul_s16)                                                              \
+    X(sc_mul_s32)                                                              \
+    X(sc_mul_sat_c16)                                                          \
+    X(sc_mul_sat_c32)                                                          \
+    X(sc_mul_sat_s16)                                                          \
+    X(sc_mul_sat_s32)                                                          \
+    X(sc_norm_c16)                                                             \
+    X(sc_norm_c32)                                                             \
+    X(sc_rcp_s16)                                                              \
+    X(sc_rcp_s32)                                                              \
+    X(sc_sin_s16)                                                              \
+    X(sc_sin_s32)                                                              \
+    X(sc_sqr_c16)                                                              \
+    X(sc_sqr_c32)                                                              \
+    X(sc_sqr_long_c16)                                                         \
+    X(sc_sqr_long_c32)                                                         \
+    X(sc_sqr_long_s16)                                                         \
+    X(sc_sqr_long_s32)                                                         \
+    X(sc_sqr_s16)                                                              \
+    X(sc_sqr_s32)                                                              \
+    X(sc_sqr_sat_c16)                                                          \
+    X(sc_sqr_sat_c32)                                                          \
+    X(sc_sqr_sat_s16)                                                          \
+    X(sc_sqr_sat_s32)                                                          \
+    X(sc_sqr_xlong_s64)                                                        \
+    X(sc_sqrt_u32)                                                             \
+    X(sc_sqrt_u64)                                                             \
+    X(sc_sub_c16)                                                              \
+    X(sc_sub_c32)                                                              \
+    X(vec_abs_s16)                                                             \
+    X(vec_abs_s32)                                                             \
+    X(vec_abs_s64)                                                             \
+    X(vec_add_c16)                                                             \
+    X(vec_add_c16p)                                                            \
+    X(vec_add_c32)                                                             \
+    X(vec_add_c32p)                                                            \
+    X(vec_add_c64)                                                             \
+    X(vec_add_const_c16)                                                       \
+    X(vec_add_const_c32)                                                       \
+    X(vec_add_const_s16)                                                       \
+    X(vec_add_const_s32)                                                       \
+    X(vec_add_const_sat_c16)                                                   \
+    X(vec_add_const_sat_c32)                                                   \
+    X(vec_add_const_sat_s16)                                                   \
+    X(vec_add_const_sat_s32)                                                   \
+    X(vec_add_s16)                                                             \
+    X(vec_add_s32)                                                             \
+    X(vec_add_s64)                                                             \
+    X(vec_add_sat_c16)                                                         \
+    X(vec_add_sat_c32)                                                         \
+    X(vec_add_sat_s16)                                                         \
+    X(vec_add_sat_s32)                                                         \
+    X(vec_bfp_add_s16)                                                         \
+    X(vec_bfp_from_s16)                                                        \
+    X(vec_bfp_from_s32)                                                        \
+    X(vec_bfp_headroom_s16)                                                    \
+    X(vec_bfp_init_s16)                                                        \
+    X(vec_bfp_mac_s16)                                                         \
+    X(vec_bfp_mul_s16)                                                         \
+    X(vec_bfp_norm_s16)                                                        \
+    X(vec_bfp_scale_s16)                                                       \
+    X(vec_bfp_sum_sqr_s16)                                                     \
+    X(vec_bfp_to_s16)                                                          \
+    X(vec_bfp_to_s32)                                                          \
+    X(vec_cent_mass_s16)                                                       \
+    X(vec_cent_mass_s32)                                                       \
+    X(vec_cent_mass_u16)                                                       \
+    X(vec_cent_mass_u32)                                                       \
+    X(vec_deinterleave_c16)                                                    \
+    X(vec_deinterleave_c32)                                                    \
+    X(vec_ema_s16)                                                             \
+    X(vec_ema_s32)                                                             \
+    X(vec_from_double_c16)                                                     \
+    X(vec_from_double_c32)                                                     \
+    X(vec_from_double_s16)                                                     \
+    X(vec_from_double_s32)                                                     \
+    X(vec_from_float_c16)                                                      \
+    X(vec_from_float_c32)                                                      \
+    X(vec_from_float_s16)                                                      \
+    X(vec_from_float_s32)                                                      \
+    X(vec_interleave_c16)                                                      \
+    X(vec_interleave_c32)                                                      \
+    X(vec_mac_c16)                                                             \
+    X(vec_mac_c16p)                                                            \
+    X(vec_mac_c32)                                                             \
+    X(vec_mac_c32p)                                                            \
+    X(vec_mac_cj_c16)                                                          \
+    X(vec_mac_cj_c32)                                                          \
+    X(vec_mac_cj_long_c16)                                                     \
+    X(vec_mac_cj_long_c32)                                                     \
+    X(vec_mac_cj_sat_c16)                                                      \
+    X(vec_mac_cj_sat_c32)                                                      \
+    X(vec_mac_cj_scale_sat_c16)                                                \
+    X(vec_mac_cj_scale_sat_c32)                                                \
+    X(vec_mac_long_c16)                                                        \
+    X(vec_mac_long_c32)                                                        \
+    X(vec_mac_long_s16)                                                        \
+    X(vec_mac_long_s32)                                                        \
+    X(vec_mac_s16)                                                             \
+    X(vec_mac_s32)                                                             \
+    X(vec_mac_sat_c16)                                                         \
+    X(vec_mac_sat_c32)                                                         \
+    X(vec_mac_sat_s16)                                                         \
+    X(vec_mac_sat_s32)                                                         \
+    X(vec_mag_c16)                                                             \
+    X(vec_mag_c16p)                                                            \
+    X(vec_mag_c32)                                                             \
+    X(vec_mag_c32p)                                                            \
+    X(vec_max_s16)                                                             \
+    X(vec_max_s32)                                                             \
+    X(vec_max_sqr_c16)                                                         \
+    X(vec_max_sqr_c32)                                                         \
+    X(vec_max_sqr_s16)                                                         \
+    X(vec_max_sqr_s32)                                                         \
+    X(vec_max_sqr_sat_c16)                                                     \
+    X(vec_max_sqr_sat_c32)                                                     \
+    X(vec_max_sqr_sat_s16)                                                     \
+    X(vec_max_sqr_sat_s32)                                                     \
+    X(vec_min_s16)                                                             \
+    X(vec_min_s32)                                                             \
+    X(vec_min_sqr_c16)                                                         \
+    X(vec_min_sqr_c32)                                                         \
+    X(vec_min_sqr_s16)                                                         \
+    X(vec_min_sqr_s32)                                                         \
+    X(vec_min_sqr_sat_c16)                                                     \
+    X(vec_min_sqr_sat_c32)                                                     \
+    X(vec_min_sqr_sat_s16)                                                     \
+    X(vec_min_sqr_sat_s32)                                                     \
+    X(vec_mul_add_sat_c16)                                                     \
+    X(vec_mul_add_sat_c32)                                                     \
+    X(vec_mul_add_sat_s16)                                                     \
+    X(vec_mul_add_sat_s32)                                                     \
+    X(vec_mul_c16)                                                             \
+    X(vec_mul_c16p)                                                            \
+    X(vec_mul_c16s16)                                                          \
+    X(vec_mul_c32)                                                             \
+    X(vec_mul_c32p)                                                            \
+    X(vec_mul_c32s32)                                                          \
+    X(vec_mul_cj_c16)                                                          \
+    X(vec_mul_cj_c32)                                                          \
+    X(vec_mul_cj_long_c16)                                                     \
+    X(vec_mul_cj_long_c32)                                                     \
+    X(vec_mul_cj_sat_c16)                                                      \
+    X(vec_mul_cj_sat_c32)                                                      \
+    X(vec_mul_const_add_sat_c16)                                               \
+    X(vec_mul_const_add_sat_c32)                                               \
+    X(vec_mul_const_add_sat_s16)                                               \
+    X(vec_mul_const_add_sat_s32)                                               \
+    X(vec_mul_const_c16)                                                       \
+    X(vec_mul_const_c32)                                                       \
+    X(vec_mul_const_s16)                                                       \
+    X(vec_mul_const_s32)                                                       \
+    X(vec_mul_const_sat_c16)                                                   \
+    X(vec_mul_const_sat_c32)                                                   \
+    X(vec_mul_const_sat_s16)                                                   \
+    X(vec_mul_const_sat_s32)                                                   \
+    X(vec_mul_long_c16)                                                        \
+    X(vec_mul_long_c32)                                                        \
+    X(vec_mul_long_s16)                                                        \
+    X(vec_mul_long_s32)                                                        \
+    X(vec_mul_mag_c16)                                                         \
+    X(vec_mul_mag_c32)                                                         \
+    X(vec_mul_s16)                                                             \
+    X(vec_mul_s16_a)                                                           \
+    X(vec_mul_s32)                                                             \
+    X(vec_mul_sat_c16)                                                         \
+    X(vec_mul_sat_c32)                                                         \
+    X(vec_mul_sat_s16)                                                         \
+    X(vec_mul_sat_s32)                                                         \
+    X(vec_narrow_sat_c64_c32)                                                  \
+    X(vec_narrow_sat_s32_s16)                                                  \
+    X(vec_narrow_sat_s64_s32)                                                  \
+    X(vec_scale_radix_s16)                                                     \
+    X(vec_scale_radix_s32)                                                     \
+    X(vec_sqr_c16)                                                             \
+    X(vec_sqr_c32)                                                             \
+    X(vec_sqr_long_c16)                                                        \
+    X(vec_sqr_long_c16p)                                                       \
+    X(vec_sqr_long_c32)                                                        \
+    X(vec_sqr_long_c32p)                                                       \
+    X(vec_sqr_long_s16)                                                        \
+    X(vec_sqr_long_s32)                                                        \
+    X(vec_sqr_s16)                                                             \
+    X(vec_sqr_s32)                                                             \
+    X(vec_sqr_sat_c16)                                                         \
+    X(vec_sqr_sat_c32)                                                         \
+    X(vec_sqr_sat_c64)                                                         \
+    X(vec_sqr_sat_s16)                                                         \
+    X(vec_sqr_sat_s32)                                                         \
+    X(vec_sqr_sat_s64)                                                         \
+    X(vec_sqra_long_c16)                                                       \
+    X(vec_sqra_long_c32)                                                       \
+    X(vec_sqra_long_s16)                                                       \
+    X(vec_sqra_long_s32)                                                       \
+    X(vec_sqrt_u64)                                                            \
+    X(vec_sub_c16)                                                             \
+    X(vec_sub_c16p)                                                            \
+    X(vec_sub_c32)                                                             \
+    X(vec_sub_c32p)                                                            \
+    X(vec_sub_c64)                                                             \
+    X(vec_sub_s16)                                                             \
+    X(vec_sub_s32)                                                             \
+    X(vec_sub_s64)                                                             \
+    X(vec_sub_sat_c16)                                                         \
+    X(vec_sub_sat_c32)                                                         \
+    X(vec_sub_sat_s16)                                                         \
+    X(vec_sub_sat_s32)                                                         \
+    X(vec_sum_c16)                                                             \
+    X(vec_sum_c32)                                                             \
+    X(vec_sum_c64)                                                             \
+    X(vec_sum_diff_c16)                                                        \
+    X(vec_sum_diff_c32)                                                        \
+    X(vec_sum_diff_s16)                                                        \
+    X(vec_sum_diff_s32)                                                        \
+    X(vec_sum_mag_c16)                                                         \
+    X(vec_sum_mag_c32)                                                         \
+    X(vec_sum_mul_c16)                                                         \
+    X(vec_sum_mul_c16s16)                                                      \
+    X(vec_sum_mul_c32)                                                         \
+    X(vec_sum_mul_c32s32)                                                      \
+    X(vec_sum_mul_cj_c16)                                                      \
+    X(vec_sum_mul_cj_c16p)                                                     \
+    X(vec_sum_mul_cj_c32)                                                      \
+    X(vec_sum_mul_cj_c32p)                                                     \
+    X(vec_sum_mul_s16)                                                         \
+    X(vec_sum_mul_s16_a)                                                       \
+    X(vec_sum_mul_s32)                                                         \
+    X(vec_sum_s16)                                                             \
+    X(vec_sum_s32)                                                             \
+    X(vec_sum_s64)                                                             \
+    X(vec_sum_sqr_c16)                                                         \
+    X(vec_sum_sqr_c32)                                                         \
+    X(vec_sum_sqr_diff_c16)                                                    \
+    X(vec_sum_sqr_diff_c32)                                                    \
+    X(vec_sum_sqr_diff_s16)                                                    \
+    X(vec_sum_sqr_diff_s32)                                                    \
+    X(vec_sum_sqr_long_c16)                                                    \
+    X(vec_sum_sqr_long_c32)                                                    \
+    X(vec_sum_sqr_long_s16)                                                    \
+    X(vec_sum_sqr_long_s32)                                                    \
+    X(vec_sum_sqr_s16)                                                         \
+    X(vec_sum_sqr_s32)                                                         \
+    X(vec_sum_sqr_xlong_c32)                                                   \
+    X(vec_sum_sqr_xlong_s32)                                                   \
+    X(vec_to_double_c16)                                                       \
+    X(vec_to_double_c32)                                                       \
+    X(vec_to_double_s16)                                                       \
+    X(vec_to_double_s32)                                                       \
+    X(vec_to_float_c16)                                                        \
+    X(vec_to_float_c32)                                                        \
+    X(vec_to_float_s16)                                                        \
+    X(vec_to_float_s32)                                                        \
+    X(vec_widen_s16_s32)                                                       \
+    X(vec_widen_s32_s64)
+
+
+#endif /* CIMLIB_PROF_H */
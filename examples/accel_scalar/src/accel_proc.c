@@ -11,6 +11,7 @@
  * ---------------------------------------------------------------------------*/
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include "mathem.h"             /* Mathematical library */
 #include "accel_proc.h"         /* Accelerometer data processing module */
 
@@ -39,6 +40,83 @@
 /* Number of initialisation samples */
 #define NR_INIT_SAMPLES  ((int)(ACCEL_FREQS / 4.0))
 
+/* Number of sensors in block of batch processing, block temporary vectors
+ * and states fit L1/L2 cache */
+#define BATCH_BLOCK_LEN  (1024)
+
+
+/* -----------------------------------------------------------------------------
+ * Types
+ * ---------------------------------------------------------------------------*/
+
+/** Batch processing job, one sample of each sensor */
+typedef struct {
+    accel_proc_batch_t *states;          /**< Batch states */
+    const accel_axis_batch_t *samples;   /**< Samples of sensors */
+    bool init;                           /**< Initialise states flag */
+
+} batch_job_t;
+
+
+/* -----------------------------------------------------------------------------
+ * Local functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * Process one block of sensors of batch. Sensors are processed by vector
+ * functions, the same algorithms as in 'accel_proc_process' function.
+ *
+ * @param[in]  ctx    Pointer to batch processing job.
+ * @param[in]  block  Block index.
+ ******************************************************************************/
+static void accel_proc_batch_block(void *ctx, int block)
+{
+    int n;
+    uint64_t sqr[BATCH_BLOCK_LEN];
+    uint32_t mag[BATCH_BLOCK_LEN];
+    int32_t lev_accel[BATCH_BLOCK_LEN];
+    const batch_job_t *job = (const batch_job_t *)ctx;
+    accel_proc_batch_t *states = job->states;
+    int first = block * BATCH_BLOCK_LEN;
+    int len = states->nr_sensors - first;
+    const int32_t *x = &job->samples->x[first];
+    const int32_t *y = &job->samples->y[first];
+    const int32_t *z = &job->samples->z[first];
+
+    if (len > BATCH_BLOCK_LEN) {
+        len = BATCH_BLOCK_LEN;
+    }
+
+    /* Estimate total acceleration level */
+    vec_sqr_long_s32(sqr, len, x);
+    vec_sqra_long_s32(sqr, len, y);
+    vec_sqra_long_s32(sqr, len, z);
+    vec_sqrt_u64(mag, len, sqr);
+
+    /* Exclude gravity */
+    for (n = 0; n < len; n++) {
+        lev_accel[n] = abs((int32_t)mag[n] - CONST(1.0));
+    }
+
+    if (job->init) {
+        /* Initialise values */
+        memcpy(&states->lev_accel[first], lev_accel, len * sizeof(int32_t));
+        memcpy(&states->filt_axis.x[first], x, len * sizeof(int32_t));
+        memcpy(&states->filt_axis.y[first], y, len * sizeof(int32_t));
+        memcpy(&states->filt_axis.z[first], z, len * sizeof(int32_t));
+    } else {
+        /* Average total acceleration level and filter axis data, using EMA */
+        vec_ema_s32(&states->lev_accel[first], len, ALPHA_LEV_ACCEL, RADIX,
+                    lev_accel);
+        vec_ema_s32(&states->filt_axis.x[first], len, ALPHA_FILT_ACCEL, RADIX,
+                    x);
+        vec_ema_s32(&states->filt_axis.y[first], len, ALPHA_FILT_ACCEL, RADIX,
+                    y);
+        vec_ema_s32(&states->filt_axis.z[first], len, ALPHA_FILT_ACCEL, RADIX,
+                    z);
+    }
+}
+
 
 /* -----------------------------------------------------------------------------
  * Exported functions
@@ -168,3 +246,124 @@ void accel_proc_get_pitch_roll_heave(accel_proc_t *states,
     tmp = (int32_t)sc_sqrt_u64(sc_sqr_long_s32(x) + sc_sqr_long_s32(y));
     angles->heave = sc_atan2_s32(z, tmp, RADIX);
 }
+
+
+/*******************************************************************************
+ * Initialises accelerometer data analysis module for batch of independent
+ * sensors. States are kept in structure of arrays, all sensors of batch are
+ * initialised together.
+ *
+ * @param[out]  states      Pointer to batch states structure.
+ * @param[in]   nr_sensors  Number of sensors.
+ * @param[in]   pool        Thread pool for blocks of sensors, can be NULL.
+ *
+ * @return                  'true' if states are allocated, 'false' -
+ *                          otherwise.
+ ******************************************************************************/
+bool accel_proc_batch_init(accel_proc_batch_t *states, int nr_sensors,
+                           par_pool_t *pool)
+{
+    size_t size = nr_sensors * sizeof(int32_t);
+
+    states->nr_sensors = nr_sensors;
+    states->cnt_init_samples = NR_INIT_SAMPLES;
+    states->pool = pool;
+    states->lev_accel = (int32_t *)calloc(1, size);
+    states->filt_axis.x = (int32_t *)calloc(1, size);
+    states->filt_axis.y = (int32_t *)calloc(1, size);
+    states->filt_axis.z = (int32_t *)calloc(1, size);
+
+    if ((states->lev_accel == NULL) || (states->filt_axis.x == NULL) ||
+        (states->filt_axis.y == NULL) || (states->filt_axis.z == NULL)) {
+        accel_proc_batch_free(states);
+        return false;
+    }
+
+    return true;
+}
+
+
+/*******************************************************************************
+ * Frees batch states.
+ *
+ * @param[in]  states  Pointer to batch states structure.
+ ******************************************************************************/
+void accel_proc_batch_free(accel_proc_batch_t *states)
+{
+    free(states->lev_accel);
+    free(states->filt_axis.x);
+    free(states->filt_axis.y);
+    free(states->filt_axis.z);
+
+    states->lev_accel = NULL;
+    states->filt_axis.x = NULL;
+    states->filt_axis.y = NULL;
+    states->filt_axis.z = NULL;
+}
+
+
+/*******************************************************************************
+ * Process accelerometer data of batch, one sample of each sensor. Results
+ * are the same as of 'accel_proc_process' function called for each sensor,
+ * except zero acceleration vector.
+ *
+ * Sensors are split into blocks, block is processed by vector functions
+ * across sensors, blocks are spread across thread pool.
+ *
+ * @param[in]  states   Pointer to batch states structure.
+ * @param[in]  samples  Pointer to samples of sensors, element per sensor.
+ ******************************************************************************/
+void accel_proc_process_batch(accel_proc_batch_t *states,
+                              const accel_axis_batch_t *samples)
+{
+    batch_job_t job;
+    int nr_blocks = (states->nr_sensors + BATCH_BLOCK_LEN - 1) /
+                    BATCH_BLOCK_LEN;
+
+    job.states = states;
+    job.samples = samples;
+    job.init = (states->cnt_init_samples == NR_INIT_SAMPLES);
+
+    par_pool_run(states->pool, accel_proc_batch_block, &job, nr_blocks);
+
+    /* Update initialisation samples count-down counter */
+    if (states->cnt_init_samples > 0) {
+        states->cnt_init_samples--;
+    }
+}
+
+
+/*******************************************************************************
+ * Gets total acceleration level of sensor of batch, in m/s2
+ *
+ * @param[in]  states  Pointer to batch states structure.
+ * @param[in]  sensor  Sensor index.
+ *
+ * @return             Total acceleration level, in m/s2.
+ ******************************************************************************/
+int32_t accel_proc_batch_get_lev_accel(accel_proc_batch_t *states,
+                                       int sensor)
+{
+    return states->lev_accel[sensor];
+}
+
+
+/*******************************************************************************
+ * Gets accelerometer pitch, roll and heave angles of sensor of batch, in
+ * radians.
+ *
+ * @param[in]   states  Pointer to batch states structure.
+ * @param[in]   sensor  Sensor index.
+ * @param[out]  angles  Accelerometer angles sample, in radians.
+ ******************************************************************************/
+void accel_proc_batch_get_pitch_roll_heave(accel_proc_batch_t *states,
+                                           int sensor, accel_angles_t *angles)
+{
+    accel_proc_t sensor_states;
+
+    sensor_states.filt_axis.x = states->filt_axis.x[sensor];
+    sensor_states.filt_axis.y = states->filt_axis.y[sensor];
+    sensor_states.filt_axis.z = states->filt_axis.z[sensor];
+
+    accel_proc_get_pitch_roll_heave(&sensor_states, angles);
+}
@@ -46,6 +46,29 @@ typedef struct {
 } accel_proc_t;
 
 
+/** Accelerometer axis of many sensors, structure of arrays, element per
+ *  sensor */
+typedef struct {
+    int32_t *x;         /**< X axis samples, in G */
+    int32_t *y;         /**< Y axis samples, in G */
+    int32_t *z;         /**< Z axis samples, in G */
+
+} accel_axis_batch_t;
+
+
+/** Accelerometer data processing states of many independent sensors,
+ *  structure of arrays, element per sensor */
+typedef struct {
+    int nr_sensors;                /**< Number of sensors */
+    int cnt_init_samples;          /**< Initialisation samples count-down
+                                        counter, common for all sensors */
+    int32_t *lev_accel;            /**< Total acceleration levels, m/s2 */
+    accel_axis_batch_t filt_axis;  /**< Filtered accelerometer axis */
+    par_pool_t *pool;              /**< Thread pool, can be NULL */
+
+} accel_proc_batch_t;
+
+
 /* -----------------------------------------------------------------------------
  * Exported functions
  * ---------------------------------------------------------------------------*/
@@ -59,4 +82,18 @@ int32_t accel_proc_get_lev_accel(accel_proc_t *states);
 void accel_proc_get_pitch_roll_heave(accel_proc_t *states,
                                      accel_angles_t *angles);
 
+bool accel_proc_batch_init(accel_proc_batch_t *states, int nr_sensors,
+                           par_pool_t *pool);
+
+void accel_proc_batch_free(accel_proc_batch_t *states);
+
+void accel_proc_process_batch(accel_proc_batch_t *states,
+                              const accel_axis_batch_t *samples);
+
+int32_t accel_proc_batch_get_lev_accel(accel_proc_batch_t *states,
+                                       int sensor);
+
+void accel_proc_batch_get_pitch_roll_heave(accel_proc_batch_t *states,
+                                           int sensor, accel_angles_t *angles);
+
 #endif /* ACCEL_PROC_H */
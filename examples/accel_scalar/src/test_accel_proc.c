@@ -25,10 +25,104 @@
 /* Number of header lines in accelerometer data file */
 #define FILE_ACCEL_DATA_NR_HEADER_LINES  (1)
 
+/* Maximum number of samples loaded for batch processing check */
+#define MAX_NR_SAMPLES  (1024)
+
+/* Number of sensors of batch processing check */
+#define NR_SENSORS  (3000)
+
+/* Number of threads of batch processing check */
+#define NR_THREADS  (4)
+
 /* -----------------------------------------------------------------------------
  * Functions
  * ---------------------------------------------------------------------------*/
 
+/*******************************************************************************
+ * Checks batch processing of many sensors against processing of each sensor
+ * by 'accel_proc_process' function. Sensor k gets accelerometer data
+ * delayed by k samples.
+ *
+ * @param[in]  file_csv  Accelerometer data CSV file, positioned after header.
+ *
+ * @return               'true' if results are the same, 'false' - otherwise.
+ ******************************************************************************/
+static bool test_batch(FILE *file_csv)
+{
+    int n, k, idx;
+    char line_csv[128];
+    int nr_samples = 0;
+    bool fl_ok = true;
+    par_pool_t *pool;
+    accel_angles_t angles, angles_ref;
+    accel_axis_batch_t samples;
+    accel_proc_batch_t batch;
+    static accel_sample_t data[MAX_NR_SAMPLES];
+    static int32_t x[NR_SENSORS], y[NR_SENSORS], z[NR_SENSORS];
+    static accel_proc_t accel_proc[NR_SENSORS];
+
+    /* Load all samples */
+    while ((nr_samples < MAX_NR_SAMPLES) &&
+           fgets(line_csv, sizeof(line_csv), file_csv)) {
+        data[nr_samples].x = FIXED(csv_get_field_int32(line_csv, 1)) / 1000;
+        data[nr_samples].y = FIXED(csv_get_field_int32(line_csv, 2)) / 1000;
+        data[nr_samples].z = FIXED(csv_get_field_int32(line_csv, 3)) / 1000;
+        nr_samples++;
+    }
+
+    if (nr_samples == 0) {
+        return false;
+    }
+
+    /* Initialise batch and reference sensors */
+    pool = par_pool_create(NR_THREADS);
+    if (!accel_proc_batch_init(&batch, NR_SENSORS, pool)) {
+        par_pool_destroy(pool);
+        return false;
+    }
+
+    for (k = 0; k < NR_SENSORS; k++) {
+        accel_proc_init(&accel_proc[k]);
+    }
+
+    samples.x = x;
+    samples.y = y;
+    samples.z = z;
+
+    for (n = 0; n < nr_samples; n++) {
+        /* One sample of each sensor */
+        for (k = 0; k < NR_SENSORS; k++) {
+            idx = (n + k) % nr_samples;
+            x[k] = data[idx].x;
+            y[k] = data[idx].y;
+            z[k] = data[idx].z;
+            accel_proc_process(&accel_proc[k], &data[idx], 1);
+        }
+
+        accel_proc_process_batch(&batch, &samples);
+
+        /* Compare results */
+        for (k = 0; k < NR_SENSORS; k++) {
+            accel_proc_get_pitch_roll_heave(&accel_proc[k], &angles_ref);
+            accel_proc_batch_get_pitch_roll_heave(&batch, k, &angles);
+
+            if ((accel_proc_get_lev_accel(&accel_proc[k]) !=
+                 accel_proc_batch_get_lev_accel(&batch, k)) ||
+                (angles.pitch != angles_ref.pitch) ||
+                (angles.roll != angles_ref.roll) ||
+                (angles.heave != angles_ref.heave)) {
+                fl_ok = false;
+            }
+        }
+    }
+
+    accel_proc_batch_free(&batch);
+    par_pool_destroy(pool);
+
+    return fl_ok;
+}
+
+
 /*******************************************************************************
  * Main function.
  *
@@ -46,6 +140,7 @@ int main(int argc, char** argv)
     accel_angles_t angles;
     accel_sample_t sample;
     accel_proc_t accel_proc;
+    bool flBatch;
 
 
     /* Reset samples counter */
@@ -95,5 +190,18 @@ int main(int argc, char** argv)
 
     printf("---------------------------------------------------------------\n");
 
-    return 0;
+    /* Check batch processing of many sensors */
+    rewind(file_csv);
+    for (n = 0; n < FILE_ACCEL_DATA_NR_HEADER_LINES; n++) {
+        fgets(line_csv, sizeof(line_csv), file_csv);
+    }
+
+    flBatch = test_batch(file_csv);
+    printf("Batch processing of %d sensors: %s\n", NR_SENSORS,
+           flBatch ? "passed" : "failed");
+
+    fclose(file_csv);
+
+    /* Non zero status if batch processing differs from one by one */
+    return flBatch ? 0 : 1;
 }
@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include <string.h>
+#include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function initialises CIC interpolator states, 16 bit signed.
+ * Registers buffer is provided by caller, use 'CIMLIB_CIC_REG_LEN' macro for
+ * its length, it is reset to zero. Output scaling compensates bit growth,
+ * 'ceil((order - 1) * log2(rate))' bits, so CIC gain is 1.0 for rate of
+ * power of two and less than 1.0 otherwise.
+ *
+ * Note: Registers are 64 bit wide, so '16 + order * ceil(log2(rate))' must
+ *       not exceed 64.
+ *
+ * @param[out]  pStates  Pointer to CIC states.
+ * @param[in]   pReg     Pointer to registers buffer, 64 bit unsigned.
+ * @param[in]   nrCh     Number of interleaved channels.
+ * @param[in]   order    Filter order, number of combs and integrators.
+ * @param[in]   rate     Interpolation rate.
+ ******************************************************************************/
+void frm_cic_interp_init_s16(frm_cic_s16_t *pStates, uint64_t *pReg, int nrCh,
+                             int order, int rate)
+{
+    CIMLIB_PROF_CALL(frm_cic_interp_init_s16, 0);
+    int k;
+    uint64_t gain = 1;
+
+    /* Bit growth, gain = rate^(order - 1) */
+    for (k = 1; k < order; k++) {
+        gain *= (uint64_t)rate;
+    }
+
+    pStates->pReg = pReg;
+    pStates->nrCh = nrCh;
+    pStates->order = order;
+    pStates->rate = rate;
+    pStates->shift = (gain > 1) ? (sc_log2_int_u64_core(gain - 1) + 1) : 0;
+    pStates->cnt = 0;
+
+    (void)memset(pReg, 0, CIMLIB_CIC_REG_LEN(order, nrCh) * sizeof(uint64_t));
+}
+
+
+/*******************************************************************************
+ * This function performs CIC (Cascaded Integrator-Comb) interpolation of
+ * frame, 16 bit signed, multiplier free. Combs and integrators use
+ * wrap-around arithmetic, states are kept between frames. Channels are
+ * interleaved, integrators of all channels are updated in one inner loop.
+ *
+ * @param[out]     pY       Pointer to output frame, interleaved channels,
+ *                          16 bit signed, 'len * rate' samples per channel.
+ * @param[in,out]  pStates  Pointer to CIC states.
+ * @param[in]      pX       Pointer to input frame, interleaved channels,
+ *                          16 bit signed.
+ * @param[in]      len      Input frame length, samples per channel.
+ *
+ * @return                  Output frame length, samples per channel.
+ ******************************************************************************/
+int frm_cic_interp_s16(int16_t *pY, frm_cic_s16_t *pStates, const int16_t *pX,
+                       int len)
+{
+    CIMLIB_PROF_FUNC(frm_cic_interp_s16, len);
+    int n, r, k, ch;
+    int64_t tmp;
+    uint64_t y, t;
+    int nrCh = pStates->nrCh;
+    int order = pStates->order;
+    int shift = pStates->shift;
+    uint64_t *pComb = pStates->pReg;
+    uint64_t *pInteg = &pStates->pReg[order * nrCh];
+    uint64_t *pIntegLast = &pInteg[(order - 1) * nrCh];
+    int64_t rnd = 0;
+
+    /* For correct rounding add half of shift */
+    if (shift != 0) {
+        rnd = ((int64_t)1 << (shift - 1));
+    }
+
+    for (n = 0; n < len; n++) {
+        /* Combs, input rate, result is fed to first integrator */
+        for (ch = 0; ch < nrCh; ch++) {
+            y = (uint64_t)(int64_t)pX[ch];
+
+            for (k = 0; k < order; k++) {
+                t = y;
+                y -= pComb[k * nrCh + ch];
+                pComb[k * nrCh + ch] = t;
+            }
+
+            pInteg[ch] += y;
+        }
+
+        pX += nrCh;
+
+        /* Integrators, output rate, zero stuffed input */
+        for (r = 0; r < pStates->rate; r++) {
+            for (k = 1; k < order; k++) {
+                for (ch = 0; ch < nrCh; ch++) {
+                    pInteg[k * nrCh + ch] += pInteg[(k - 1) * nrCh + ch];
+                }
+            }
+
+            /* Scale bit growth */
+            for (ch = 0; ch < nrCh; ch++) {
+                tmp = ((int64_t)pIntegLast[ch] + rnd) >> shift;
+                CIMLIB_SAT_INT(tmp, INT16_MAX, tmp);
+                pY[ch] = (int16_t)tmp;
+            }
+
+            pY += nrCh;
+        }
+    }
+
+    return len * pStates->rate;
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX     (12)
+#define CONST(X)  CIMLIB_CONST_S16(X, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'frm_cic_interp_s16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_frm_cic_interp_s16(void)
+{
+    int lenY;
+    frm_cic_s16_t states;
+    uint64_t reg[CIMLIB_CIC_REG_LEN(2, 2)];
+    int16_t y[24];
+    static int16_t x[6] = {
+        CONST(1.0), CONST(-2.0), CONST(3.0), CONST(4.0), CONST(3.0), CONST(4.0)
+    };
+    static int16_t res[24] = {
+        CONST(0.25), CONST(-0.5), CONST(0.5), CONST(-1.0),
+        CONST(0.75), CONST(-1.5), CONST(1.0), CONST(-2.0),
+        CONST(1.5),  CONST(-0.5), CONST(2.0), CONST( 1.0),
+        CONST(2.5),  CONST( 2.5), CONST(3.0), CONST( 4.0),
+        CONST(3.0),  CONST( 4.0), CONST(3.0), CONST( 4.0),
+        CONST(3.0),  CONST( 4.0), CONST(3.0), CONST( 4.0)
+    };
+    bool flOk = true;
+
+    /* Call 'frm_cic_interp_s16' function, 2 channels, order 2, rate 4,
+     * two frames */
+    frm_cic_interp_init_s16(&states, reg, 2, 2, 4);
+    lenY = frm_cic_interp_s16(&y[0], &states, &x[0], 1);
+    lenY += frm_cic_interp_s16(&y[2 * lenY], &states, &x[2], 2);
+
+    /* Check the correctness of the result */
+    if (lenY != 12) {
+        flOk = false;
+    }
+
+    TEST_LIBS_CHECK_RES_REAL(y, res, 24, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
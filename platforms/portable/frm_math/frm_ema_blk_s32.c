@@ -0,0 +1,177 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Block length, in samples */
+#define BLK_LEN    (64)
+
+/* Number of blocks processed in lockstep */
+#define BLK_LANES  (8)
+
+/* Decay table radix */
+#define DEC_RADIX  (31)
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function perform EMA (Exponential Moving Average) of vector,
+ * frame based, 32 bit signed, block decomposed (throughput) version of
+ * 'frm_ema_s32' function. Use 'CIMLIB_EMA_TIME_2_ALPHA_S32' macro to convert
+ * EMA time constant into alpha.
+ *
+ * Frame is split into blocks of 64 samples. Zero state response of 8 blocks
+ * is calculated in lockstep, so there are 8 independent recurrences instead
+ * of one multiply latency bound chain. After that, previous block output
+ * (carry) is propagated into every block with closed form decay
+ * '(1 - alpha)^(k + 1)', precalculated with radix 31. Frame tail, shorter
+ * than 512 samples, is processed by exact 'frm_ema_s32' recurrence.
+ *
+ * Note: Result is not bit exact with 'frm_ema_s32'. Deviation from it is
+ *       bounded by '2 / alpha + 2' LSB (alpha as fraction), e.g. 22 LSB
+ *       for alpha 0.1. Use 'frm_ema_s32' as reference.
+ *
+ * @param[in,out]  pX     Pointer to input/output vector, 32 bit signed.
+ * @param[in]      len    Vector length.
+ * @param[in]      acc    Accumulator (previous EMA), 32 bit signed.
+ * @param[in]      alpha  Alpha, [0..1.0], 32 bit signed.
+ * @param[in]      radix  Radix, [0..31].
+ *
+ * @return                New EMA (accumulator), 32 bit signed.
+ ******************************************************************************/
+int32_t frm_ema_blk_s32(int32_t *pX, int len, int32_t acc, int32_t alpha,
+                        int radix)
+{
+    CIMLIB_PROF_FUNC(frm_ema_blk_s32, len);
+    int n, k, l;
+    int64_t tmp, fac;
+    int64_t dec[BLK_LEN];
+    int32_t z[BLK_LANES];
+    int32_t *pBlk;
+    int32_t rnd = 0;
+    int64_t rndDec = ((int64_t)1 << (DEC_RADIX - 1));
+
+    /* For correct rounding add half of radix */
+    if (radix != 0) {
+        rnd = (1 << (radix - 1));
+    }
+
+    /* Decay table, (1 - alpha)^(k + 1) */
+    fac = ((int64_t)1 << DEC_RADIX) - ((int64_t)alpha << (DEC_RADIX - radix));
+    dec[0] = fac;
+    for (k = 1; k < BLK_LEN; k++) {
+        dec[k] = (dec[k - 1] * fac + rndDec) >> DEC_RADIX;
+    }
+
+    /* Process groups of blocks */
+    for (n = 0; n + BLK_LEN * BLK_LANES <= len; n += BLK_LEN * BLK_LANES) {
+        pBlk = &pX[n];
+
+        /* Zero state response, blocks in lockstep */
+        for (l = 0; l < BLK_LANES; l++) {
+            z[l] = 0;
+        }
+
+        for (k = 0; k < BLK_LEN; k++) {
+            for (l = 0; l < BLK_LANES; l++) {
+                tmp = (int64_t)alpha * (pBlk[l * BLK_LEN + k] - z[l]);
+                z[l] += (int32_t)((tmp + rnd) >> radix);
+                pBlk[l * BLK_LEN + k] = z[l];
+            }
+        }
+
+        /* Propagate carry */
+        for (l = 0; l < BLK_LANES; l++) {
+            for (k = 0; k < BLK_LEN; k++) {
+                tmp = (int64_t)acc * dec[k];
+                pBlk[k] += (int32_t)((tmp + rndDec) >> DEC_RADIX);
+            }
+            acc = pBlk[BLK_LEN - 1];
+            pBlk += BLK_LEN;
+        }
+    }
+
+    /* Frame tail, exact EMA */
+    return frm_ema_s32(&pX[n], len - n, acc, alpha, radix);
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Test vector length, several block groups and tail */
+#define TEST_LEN  (1500)
+
+/* Number of test cases */
+#define TEST_NR_CASES  (6)
+
+
+/*******************************************************************************
+ * This function tests 'frm_ema_blk_s32' function against 'frm_ema_s32'
+ * function, for small alpha and high radix too. Returns 'true' if validation
+ * is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_frm_ema_blk_s32(void)
+{
+    int n, k, radix;
+    int32_t alpha;
+    int64_t diff, bound;
+    static int32_t z[TEST_LEN];
+    static int32_t res[TEST_LEN];
+    static const double alphas[TEST_NR_CASES] = {
+        1.0 / 20.0, 0.01, 0.001, 1.0 / 20.0, 0.01, 0.001
+    };
+    static const int radices[TEST_NR_CASES] = {24, 24, 24, 30, 30, 30};
+    uint32_t seed;
+    bool flOk = true;
+
+    for (k = 0; k < TEST_NR_CASES; k++) {
+        radix = radices[k];
+        alpha = CIMLIB_CONST_S32(alphas[k], radix);
+        bound = (((int64_t)2 << radix) / alpha) + 2;
+
+        /* Generate pseudo random input vector, [-1.0..1.0] */
+        seed = 1;
+        for (n = 0; n < TEST_LEN; n++) {
+            seed = seed * 1103515245u + 12345u;
+            z[n] = (int32_t)(seed >> (31 - radix)) -
+                   CIMLIB_CONST_S32(1.0, radix);
+            res[n] = z[n];
+        }
+
+        /* Call 'frm_ema_s32' and 'frm_ema_blk_s32' functions */
+        (void)frm_ema_s32(res, TEST_LEN, CIMLIB_CONST_S32(0.5, radix), alpha,
+                          radix);
+        (void)frm_ema_blk_s32(z, TEST_LEN, CIMLIB_CONST_S32(0.5, radix),
+                              alpha, radix);
+
+        /* Check the deviation from exact EMA */
+        for (n = 0; n < TEST_LEN; n++) {
+            diff = (int64_t)z[n] - res[n];
+            if ((diff > bound) || (diff < -bound)) {
+                flOk = false;
+                printf("alpha %g, radix %d, val #%4d, out = %ld; "
+                       "ref = %ld;\n", alphas[k], radix, n, (long)z[n],
+                       (long)res[n]);
+            }
+        }
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -31,6 +31,7 @@
  ******************************************************************************/
 int16_t frm_ema_s16(int16_t *pX, int len, int16_t acc, int16_t alpha, int radix)
 {
+    CIMLIB_PROF_FUNC(frm_ema_s16, len);
     int n;
     int32_t tmp;
     int16_t rnd = 0;
@@ -31,6 +31,7 @@
  ******************************************************************************/
 int32_t frm_ema_s32(int32_t *pX, int len, int32_t acc, int32_t alpha, int radix)
 {
+    CIMLIB_PROF_FUNC(frm_ema_s32, len);
     int n;
     int64_t tmp;
     int32_t rnd = 0;
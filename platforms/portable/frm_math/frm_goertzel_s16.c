@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
+
+
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Number of Goertzel filters sharing one input pass */
+#define NR_FILT  (8)
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates squared magnitudes of DFT bins of frame using
+ * Goertzel algorithm (bank of filters), 16 bit signed. Each input sample
+ * is loaded once and shared by up to 8 filters, longer banks are processed
+ * by groups of 8 filters.
+ *
+ * Bin is calculated as X = sum(x[n] * e^(-j * w * n)), without scaling, its
+ * squared magnitude has the same units as 'sc_sqr_long_c32' result of
+ * 32 bit complex bin.
+ *
+ * Note: Filters states are 32 bit signed, they grow up to
+ *       'len / (2 * sin(w))' times of input amplitude, so frame length must
+ *       be selected to avoid overflow.
+ *
+ * @param[out]  pPow    Pointer to output squared magnitudes, 64 bit unsigned.
+ * @param[in]   nrBins  Number of bins.
+ * @param[in]   pX      Pointer to input frame, 16 bit signed.
+ * @param[in]   len     Frame length.
+ * @param[in]   pW      Pointer to bins twiddles, {cos(w), sin(w)},
+ *                      32 bit complex.
+ * @param[in]   radix   Twiddles radix, [1..30].
+ ******************************************************************************/
+void frm_goertzel_s16(uint64_t *pPow, int nrBins, const int16_t *pX, int len,
+                      const cint32_t *pW, int radix)
+{
+    CIMLIB_PROF_FUNC(frm_goertzel_s16, len);
+    int n, k, kb, nrFilt;
+    int64_t tmp;
+    int32_t s0, coef[NR_FILT];
+    int32_t s1[NR_FILT], s2[NR_FILT];
+    cint32_t bin;
+    int64_t rnd = ((int64_t)1 << (radix - 1));
+
+    for (kb = 0; kb < nrBins; kb += NR_FILT) {
+        nrFilt = nrBins - kb;
+        if (nrFilt > NR_FILT) {
+            nrFilt = NR_FILT;
+        }
+
+        /* Reset filters */
+        for (k = 0; k < nrFilt; k++) {
+            coef[k] = pW[kb + k].re;
+            s1[k] = 0;
+            s2[k] = 0;
+        }
+
+        /* Filter frame, s0 = x + 2 * cos(w) * s1 - s2 */
+        for (n = 0; n < len; n++) {
+            for (k = 0; k < nrFilt; k++) {
+                tmp = (((int64_t)coef[k] * s1[k]) << 1) + rnd;
+                s0 = pX[n] + (int32_t)(tmp >> radix) - s2[k];
+                s2[k] = s1[k];
+                s1[k] = s0;
+            }
+        }
+
+        /* Bins, X = s1 - e^(-j * w) * s2 */
+        for (k = 0; k < nrFilt; k++) {
+            tmp = (int64_t)pW[kb + k].re * s2[k] + rnd;
+            bin.re = s1[k] - (int32_t)(tmp >> radix);
+            tmp = (int64_t)pW[kb + k].im * s2[k] + rnd;
+            bin.im = (int32_t)(tmp >> radix);
+            pPow[kb + k] = sc_sqr_long_c32_core(bin);
+        }
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX          (15)
+#define CONST(X)       CIMLIB_CONST_S16(X, RADIX)
+#define CONST_LONG(X)  CIMLIB_CONST_U64(X, RADIX * 2)
+#define RADIX_W        (30)
+#define CONST_W(RE, IM)  CIMLIB_CONST_C32(RE, IM, RADIX_W)
+
+
+/*******************************************************************************
+ * This function tests 'frm_goertzel_s16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_frm_goertzel_s16(void)
+{
+    int n;
+    uint64_t y[3], err;
+    static int16_t x[16] = {
+        CONST( 0.5000000000), CONST( 0.3535533906),
+        CONST( 0.0000000000), CONST(-0.3535533906),
+        CONST(-0.5000000000), CONST(-0.3535533906),
+        CONST( 0.0000000000), CONST( 0.3535533906),
+        CONST( 0.5000000000), CONST( 0.3535533906),
+        CONST( 0.0000000000), CONST(-0.3535533906),
+        CONST(-0.5000000000), CONST(-0.3535533906),
+        CONST( 0.0000000000), CONST( 0.3535533906)
+    };
+    static cint32_t w[3] = {
+        CONST_W(0.9238795325, 0.3826834324),    /* Bin 1 of 16 */
+        CONST_W(0.7071067812, 0.7071067812),    /* Bin 2 of 16 */
+        CONST_W(0.0000000000, 1.0000000000)     /* Bin 4 of 16 */
+    };
+    static uint64_t res[3] = {
+        CONST_LONG(0.0), CONST_LONG(1.6000000000E+01), CONST_LONG(0.0)
+    };
+    bool flOk = true;
+
+    /* Call 'frm_goertzel_s16' function */
+    frm_goertzel_s16(y, 3, x, 16, w, RADIX_W);
+
+    /* Check the correctness of the results, with rounding tolerance */
+    for (n = 0; n < 3; n++) {
+        err = (y[n] > res[n]) ? (y[n] - res[n]) : (res[n] - y[n]);
+        if (err > (res[n] >> 12) + 1024) {
+            flOk = false;
+            printf("val #%3d, out = %llu; ref = %llu;\n", n,
+                   (unsigned long long)y[n], (unsigned long long)res[n]);
+        }
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
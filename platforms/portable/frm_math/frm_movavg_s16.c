@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include <string.h>
+#include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function initialises moving average states, 16 bit signed. Input
+ * history buffer is provided by caller and is reset to zero.
+ *
+ * @param[out]  pStates  Pointer to moving average states.
+ * @param[in]   pHist    Pointer to input history buffer, 'len' elements.
+ * @param[in]   len      Window length, [1..65536].
+ ******************************************************************************/
+void frm_movavg_init_s16(frm_movavg_s16_t *pStates, int16_t *pHist, int len)
+{
+    CIMLIB_PROF_CALL(frm_movavg_init_s16, 0);
+    int log2Len = 0;
+
+    /* Reciprocal of window length, normalised to [2^31..2^32) */
+    if (len > 1) {
+        log2Len = sc_log2_int_u32_core((uint32_t)(len - 1)) + 1;
+    }
+
+    pStates->pHist = pHist;
+    pStates->len = len;
+    pStates->idx = 0;
+    pStates->sum = 0;
+    pStates->shift = 31 + log2Len;
+    pStates->rcp = (uint32_t)((((uint64_t)1 << pStates->shift) + (len >> 1)) /
+                              (uint32_t)len);
+
+    (void)memset(pHist, 0, len * sizeof(int16_t));
+}
+
+
+/*******************************************************************************
+ * This function performs moving average (boxcar filter) of frame, 16 bit
+ * signed. Running sum is updated by adding new sample and subtracting
+ * oldest one, so it is O(1) per sample regardless of window length. Sum is
+ * exact, average is sum scaled by reciprocal of window length, its error is
+ * not greater than 1 LSB. States are kept between frames, samples before
+ * first frame are zeros.
+ *
+ * @param[out]     pY       Pointer to output vector, 16 bit signed.
+ *                          Can be the same as input vector.
+ * @param[in,out]  pStates  Pointer to moving average states.
+ * @param[in]      pX       Pointer to input vector, 16 bit signed.
+ * @param[in]      len      Vector length.
+ ******************************************************************************/
+void frm_movavg_s16(int16_t *pY, frm_movavg_s16_t *pStates, const int16_t *pX,
+                    int len)
+{
+    CIMLIB_PROF_FUNC(frm_movavg_s16, len);
+    int n;
+    int16_t x;
+    int16_t *pHist = pStates->pHist;
+    int idx = pStates->idx;
+    int32_t sum = pStates->sum;
+    int64_t rcp = (int64_t)pStates->rcp;
+    int shift = pStates->shift;
+    int64_t rnd = ((int64_t)1 << (shift - 1));
+
+    for (n = 0; n < len; n++) {
+        x = pX[n];
+
+        /* Running sum */
+        sum += (int32_t)x - pHist[idx];
+        pHist[idx] = x;
+
+        if (++idx == pStates->len) {
+            idx = 0;
+        }
+
+        /* Average */
+        pY[n] = (int16_t)((sum * rcp + rnd) >> shift);
+    }
+
+    pStates->idx = idx;
+    pStates->sum = sum;
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX     (11)
+#define CONST(X)  CIMLIB_CONST_S16(X, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'frm_movavg_s16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_frm_movavg_s16(void)
+{
+    frm_movavg_s16_t states;
+    int16_t hist[3];
+    int16_t y[8];
+    static int16_t x[8] = {
+        CONST(1.0), CONST(2.0), CONST(3.0), CONST(4.0),
+        CONST(5.0), CONST(6.0), CONST(7.0), CONST(8.0)
+    };
+    static int16_t res[8] = {
+        CONST(3.3333333333E-01), CONST(1.0), CONST(2.0), CONST(3.0),
+        CONST(4.0), CONST(5.0), CONST(6.0), CONST(7.0)
+    };
+    bool flOk = true;
+
+    /* Call 'frm_movavg_s16' function, two frames */
+    frm_movavg_init_s16(&states, hist, 3);
+    frm_movavg_s16(&y[0], &states, &x[0], 4);
+    frm_movavg_s16(&y[4], &states, &x[4], 4);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(y, res, 8, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include <string.h>
+#include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function initialises moving sum of squares states, 16 bit complex.
+ * Input history buffer is provided by caller and is reset to zero.
+ *
+ * @param[out]  pStates  Pointer to moving sum of squares states.
+ * @param[in]   pHist    Pointer to input history buffer, 'len' elements.
+ * @param[in]   len      Window length.
+ ******************************************************************************/
+void frm_movsum_sqr_init_c16(frm_movsum_sqr_c16_t *pStates, cint16_t *pHist,
+                             int len)
+{
+    CIMLIB_PROF_CALL(frm_movsum_sqr_init_c16, 0);
+
+    pStates->pHist = pHist;
+    pStates->len = len;
+    pStates->idx = 0;
+    pStates->sum = 0;
+
+    (void)memset(pHist, 0, len * sizeof(cint16_t));
+}
+
+
+/*******************************************************************************
+ * This function calculates moving sum of squares (energy) of frame, 16 bit
+ * complex, result with extended precision. Running sum is updated by adding
+ * square of new sample and subtracting square of oldest one, so it is O(1)
+ * per sample regardless of window length, result is exact. States are kept
+ * between frames, samples before first frame are zeros.
+ *
+ * @param[out]     pY       Pointer to output vector, 64 bit unsigned.
+ * @param[in,out]  pStates  Pointer to moving sum of squares states.
+ * @param[in]      pX       Pointer to input vector, 16 bit complex.
+ * @param[in]      len      Vector length.
+ ******************************************************************************/
+void frm_movsum_sqr_c16(uint64_t *pY, frm_movsum_sqr_c16_t *pStates,
+                        const cint16_t *pX, int len)
+{
+    CIMLIB_PROF_FUNC(frm_movsum_sqr_c16, len);
+    int n;
+    cint16_t x, xOld;
+    cint16_t *pHist = pStates->pHist;
+    int idx = pStates->idx;
+    uint64_t sum = pStates->sum;
+
+    for (n = 0; n < len; n++) {
+        x = pX[n];
+        xOld = pHist[idx];
+        pHist[idx] = x;
+
+        if (++idx == pStates->len) {
+            idx = 0;
+        }
+
+        /* Running sum of squares */
+        sum += sc_sqr_long_c16_core(x);
+        sum -= sc_sqr_long_c16_core(xOld);
+        pY[n] = sum;
+    }
+
+    pStates->idx = idx;
+    pStates->sum = sum;
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX               (12)
+#define CONST_CPLX(RE, IM)  CIMLIB_CONST_C16(RE, IM, RADIX)
+#define CONST_LONG(X)       CIMLIB_CONST_U64(X, RADIX * 2)
+
+
+/*******************************************************************************
+ * This function tests 'frm_movsum_sqr_c16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_frm_movsum_sqr_c16(void)
+{
+    frm_movsum_sqr_c16_t states;
+    cint16_t hist[3];
+    uint64_t y[8];
+    static cint16_t x[8] = {
+        CONST_CPLX(0.5, -0.5), CONST_CPLX(-1.0, 1.0),
+        CONST_CPLX(1.5, -1.5), CONST_CPLX(2.0, 2.0),
+        CONST_CPLX(-2.5, 2.5), CONST_CPLX(3.0, -3.0),
+        CONST_CPLX(3.5, 3.5), CONST_CPLX(-4.0, -4.0)
+    };
+    static uint64_t res[8] = {
+        CONST_LONG(0.5),  CONST_LONG(2.5),  CONST_LONG(7.0),
+        CONST_LONG(14.5), CONST_LONG(25.0), CONST_LONG(38.5),
+        CONST_LONG(55.0), CONST_LONG(74.5)
+    };
+    bool flOk = true;
+
+    /* Call 'frm_movsum_sqr_c16' function, two frames */
+    frm_movsum_sqr_init_c16(&states, hist, 3);
+    frm_movsum_sqr_c16(&y[0], &states, &x[0], 4);
+    frm_movsum_sqr_c16(&y[4], &states, &x[4], 4);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(y, res, 8, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -0,0 +1,122 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include <string.h>
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function initialises moving sum of squares states, 16 bit signed.
+ * Input history buffer is provided by caller and is reset to zero.
+ *
+ * @param[out]  pStates  Pointer to moving sum of squares states.
+ * @param[in]   pHist    Pointer to input history buffer, 'len' elements.
+ * @param[in]   len      Window length.
+ ******************************************************************************/
+void frm_movsum_sqr_init_s16(frm_movsum_sqr_s16_t *pStates, int16_t *pHist,
+                             int len)
+{
+    CIMLIB_PROF_CALL(frm_movsum_sqr_init_s16, 0);
+
+    pStates->pHist = pHist;
+    pStates->len = len;
+    pStates->idx = 0;
+    pStates->sum = 0;
+
+    (void)memset(pHist, 0, len * sizeof(int16_t));
+}
+
+
+/*******************************************************************************
+ * This function calculates moving sum of squares (energy) of frame, 16 bit
+ * signed, result with extended precision. Running sum is updated by adding
+ * square of new sample and subtracting square of oldest one, so it is O(1)
+ * per sample regardless of window length, result is exact. States are kept
+ * between frames, samples before first frame are zeros.
+ *
+ * @param[out]     pY       Pointer to output vector, 64 bit unsigned.
+ * @param[in,out]  pStates  Pointer to moving sum of squares states.
+ * @param[in]      pX       Pointer to input vector, 16 bit signed.
+ * @param[in]      len      Vector length.
+ ******************************************************************************/
+void frm_movsum_sqr_s16(uint64_t *pY, frm_movsum_sqr_s16_t *pStates,
+                        const int16_t *pX, int len)
+{
+    CIMLIB_PROF_FUNC(frm_movsum_sqr_s16, len);
+    int n;
+    int16_t x, xOld;
+    int16_t *pHist = pStates->pHist;
+    int idx = pStates->idx;
+    uint64_t sum = pStates->sum;
+
+    for (n = 0; n < len; n++) {
+        x = pX[n];
+        xOld = pHist[idx];
+        pHist[idx] = x;
+
+        if (++idx == pStates->len) {
+            idx = 0;
+        }
+
+        /* Running sum of squares */
+        sum += (uint32_t)((int32_t)x * x);
+        sum -= (uint32_t)((int32_t)xOld * xOld);
+        pY[n] = sum;
+    }
+
+    pStates->idx = idx;
+    pStates->sum = sum;
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX          (12)
+#define CONST(X)       CIMLIB_CONST_S16(X, RADIX)
+#define CONST_LONG(X)  CIMLIB_CONST_U64(X, RADIX * 2)
+
+
+/*******************************************************************************
+ * This function tests 'frm_movsum_sqr_s16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_frm_movsum_sqr_s16(void)
+{
+    frm_movsum_sqr_s16_t states;
+    int16_t hist[3];
+    uint64_t y[8];
+    static int16_t x[8] = {
+        CONST(1.0), CONST(-2.0), CONST(3.0), CONST(4.0),
+        CONST(-5.0), CONST(6.0), CONST(7.0), CONST(-7.9)
+    };
+    static uint64_t res[8] = {
+        CONST_LONG(1.0),  CONST_LONG(5.0),  CONST_LONG(14.0),
+        CONST_LONG(29.0), CONST_LONG(50.0), CONST_LONG(77.0),
+        CONST_LONG(110.0), CONST_LONG(1.4740845704E+02)
+    };
+    bool flOk = true;
+
+    /* Call 'frm_movsum_sqr_s16' function, two frames */
+    frm_movsum_sqr_init_s16(&states, hist, 3);
+    frm_movsum_sqr_s16(&y[0], &states, &x[0], 4);
+    frm_movsum_sqr_s16(&y[4], &states, &x[4], 4);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(y, res, 8, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
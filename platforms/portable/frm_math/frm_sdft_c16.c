@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include <string.h>
+#include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function initialises sliding DFT states, 16 bit complex. Bins and
+ * input history buffers are provided by caller and are reset to zero.
+ *
+ * @param[out]  pStates  Pointer to sliding DFT states.
+ * @param[in]   pBins    Pointer to bins buffer, 'nrBins' elements.
+ * @param[in]   pW       Pointer to bins twiddles, e^(j * 2 * pi * k / len),
+ *                       32 bit complex.
+ * @param[in]   nrBins   Number of bins.
+ * @param[in]   pHist    Pointer to input history buffer, 'len' elements.
+ * @param[in]   len      DFT length.
+ * @param[in]   radix    Twiddles radix, [1..30].
+ ******************************************************************************/
+void frm_sdft_init_c16(frm_sdft_c16_t *pStates, cint32_t *pBins,
+                       const cint32_t *pW, int nrBins, cint16_t *pHist,
+                       int len, int radix)
+{
+    CIMLIB_PROF_CALL(frm_sdft_init_c16, 0);
+
+    pStates->pBins = pBins;
+    pStates->pW = pW;
+    pStates->nrBins = nrBins;
+    pStates->pHist = pHist;
+    pStates->len = len;
+    pStates->idx = 0;
+    pStates->radix = radix;
+
+    (void)memset(pBins, 0, nrBins * sizeof(cint32_t));
+    (void)memset(pHist, 0, len * sizeof(cint16_t));
+}
+
+
+/*******************************************************************************
+ * This function performs sliding DFT of selected bins, 16 bit complex.
+ * Each input sample updates all bins, X = (X + x[n] - x[n - len]) * W,
+ * O(nrBins) operations per sample. States are kept between frames.
+ *
+ * Bin is calculated as X = sum(x[m] * e^(-j * 2 * pi * k * m / len)) over
+ * last 'len' samples, without scaling, its squared magnitude has the same
+ * units as 'sc_sqr_long_c32' result of 32 bit complex bin.
+ *
+ * Note: Rounding errors of twiddles multiplication are accumulated by bins,
+ *       use high radix (30) for twiddles, reinitialise states if long
+ *       term drift is not acceptable.
+ *
+ * @param[out]     pPow     Pointer to output squared magnitudes of bins after
+ *                          last sample of frame, 64 bit unsigned. Can be NULL.
+ * @param[in,out]  pStates  Pointer to sliding DFT states.
+ * @param[in]      pX       Pointer to input frame, 16 bit complex.
+ * @param[in]      len      Frame length.
+ ******************************************************************************/
+void frm_sdft_c16(uint64_t *pPow, frm_sdft_c16_t *pStates, const cint16_t *pX,
+                  int len)
+{
+    CIMLIB_PROF_FUNC(frm_sdft_c16, len);
+    int n, k;
+    int64_t re, im;
+    int32_t dRe, dIm;
+    cint32_t *pBins = pStates->pBins;
+    const cint32_t *pW = pStates->pW;
+    int radix = pStates->radix;
+    int64_t rnd = ((int64_t)1 << (radix - 1));
+
+    for (n = 0; n < len; n++) {
+        /* Comb, new sample minus oldest one */
+        dRe = (int32_t)pX[n].re - pStates->pHist[pStates->idx].re;
+        dIm = (int32_t)pX[n].im - pStates->pHist[pStates->idx].im;
+        pStates->pHist[pStates->idx] = pX[n];
+
+        if (++pStates->idx == pStates->len) {
+            pStates->idx = 0;
+        }
+
+        /* Resonators */
+        for (k = 0; k < pStates->nrBins; k++) {
+            re = (int64_t)pBins[k].re + dRe;
+            im = (int64_t)pBins[k].im + dIm;
+            pBins[k].re = (int32_t)((re * pW[k].re - im * pW[k].im + rnd) >>
+                                    radix);
+            pBins[k].im = (int32_t)((re * pW[k].im + im * pW[k].re + rnd) >>
+                                    radix);
+        }
+    }
+
+    /* Squared magnitudes */
+    if (pPow != NULL) {
+        for (k = 0; k < pStates->nrBins; k++) {
+            pPow[k] = sc_sqr_long_c32_core(pBins[k]);
+        }
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX          (15)
+#define CONST_LONG(X)  CIMLIB_CONST_U64(X, RADIX * 2)
+#define CONST_CPLX(RE, IM)  CIMLIB_CONST_C16(RE, IM, RADIX)
+#define RADIX_W        (30)
+#define CONST_W(RE, IM)  CIMLIB_CONST_C32(RE, IM, RADIX_W)
+
+
+/*******************************************************************************
+ * This function tests 'frm_sdft_c16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_frm_sdft_c16(void)
+{
+    int n;
+    frm_sdft_c16_t states;
+    cint32_t bins[3];
+    cint16_t hist[8];
+    uint64_t y[3], err;
+    static cint16_t x[4] = {
+        CONST_CPLX( 0.5,  0.0), CONST_CPLX( 0.0,  0.5),
+        CONST_CPLX(-0.5,  0.0), CONST_CPLX( 0.0, -0.5)
+    };
+    static cint32_t w[3] = {
+        CONST_W(1.0000000000, 0.0000000000),    /* Bin 0 of 8 */
+        CONST_W(0.0000000000, 1.0000000000),    /* Bin 2 of 8 */
+        CONST_W(0.7071067812, 0.7071067812)     /* Bin 1 of 8 */
+    };
+    static uint64_t res[3] = {
+        CONST_LONG(0.0), CONST_LONG(1.6000000000E+01), CONST_LONG(0.0)
+    };
+    bool flOk = true;
+
+    /* Call 'frm_sdft_c16' function, complex tone at bin 2, several frames */
+    frm_sdft_init_c16(&states, bins, w, 3, hist, 8, RADIX_W);
+
+    for (n = 0; n < 5; n++) {
+        frm_sdft_c16(y, &states, x, 4);
+    }
+
+    /* Check the correctness of the results, with rounding tolerance */
+    for (n = 0; n < 3; n++) {
+        err = (y[n] > res[n]) ? (y[n] - res[n]) : (res[n] - y[n]);
+        if (err > (res[n] >> 12) + 1024) {
+            flOk = false;
+            printf("val #%3d, out = %llu; ref = %llu;\n", n,
+                   (unsigned long long)y[n], (unsigned long long)res[n]);
+        }
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
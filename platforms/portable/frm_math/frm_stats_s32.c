@@ -0,0 +1,171 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates statistics of frame in one pass, 32 bit signed.
+ * Statistics are selected by 'CIMLIB_STATS_*' flags, results are the same as
+ * of 'vec_min_s32', 'vec_max_s32', 'vec_sum_s32', 'vec_sum_sqr_long_s32' and
+ * 'vec_cent_mass_s32' functions. Not selected statistics are not changed.
+ *
+ * @param[out]  pStats  Pointer to output statistics.
+ * @param[in]   flags   Statistics selection, 'CIMLIB_STATS_*' flags.
+ * @param[in]   pX      Pointer to input frame, 32 bit signed.
+ * @param[in]   len     Frame length.
+ * @param[in]   radix   Center of mass radix.
+ ******************************************************************************/
+void frm_stats_s32(frm_stats_s32_t *pStats, unsigned int flags,
+                   const int32_t *pX, int len, int radix)
+{
+    CIMLIB_PROF_FUNC(frm_stats_s32, len);
+    int n;
+    int32_t x, minX, maxX;
+    int idxMin = 0;
+    int idxMax = 0;
+    int64_t sum = 0;
+    int64_t weighMass = 0;
+    uint64_t sumSqr = 0;
+    bool flMinMax = ((flags & (CIMLIB_STATS_MIN | CIMLIB_STATS_MAX |
+                               CIMLIB_STATS_CENT_MASS)) != 0);
+    bool flSum = ((flags & (CIMLIB_STATS_SUM | CIMLIB_STATS_CENT_MASS)) != 0);
+    bool flSumSqr = ((flags & CIMLIB_STATS_SUM_SQR) != 0);
+    bool flCentMass = ((flags & CIMLIB_STATS_CENT_MASS) != 0);
+
+    minX = pX[0];
+    maxX = pX[0];
+
+    /* One pass over frame */
+    for (n = 0; n < len; n++) {
+        x = pX[n];
+
+        if (flMinMax) {
+            if (x < minX) {
+                idxMin = n;
+                minX = x;
+            }
+            if (x > maxX) {
+                idxMax = n;
+                maxX = x;
+            }
+        }
+
+        if (flSum) {
+            sum += (int64_t)x;
+        }
+
+        if (flSumSqr) {
+            sumSqr += (uint64_t)x * x;
+        }
+
+        if (flCentMass) {
+            weighMass += (int64_t)x * (n + 1);
+        }
+    }
+
+    /* Return results */
+    if ((flags & CIMLIB_STATS_MIN) != 0) {
+        pStats->min = minX;
+        pStats->idxMin = idxMin;
+    }
+
+    if ((flags & CIMLIB_STATS_MAX) != 0) {
+        pStats->max = maxX;
+        pStats->idxMax = idxMax;
+    }
+
+    if ((flags & CIMLIB_STATS_SUM) != 0) {
+        pStats->sum = sum;
+    }
+
+    if (flSumSqr) {
+        pStats->sumSqr = sumSqr;
+    }
+
+    if (flCentMass) {
+        /* Center of mass with signed vector correction */
+        weighMass -= (int64_t)len * (len + 1) * (minX / 2);
+        sum -= (int64_t)len * minX;
+
+        /* Avoid division by zero */
+        if (sum != 0) {
+            pStats->centMass = (uint32_t)((weighMass << radix) / sum);
+            pStats->centMass -= (1 << radix);
+        } else {
+            pStats->centMass = 0;
+        }
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX     (20)
+#define CONST(X)  CIMLIB_CONST_S32(X, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'frm_stats_s32' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_frm_stats_s32(void)
+{
+    int idx;
+    frm_stats_s32_t stats, statsPart;
+    static int32_t x[5] = {
+        CONST(1.0), CONST(-4.0), CONST(10.0), CONST(-1.0), CONST(7.9)
+    };
+    bool flOk = true;
+
+    /* Call 'frm_stats_s32' function, all and part of statistics */
+    frm_stats_s32(&stats, CIMLIB_STATS_ALL, x, 5, RADIX);
+
+    statsPart.sum = 0;
+    statsPart.min = 0;
+    frm_stats_s32(&statsPart, CIMLIB_STATS_MAX | CIMLIB_STATS_SUM_SQR, x, 5,
+                  RADIX);
+
+    /* Check the correctness of the results, against vector functions */
+    if ((stats.min != vec_min_s32(&idx, x, 5)) || (stats.idxMin != idx)) {
+        flOk = false;
+    }
+
+    if ((stats.max != vec_max_s32(&idx, x, 5)) || (stats.idxMax != idx)) {
+        flOk = false;
+    }
+
+    if (stats.sum != vec_sum_s32(x, 5)) {
+        flOk = false;
+    }
+
+    if (stats.sumSqr != vec_sum_sqr_long_s32(x, 5)) {
+        flOk = false;
+    }
+
+    if (stats.centMass != vec_cent_mass_s32(x, 5, RADIX)) {
+        flOk = false;
+    }
+
+    if ((statsPart.max != stats.max) || (statsPart.idxMax != stats.idxMax) ||
+        (statsPart.sumSqr != stats.sumSqr) || (statsPart.sum != 0) ||
+        (statsPart.min != 0)) {
+        flOk = false;
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -0,0 +1,162 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+#ifndef SC_CORE_H_
+#define SC_CORE_H_
+
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Scalar cores of portable platform, private to library. Kernels call them
+ * per element instead of exported scalar functions, so instrumented build
+ * counts exported calls only, kernels run at release speed. Exported scalar
+ * functions are cores with profile macro.
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * Core of 'sc_log2_int_u32' function, integer logarithm by base 2 of value,
+ * zero for zero value.
+ ******************************************************************************/
+static inline int sc_log2_int_u32_core(uint32_t x)
+{
+    static const uint8_t tableLog2[32] = {
+        0,  9,  1, 10, 13, 21,  2, 29, 11, 14, 16, 18, 22, 25, 3, 30,
+        8, 12, 20, 28, 15, 17, 24,  7, 19, 27, 23,  6, 26,  5, 4, 31
+    };
+
+    x |= x >> 1;
+    x |= x >> 2;
+    x |= x >> 4;
+    x |= x >> 8;
+    x |= x >> 16;
+
+    return tableLog2[(uint32_t)(x * 0x07C4ACDDu) >> 27];
+}
+
+
+/*******************************************************************************
+ * Core of 'sc_log2_int_u16' function.
+ ******************************************************************************/
+static inline int sc_log2_int_u16_core(uint16_t x)
+{
+    return sc_log2_int_u32_core(x);
+}
+
+
+/*******************************************************************************
+ * Core of 'sc_log2_int_u64' function.
+ ******************************************************************************/
+static inline int sc_log2_int_u64_core(uint64_t x)
+{
+    uint32_t hi = (uint32_t)(x >> 32);
+
+    return (hi != 0) ? (32 + sc_log2_int_u32_core(hi)) :
+                       sc_log2_int_u32_core((uint32_t)x);
+}
+
+
+/*******************************************************************************
+ * Core of 'sc_sqr_long_c16' function, square of magnitude, 32 bit unsigned.
+ ******************************************************************************/
+static inline uint32_t sc_sqr_long_c16_core(cint16_t x)
+{
+    return (uint32_t)((int32_t)x.re * x.re) + (uint32_t)((int32_t)x.im * x.im);
+}
+
+
+/*******************************************************************************
+ * Core of 'sc_sqr_long_c32' function, square of magnitude, 64 bit unsigned.
+ ******************************************************************************/
+static inline uint64_t sc_sqr_long_c32_core(cint32_t x)
+{
+    return (uint64_t)((int64_t)x.re * x.re) + (uint64_t)((int64_t)x.im * x.im);
+}
+
+
+/*******************************************************************************
+ * Core of 'sc_sqr_xlong_s64' function, square of value, 128 bit unsigned,
+ * calculated by 32 bit halves.
+ ******************************************************************************/
+static inline uint128_t sc_sqr_xlong_s64_core(int64_t x)
+{
+    uint128_t y;
+    uint64_t a, aHi, aLo, mid;
+
+    /* Absolute value, correct for INT64_MIN too */
+    a = (x < 0) ? (0 - (uint64_t)x) : (uint64_t)x;
+    aHi = a >> 32;
+    aLo = a & UINT32_MAX;
+    mid = aHi * aLo;
+
+    /* a^2 = aHi^2 * 2^64 + 2 * aHi * aLo * 2^32 + aLo^2 */
+    y.hi = aHi * aHi + (mid >> 31);
+    y.lo = aLo * aLo;
+    mid <<= 33;
+    y.lo += mid;
+    if (y.lo < mid) {
+        y.hi++;
+    }
+
+    return y;
+}
+
+
+/*******************************************************************************
+ * Core of 'sc_sqrt_u32' function, square root rounded down, binary search
+ * from power of two below root, zero for zero value.
+ ******************************************************************************/
+static inline uint16_t sc_sqrt_u32_core(uint32_t x)
+{
+    uint16_t y, t, s;
+
+    y = (x != 0) ? (uint16_t)(1u << (sc_log2_int_u32_core(x) >> 1)) : 0;
+    s = y >> 1;
+    t = y + s;
+
+    while (s > 0) {
+        if (((uint32_t)t * t) <= x) {
+            y = t;
+        }
+
+        s >>= 1;
+        t = y + s;
+    }
+
+    return y;
+}
+
+
+/*******************************************************************************
+ * Core of 'sc_sqrt_u64' function, square root rounded down, binary search
+ * from power of two below root, zero for zero value.
+ ******************************************************************************/
+static inline uint32_t sc_sqrt_u64_core(uint64_t x)
+{
+    uint32_t y, t, s;
+
+    y = (x != 0) ? (1u << (sc_log2_int_u64_core(x) >> 1)) : 0;
+    s = y >> 1;
+    t = y + s;
+
+    while (s > 0) {
+        if (((uint64_t)t * t) <= x) {
+            y = t;
+        }
+
+        s >>= 1;
+        t = y + s;
+    }
+
+    return y;
+}
+
+
+#endif /* SC_CORE_H_ */
@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function initialises scratch arena over memory block provided by
+ * caller. Block start is aligned up to 'CIMLIB_ALIGN_BYTES', so for block
+ * which is not aligned up to 'CIMLIB_ALIGN_BYTES - 1' bytes are lost.
+ *
+ * @param[out]  pArena  Pointer to arena.
+ * @param[in]   pBuf    Pointer to memory block.
+ * @param[in]   size    Memory block size, in bytes.
+ ******************************************************************************/
+void mem_arena_init(mem_arena_t *pArena, void *pBuf, size_t size)
+{
+    CIMLIB_PROF_CALL(mem_arena_init, 0);
+    size_t offset;
+
+    offset = (size_t)(-(uintptr_t)pBuf) & (CIMLIB_ALIGN_BYTES - 1);
+    if (offset > size) {
+        offset = size;
+    }
+
+    pArena->pBuf = (uint8_t *)pBuf + offset;
+    pArena->size = size - offset;
+    pArena->used = 0;
+}
+
+
+/*******************************************************************************
+ * This function allocates scratch buffer from arena. Buffer is aligned to
+ * 'CIMLIB_ALIGN_BYTES', its size is rounded up to 'CIMLIB_ALIGN_BYTES' too.
+ * There is no free function, use 'mem_arena_mark' and 'mem_arena_reset' to
+ * release buffers.
+ *
+ * @param[in,out]  pArena  Pointer to arena.
+ * @param[in]      size    Buffer size, in bytes.
+ *
+ * @return                 Pointer to buffer, NULL if arena has no enough
+ *                         space.
+ ******************************************************************************/
+void *mem_arena_alloc(mem_arena_t *pArena, size_t size)
+{
+    CIMLIB_PROF_CALL(mem_arena_alloc, 0);
+    void *pBuf;
+
+    size = CIMLIB_ALIGN_SIZE(size);
+    if (size > pArena->size - pArena->used) {
+        return NULL;
+    }
+
+    pBuf = pArena->pBuf + pArena->used;
+    pArena->used += size;
+
+    return pBuf;
+}
+
+
+/*******************************************************************************
+ * This function returns current arena mark (allocated size), it is used to
+ * release all buffers allocated after it by 'mem_arena_reset' function.
+ *
+ * @param[in]  pArena  Pointer to arena.
+ *
+ * @return             Arena mark.
+ ******************************************************************************/
+size_t mem_arena_mark(const mem_arena_t *pArena)
+{
+    CIMLIB_PROF_CALL(mem_arena_mark, 0);
+
+    return pArena->used;
+}
+
+
+/*******************************************************************************
+ * This function releases all buffers allocated after mark. Use zero mark to
+ * release all buffers.
+ *
+ * @param[in,out]  pArena  Pointer to arena.
+ * @param[in]      mark    Arena mark, returned by 'mem_arena_mark'.
+ ******************************************************************************/
+void mem_arena_reset(mem_arena_t *pArena, size_t mark)
+{
+    CIMLIB_PROF_CALL(mem_arena_reset, 0);
+
+    pArena->used = mark;
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/*******************************************************************************
+ * This function tests 'mem_arena_*' functions. Returns 'true' if validation
+ * is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_mem_arena(void)
+{
+    mem_arena_t arena;
+    size_t mark;
+    uint8_t *pA, *pB, *pC;
+    static uint8_t buf[4 * CIMLIB_ALIGN_BYTES + 1];
+    bool flOk = true;
+
+    /* Not aligned block, one alignment unit is lost at most */
+    mem_arena_init(&arena, &buf[1], sizeof(buf) - 1);
+    if (arena.size < 3 * CIMLIB_ALIGN_BYTES) {
+        flOk = false;
+    }
+
+    /* Aligned allocations with rounded up sizes */
+    pA = mem_arena_alloc(&arena, 1);
+    mark = mem_arena_mark(&arena);
+    pB = mem_arena_alloc(&arena, CIMLIB_ALIGN_BYTES + 1);
+    if ((pA == NULL) || (pB == NULL) ||
+        (((uintptr_t)pA & (CIMLIB_ALIGN_BYTES - 1)) != 0) ||
+        (pB != pA + CIMLIB_ALIGN_BYTES)) {
+        flOk = false;
+    }
+
+    /* Arena is exhausted */
+    if ((arena.size < 4 * CIMLIB_ALIGN_BYTES) &&
+        (mem_arena_alloc(&arena, CIMLIB_ALIGN_BYTES) != NULL)) {
+        flOk = false;
+    }
+
+    /* Release to mark and allocate again */
+    mem_arena_reset(&arena, mark);
+    pC = mem_arena_alloc(&arena, 2 * CIMLIB_ALIGN_BYTES);
+    if ((pC != pB) || (mem_arena_mark(&arena) != 3 * CIMLIB_ALIGN_BYTES)) {
+        flOk = false;
+    }
+
+    /* Release all */
+    mem_arena_reset(&arena, 0);
+    if (mem_arena_alloc(&arena, 1) != pA) {
+        flOk = false;
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
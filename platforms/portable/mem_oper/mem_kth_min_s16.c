@@ -29,6 +29,7 @@
  ******************************************************************************/
 int16_t mem_kth_min_s16(int16_t *pX, int len, int k)
 {
+    CIMLIB_PROF_FUNC(mem_kth_min_s16, len);
     int i, j, l, m;
     int16_t x, t;
 
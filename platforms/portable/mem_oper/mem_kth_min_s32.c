@@ -29,6 +29,7 @@
  ******************************************************************************/
 int32_t mem_kth_min_s32(int32_t *pX, int len, int k)
 {
+    CIMLIB_PROF_FUNC(mem_kth_min_s32, len);
     int i, j, l, m;
     int32_t x, t;
 
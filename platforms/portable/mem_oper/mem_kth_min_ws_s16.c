@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include <string.h>
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function returns workspace size needed by 'mem_kth_min_ws_s16'
+ * function.
+ *
+ * @param[in]  len  Vector length.
+ *
+ * @return          Workspace size, in bytes.
+ ******************************************************************************/
+size_t mem_kth_min_ws_size_s16(int len)
+{
+    CIMLIB_PROF_CALL(mem_kth_min_ws_size_s16, 0);
+
+    return CIMLIB_ALIGN_SIZE(len * sizeof(int16_t));
+}
+
+
+/*******************************************************************************
+ * This function searches k-th minimum element of vector, 16 bit signed.
+ * Unlike 'mem_kth_min_s16' input vector is not changed, search is done in
+ * its copy allocated from scratch arena. Arena is restored on return.
+ *
+ * @param[out]     pKth    Pointer to k-th minimum.
+ * @param[in,out]  pArena  Pointer to scratch arena, at least
+ *                         'mem_kth_min_ws_size_s16' bytes are free.
+ * @param[in]      pX      Pointer to input vector, 16 bit signed.
+ * @param[in]      len     Vector length.
+ * @param[in]      k       Minimum index, zero-based.
+ *
+ * @return                 'true' if search is done, 'false' - arena has no
+ *                         enough space.
+ ******************************************************************************/
+bool mem_kth_min_ws_s16(int16_t *pKth, mem_arena_t *pArena, const int16_t *pX,
+                       int len, int k)
+{
+    CIMLIB_PROF_FUNC(mem_kth_min_ws_s16, len);
+    size_t mark = mem_arena_mark(pArena);
+    int16_t *pTmp = mem_arena_alloc(pArena, len * sizeof(int16_t));
+
+    if (pTmp == NULL) {
+        return false;
+    }
+
+    (void)memcpy(pTmp, pX, len * sizeof(int16_t));
+    *pKth = mem_kth_min_s16(pTmp, len, k);
+
+    mem_arena_reset(pArena, mark);
+
+    return true;
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/*******************************************************************************
+ * This function tests 'mem_kth_min_ws_s16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_mem_kth_min_ws_s16(void)
+{
+    int16_t k2 = 0;
+    int16_t k3 = 0;
+    mem_arena_t arena;
+    static int16_t data[4] = {INT16_MAX, 1616, -1616, INT16_MIN};
+    static int16_t res[4] = {INT16_MAX, 1616, -1616, INT16_MIN};
+    static uint8_t buf[2 * CIMLIB_ALIGN_BYTES];
+    static int16_t res_k2 = 1616;
+    static int16_t res_k3 = INT16_MAX;
+    bool flOk = true;
+
+    /* Call 'mem_kth_min_ws_s16' function */
+    mem_arena_init(&arena, buf, sizeof(buf));
+    if (!mem_kth_min_ws_s16(&k2, &arena, data, 4, 2) ||
+        !mem_kth_min_ws_s16(&k3, &arena, data, 4, 3)) {
+        flOk = false;
+    }
+
+    /* Check the correctness of the result, input is not changed */
+    if ((k2 != res_k2) || (k3 != res_k3)) {
+        flOk = false;
+    }
+
+    TEST_LIBS_CHECK_RES_REAL(data, res, 4, flOk);
+
+    /* Workspace is released, no space for too long vector */
+    if ((mem_arena_mark(&arena) != 0) ||
+        (mem_kth_min_ws_size_s16(4) > arena.size) ||
+        mem_kth_min_ws_s16(&k2, &arena, data,
+                           (int)(arena.size / sizeof(int16_t)) + 1, 2)) {
+        flOk = false;
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
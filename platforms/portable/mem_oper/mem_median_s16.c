@@ -25,6 +25,7 @@
  ******************************************************************************/
 int16_t mem_median_s16(int16_t *pX, int len)
 {
+    CIMLIB_PROF_FUNC(mem_median_s16, len);
     int k;
     int16_t med;
 
@@ -25,6 +25,7 @@
  ******************************************************************************/
 int32_t mem_median_s32(int32_t *pX, int len)
 {
+    CIMLIB_PROF_FUNC(mem_median_s32, len);
     int k;
     int32_t med;
 
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function returns workspace size needed by 'mem_median_ws_s32'
+ * function.
+ *
+ * @param[in]  len  Vector length.
+ *
+ * @return          Workspace size, in bytes.
+ ******************************************************************************/
+size_t mem_median_ws_size_s32(int len)
+{
+    CIMLIB_PROF_CALL(mem_median_ws_size_s32, 0);
+
+    return mem_kth_min_ws_size_s32(len);
+}
+
+
+/*******************************************************************************
+ * This function searches median element of vector, 32 bit signed. Unlike
+ * 'mem_median_s32' input vector is not changed, workspace is allocated from
+ * scratch arena.
+ *
+ * @param[out]     pMed    Pointer to median value of vector.
+ * @param[in,out]  pArena  Pointer to scratch arena, at least
+ *                         'mem_median_ws_size_s32' bytes are free.
+ * @param[in]      pX      Pointer to input vector, 32 bit signed.
+ * @param[in]      len     Vector length.
+ *
+ * @return                 'true' if search is done, 'false' - arena has no
+ *                         enough space.
+ ******************************************************************************/
+bool mem_median_ws_s32(int32_t *pMed, mem_arena_t *pArena, const int32_t *pX,
+                      int len)
+{
+    CIMLIB_PROF_FUNC(mem_median_ws_s32, len);
+    int k;
+
+    /* For median use k-th minimum with index of center element */
+    k = (len & 1) ? (len / 2) : ((len / 2) - 1);
+
+    return mem_kth_min_ws_s32(pMed, pArena, pX, len, k);
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/*******************************************************************************
+ * This function tests 'mem_median_ws_s32' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_mem_median_ws_s32(void)
+{
+    int32_t med4 = 0;
+    int32_t med5 = 0;
+    mem_arena_t arena;
+    static int32_t data[5] = {INT32_MAX, 32323232, -32323232, INT32_MIN, 32};
+    static int32_t res[5] = {INT32_MAX, 32323232, -32323232, INT32_MIN, 32};
+    static uint8_t buf[2 * CIMLIB_ALIGN_BYTES];
+    static int32_t res_med4 = -32323232;
+    static int32_t res_med5 = 32;
+    bool flOk = true;
+
+    /* Call 'mem_median_ws_s32' function */
+    mem_arena_init(&arena, buf, sizeof(buf));
+    if (!mem_median_ws_s32(&med4, &arena, data, 4) ||
+        !mem_median_ws_s32(&med5, &arena, data, 5)) {
+        flOk = false;
+    }
+
+    /* Check the correctness of the result, input is not changed */
+    if ((med4 != res_med4) || (med5 != res_med5)) {
+        flOk = false;
+    }
+
+    TEST_LIBS_CHECK_RES_REAL(data, res, 5, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
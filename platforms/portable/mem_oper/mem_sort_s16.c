@@ -25,6 +25,7 @@
  ******************************************************************************/
 void mem_sort_s16(int16_t *pX, int len)
 {
+    CIMLIB_PROF_FUNC(mem_sort_s16, len);
     int n, m;
     int16_t tmp;
 
@@ -25,6 +25,7 @@
  ******************************************************************************/
 void mem_sort_s32(int32_t *pX, int len)
 {
+    CIMLIB_PROF_FUNC(mem_sort_s32, len);
     int n, m;
     int32_t tmp;
 
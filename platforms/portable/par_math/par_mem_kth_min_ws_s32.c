@@ -0,0 +1,251 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Radix digit, bits and number of buckets */
+#define DIGIT_BITS  (8)
+#define NR_BUCKETS  (1 << DIGIT_BITS)
+
+/* Key of element, sign bit is inverted for signed order of unsigned keys */
+#define KEY(X)  ((uint32_t)(X) ^ 0x80000000u)
+
+
+/* -----------------------------------------------------------------------------
+ * Types
+ * ---------------------------------------------------------------------------*/
+
+/** Job context of one selection pass */
+typedef struct {
+    const int32_t *pX;                   /**< Input vector */
+    int len;                             /**< Vector length */
+    int chunkLen;                        /**< Chunk length */
+    int shift;                           /**< Digit shift */
+    uint32_t mask;                       /**< Mask of found high digits */
+    uint32_t prefix;                     /**< Found high digits */
+    int *pHist;                          /**< Histograms of chunks */
+
+} par_kth_s32_t;
+
+
+/* -----------------------------------------------------------------------------
+ * Local functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates digits histogram of chunk elements, which high
+ * digits are equal to found ones.
+ *
+ * @param[in,out]  pCtx   Pointer to job context.
+ * @param[in]      chunk  Chunk index.
+ ******************************************************************************/
+static void par_mem_kth_min_hist_job(void *pCtx, int chunk)
+{
+    int n;
+    uint32_t key;
+    const par_kth_s32_t *pJob = (const par_kth_s32_t *)pCtx;
+    int *pHist = &pJob->pHist[chunk * NR_BUCKETS];
+    int first = chunk * pJob->chunkLen;
+    int last = first + pJob->chunkLen;
+
+    if (last > pJob->len) {
+        last = pJob->len;
+    }
+
+    for (n = 0; n < NR_BUCKETS; n++) {
+        pHist[n] = 0;
+    }
+
+    for (n = first; n < last; n++) {
+        key = KEY(pJob->pX[n]);
+        if ((key & pJob->mask) == pJob->prefix) {
+            pHist[(key >> pJob->shift) & (NR_BUCKETS - 1)]++;
+        }
+    }
+}
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function returns workspace size needed by 'par_mem_kth_min_ws_s32'
+ * function.
+ *
+ * @param[in]  len  Vector length.
+ *
+ * @return          Workspace size, in bytes.
+ ******************************************************************************/
+size_t par_mem_kth_min_ws_size_s32(int len)
+{
+    CIMLIB_PROF_CALL(par_mem_kth_min_ws_size_s32, 0);
+    int chunkLen;
+    int nrChunks = par_chunks(&chunkLen, len, sizeof(int32_t));
+
+    return CIMLIB_ALIGN_SIZE(nrChunks * NR_BUCKETS * sizeof(int));
+}
+
+
+/*******************************************************************************
+ * This function searches k-th minimum element of vector, 32 bit signed, on
+ * thread pool. Radix selection: each pass finds one 8 bit digit of k-th
+ * minimum, from high to low one, by parallel histograms of chunks over
+ * elements with already found high digits. Input vector is not changed and
+ * is not copied, only histograms are allocated from scratch arena. Arena is
+ * restored on return.
+ *
+ * @param[in,out]  pPool   Pointer to thread pool, can be NULL.
+ * @param[out]     pKth    Pointer to k-th minimum.
+ * @param[in,out]  pArena  Pointer to scratch arena, at least
+ *                         'par_mem_kth_min_ws_size_s32' bytes are free.
+ * @param[in]      pX      Pointer to input vector, 32 bit signed.
+ * @param[in]      len     Vector length.
+ * @param[in]      k       Minimum index, zero-based.
+ *
+ * @return                 'true' if search is done, 'false' - arena has no
+ *                         enough space or 'k' is out of [0..len-1] range.
+ ******************************************************************************/
+bool par_mem_kth_min_ws_s32(par_pool_t *pPool, int32_t *pKth,
+                            mem_arena_t *pArena, const int32_t *pX, int len,
+                            int k)
+{
+    CIMLIB_PROF_FUNC(par_mem_kth_min_ws_s32, len);
+    int n, m, nrChunks, cnt;
+    par_kth_s32_t job;
+    size_t mark = mem_arena_mark(pArena);
+
+    if ((k < 0) || (k >= len)) {
+        return false;
+    }
+
+    nrChunks = par_chunks(&job.chunkLen, len, sizeof(int32_t));
+    job.pHist = (int *)mem_arena_alloc(pArena,
+                                       nrChunks * NR_BUCKETS * sizeof(int));
+    if (job.pHist == NULL) {
+        return false;
+    }
+
+    job.pX = pX;
+    job.len = len;
+    job.mask = 0;
+    job.prefix = 0;
+
+    for (job.shift = 32 - DIGIT_BITS; job.shift >= 0;
+         job.shift -= DIGIT_BITS) {
+        par_pool_run(pPool, par_mem_kth_min_hist_job, &job, nrChunks);
+
+        /* Bucket of k-th minimum, 'k' becomes index inside bucket */
+        for (n = 0; n < NR_BUCKETS; n++) {
+            cnt = 0;
+            for (m = 0; m < nrChunks; m++) {
+                cnt += job.pHist[m * NR_BUCKETS + n];
+            }
+
+            if (k < cnt) {
+                break;
+            }
+            k -= cnt;
+        }
+
+        job.prefix |= (uint32_t)n << job.shift;
+        job.mask |= (uint32_t)(NR_BUCKETS - 1) << job.shift;
+    }
+
+    *pKth = (int32_t)(job.prefix ^ 0x80000000u);
+
+    mem_arena_reset(pArena, mark);
+
+    return true;
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Test vector length, several chunks */
+#define LEN  (CIMLIB_PAR_MIN_LEN * 2 + 777)
+
+
+/*******************************************************************************
+ * This function tests 'par_mem_kth_min_ws_s32' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_par_mem_kth_min_ws_s32(void)
+{
+    int n, i, nrLess, nrLessEq;
+    int32_t kth;
+    unsigned int seed;
+    par_pool_t *pPool;
+    mem_arena_t arena;
+    static int32_t x[LEN];
+    static uint8_t buf[64 * 1024];
+    static const int idx[5] = {0, 1, LEN / 2, LEN - 2, LEN - 1};
+    bool flOk = true;
+
+    /* Pseudo random input with repeated values */
+    seed = 12345u;
+    for (n = 0; n < LEN; n++) {
+        seed = seed * 1103515245u + 12345u;
+        x[n] = (n % 3 == 0) ? (int32_t)seed : (int32_t)(seed >> 24) - 128;
+    }
+    x[LEN / 3] = INT32_MIN;
+    x[LEN / 4] = INT32_MAX;
+
+    mem_arena_init(&arena, buf, sizeof(buf));
+    if (par_mem_kth_min_ws_size_s32(LEN) > arena.size) {
+        return false;
+    }
+
+    pPool = par_pool_create(3);
+
+    for (i = 0; i < 5; i++) {
+        /* Call 'par_mem_kth_min_ws_s32' function */
+        if (!par_mem_kth_min_ws_s32(pPool, &kth, &arena, x, LEN, idx[i])) {
+            flOk = false;
+        }
+
+        /* Check the correctness of the result, k-th minimum has k smaller
+         * elements at most and more than k not bigger elements */
+        nrLess = 0;
+        nrLessEq = 0;
+        for (n = 0; n < LEN; n++) {
+            nrLess += (x[n] < kth) ? 1 : 0;
+            nrLessEq += (x[n] <= kth) ? 1 : 0;
+        }
+
+        if ((nrLess > idx[i]) || (nrLessEq <= idx[i])) {
+            flOk = false;
+        }
+    }
+
+    par_pool_destroy(pPool);
+
+    if ((mem_arena_mark(&arena) != 0) ||
+        par_mem_kth_min_ws_s32(NULL, &kth, &arena, x, LEN * 100, 0)) {
+        flOk = false;
+    }
+
+    /* Index out of range and empty vector */
+    if (par_mem_kth_min_ws_s32(NULL, &kth, &arena, x, LEN, LEN) ||
+        par_mem_kth_min_ws_s32(NULL, &kth, &arena, x, LEN, -1) ||
+        par_mem_kth_min_ws_s32(NULL, &kth, &arena, x, 0, 0) ||
+        (mem_arena_mark(&arena) != 0)) {
+        flOk = false;
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
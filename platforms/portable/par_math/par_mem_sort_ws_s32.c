@@ -0,0 +1,281 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <string.h>
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Radix digit, bits and number of buckets */
+#define DIGIT_BITS  (8)
+#define NR_BUCKETS  (1 << DIGIT_BITS)
+
+/* Digit of element, sign bit is inverted for signed order of unsigned keys */
+#define DIGIT(X, SHIFT)                                                        \
+    ((((uint32_t)(X) ^ 0x80000000u) >> (SHIFT)) & (NR_BUCKETS - 1))
+
+
+/* -----------------------------------------------------------------------------
+ * Types
+ * ---------------------------------------------------------------------------*/
+
+/** Job context of one radix pass */
+typedef struct {
+    const int32_t *pSrc;                 /**< Source vector */
+    int32_t *pDst;                       /**< Destination vector */
+    int len;                             /**< Vector length */
+    int chunkLen;                        /**< Chunk length */
+    int shift;                           /**< Digit shift */
+    int *pHist;                          /**< Histograms of chunks, then
+                                              output offsets of chunks */
+
+} par_sort_s32_t;
+
+
+/* -----------------------------------------------------------------------------
+ * Local functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates digits histogram of one chunk.
+ *
+ * @param[in,out]  pCtx   Pointer to job context.
+ * @param[in]      chunk  Chunk index.
+ ******************************************************************************/
+static void par_mem_sort_hist_job(void *pCtx, int chunk)
+{
+    int n;
+    const par_sort_s32_t *pJob = (const par_sort_s32_t *)pCtx;
+    int *pHist = &pJob->pHist[chunk * NR_BUCKETS];
+    int first = chunk * pJob->chunkLen;
+    int last = first + pJob->chunkLen;
+
+    if (last > pJob->len) {
+        last = pJob->len;
+    }
+
+    for (n = 0; n < NR_BUCKETS; n++) {
+        pHist[n] = 0;
+    }
+
+    for (n = first; n < last; n++) {
+        pHist[DIGIT(pJob->pSrc[n], pJob->shift)]++;
+    }
+}
+
+
+/*******************************************************************************
+ * This function scatters elements of one chunk to their output offsets.
+ *
+ * @param[in,out]  pCtx   Pointer to job context.
+ * @param[in]      chunk  Chunk index.
+ ******************************************************************************/
+static void par_mem_sort_scatter_job(void *pCtx, int chunk)
+{
+    int n;
+    const par_sort_s32_t *pJob = (const par_sort_s32_t *)pCtx;
+    int *pOffset = &pJob->pHist[chunk * NR_BUCKETS];
+    int first = chunk * pJob->chunkLen;
+    int last = first + pJob->chunkLen;
+
+    if (last > pJob->len) {
+        last = pJob->len;
+    }
+
+    for (n = first; n < last; n++) {
+        pJob->pDst[pOffset[DIGIT(pJob->pSrc[n], pJob->shift)]++] =
+            pJob->pSrc[n];
+    }
+}
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function returns workspace size needed by 'par_mem_sort_ws_s32'
+ * function.
+ *
+ * @param[in]  len  Vector length.
+ *
+ * @return          Workspace size, in bytes.
+ ******************************************************************************/
+size_t par_mem_sort_ws_size_s32(int len)
+{
+    CIMLIB_PROF_CALL(par_mem_sort_ws_size_s32, 0);
+    int chunkLen;
+    int nrChunks = par_chunks(&chunkLen, len, sizeof(int32_t));
+
+    return CIMLIB_ALIGN_SIZE(len * sizeof(int32_t)) +
+           CIMLIB_ALIGN_SIZE(nrChunks * NR_BUCKETS * sizeof(int));
+}
+
+
+/*******************************************************************************
+ * This function sorts elements of vector, 32 bit signed, increscent order,
+ * on thread pool. LSD radix sort, 8 bit digits. In each pass every chunk
+ * calculates its own histogram, histograms are converted into output
+ * offsets in chunks order and chunks scatter their elements in parallel, so
+ * sort is stable and result does not depend on number of threads. Passes
+ * with one digit value for all elements are skipped.
+ *
+ * @param[in,out]  pPool   Pointer to thread pool, can be NULL.
+ * @param[in,out]  pArena  Pointer to scratch arena, at least
+ *                         'par_mem_sort_ws_size_s32' bytes are free.
+ * @param[in,out]  pX      Pointer to input-output vector, 32 bit signed.
+ * @param[in]      len     Vector length.
+ *
+ * @return                 'true' if vector is sorted, 'false' - arena has no
+ *                         enough space.
+ ******************************************************************************/
+bool par_mem_sort_ws_s32(par_pool_t *pPool, mem_arena_t *pArena, int32_t *pX,
+                         int len)
+{
+    CIMLIB_PROF_FUNC(par_mem_sort_ws_s32, len);
+    int n, k, nrChunks, sum, tmp;
+    int32_t *pTmp;
+    par_sort_s32_t job;
+    size_t mark = mem_arena_mark(pArena);
+
+    nrChunks = par_chunks(&job.chunkLen, len, sizeof(int32_t));
+    pTmp = (int32_t *)mem_arena_alloc(pArena, len * sizeof(int32_t));
+    job.pHist = (int *)mem_arena_alloc(pArena,
+                                       nrChunks * NR_BUCKETS * sizeof(int));
+    if ((pTmp == NULL) || (job.pHist == NULL)) {
+        mem_arena_reset(pArena, mark);
+        return false;
+    }
+
+    job.pSrc = pX;
+    job.pDst = pTmp;
+    job.len = len;
+
+    for (job.shift = 0; job.shift < 32; job.shift += DIGIT_BITS) {
+        par_pool_run(pPool, par_mem_sort_hist_job, &job, nrChunks);
+
+        /* Output offsets, buckets in ascending order, chunks in vector
+         * order inside bucket */
+        sum = 0;
+        for (n = 0; n < NR_BUCKETS; n++) {
+            for (k = 0; k < nrChunks; k++) {
+                tmp = job.pHist[k * NR_BUCKETS + n];
+                job.pHist[k * NR_BUCKETS + n] = sum;
+                sum += tmp;
+            }
+
+            /* All elements have the same digit, pass is skipped */
+            if ((job.pHist[n] == 0) && (sum == len)) {
+                break;
+            }
+        }
+
+        if (n < NR_BUCKETS) {
+            continue;
+        }
+
+        par_pool_run(pPool, par_mem_sort_scatter_job, &job, nrChunks);
+
+        job.pSrc = job.pDst;
+        job.pDst = (job.pDst == pTmp) ? pX : pTmp;
+    }
+
+    if (job.pSrc != pX) {
+        (void)memcpy(pX, job.pSrc, len * sizeof(int32_t));
+    }
+
+    mem_arena_reset(pArena, mark);
+
+    return true;
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Test vector length, several chunks */
+#define LEN  (CIMLIB_PAR_MIN_LEN * 2 + 777)
+
+
+/*******************************************************************************
+ * This function compares two 32 bit signed values for 'qsort'.
+ ******************************************************************************/
+static int test_cmp(const void *pA, const void *pB)
+{
+    int32_t a = *(const int32_t *)pA;
+    int32_t b = *(const int32_t *)pB;
+
+    return (a > b) - (a < b);
+}
+
+
+/*******************************************************************************
+ * This function tests 'par_mem_sort_ws_s32' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_par_mem_sort_ws_s32(void)
+{
+    int n;
+    unsigned int seed;
+    par_pool_t *pPool;
+    mem_arena_t arena;
+    static int32_t x[LEN], y[LEN], res[LEN], resHalf[LEN / 2];
+    static uint8_t buf[LEN * sizeof(int32_t) + 64 * 1024];
+    bool flOk = true;
+
+    /* Pseudo random input, narrow range in the second half, some passes
+     * are skipped there */
+    seed = 12345u;
+    for (n = 0; n < LEN; n++) {
+        seed = seed * 1103515245u + 12345u;
+        x[n] = (n < LEN / 2) ? (int32_t)seed : (int32_t)(seed >> 20) - 2048;
+    }
+    (void)memcpy(y, x, sizeof(x));
+
+    /* Reference is sorted by 'qsort' */
+    (void)memcpy(res, x, sizeof(x));
+    (void)memcpy(resHalf, x, sizeof(resHalf));
+    qsort(res, LEN, sizeof(int32_t), test_cmp);
+    qsort(resHalf, LEN / 2, sizeof(int32_t), test_cmp);
+
+    mem_arena_init(&arena, buf, sizeof(buf));
+    if (par_mem_sort_ws_size_s32(LEN) > arena.size) {
+        return false;
+    }
+
+    /* Call 'par_mem_sort_ws_s32' function, with and without pool */
+    pPool = par_pool_create(3);
+    if (!par_mem_sort_ws_s32(pPool, &arena, x, LEN) ||
+        !par_mem_sort_ws_s32(NULL, &arena, y, LEN / 2)) {
+        flOk = false;
+    }
+    par_pool_destroy(pPool);
+
+    /* Check the correctness of the result, the same elements as sorted by
+     * reference */
+    if ((memcmp(x, res, sizeof(res)) != 0) ||
+        (memcmp(y, resHalf, sizeof(resHalf)) != 0) ||
+        (mem_arena_mark(&arena) != 0)) {
+        flOk = false;
+    }
+
+    /* No space */
+    if (par_mem_sort_ws_s32(NULL, &arena, x, (int)(sizeof(buf) /
+                            sizeof(int32_t)))) {
+        flOk = false;
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -0,0 +1,352 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200112L
+#include <stdlib.h>
+#include <pthread.h>
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Types
+ * ---------------------------------------------------------------------------*/
+
+/** Parallel backend thread pool */
+struct par_pool_s {
+    pthread_t threads[CIMLIB_PAR_MAX_THREADS];  /**< Worker threads */
+    int nrThreads;                       /**< Number of worker threads */
+    pthread_mutex_t mutex;               /**< Job state mutex */
+    pthread_cond_t condJob;              /**< New job or stop condition */
+    pthread_cond_t condDone;             /**< Job done condition */
+    par_job_t job;                       /**< Current job function */
+    void *pCtx;                          /**< Current job context */
+    int nrChunks;                        /**< Number of job chunks */
+    int nextChunk;                       /**< Next chunk to process */
+    int nrDone;                          /**< Number of processed chunks */
+    unsigned int jobId;                  /**< Job counter, wakes workers */
+    bool flStop;                         /**< Stop workers flag */
+};
+
+
+/* -----------------------------------------------------------------------------
+ * Local functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function processes chunks of current job until all of them are taken.
+ * Mutex must be locked by caller, it is unlocked while chunk is processed.
+ *
+ * @param[in,out]  pPool  Pointer to thread pool.
+ ******************************************************************************/
+static void par_pool_work(par_pool_t *pPool)
+{
+    int chunk;
+    par_job_t job;
+    void *pCtx;
+
+    while (pPool->nextChunk < pPool->nrChunks) {
+        chunk = pPool->nextChunk++;
+        job = pPool->job;
+        pCtx = pPool->pCtx;
+
+        (void)pthread_mutex_unlock(&pPool->mutex);
+        job(pCtx, chunk);
+        (void)pthread_mutex_lock(&pPool->mutex);
+
+        if (++pPool->nrDone == pPool->nrChunks) {
+            (void)pthread_cond_signal(&pPool->condDone);
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * This function is worker thread main loop, it waits for jobs and processes
+ * their chunks together with caller thread.
+ *
+ * @param[in,out]  pArg  Pointer to thread pool.
+ *
+ * @return               NULL.
+ ******************************************************************************/
+static void *par_pool_worker(void *pArg)
+{
+    par_pool_t *pPool = (par_pool_t *)pArg;
+    unsigned int jobId = 0;
+
+    (void)pthread_mutex_lock(&pPool->mutex);
+
+    for (;;) {
+        while ((!pPool->flStop) && (pPool->jobId == jobId)) {
+            (void)pthread_cond_wait(&pPool->condJob, &pPool->mutex);
+        }
+
+        if (pPool->flStop) {
+            break;
+        }
+
+        jobId = pPool->jobId;
+        par_pool_work(pPool);
+    }
+
+    (void)pthread_mutex_unlock(&pPool->mutex);
+
+    return NULL;
+}
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function creates persistent thread pool of parallel backend. Caller
+ * thread takes part in each job, so 'nrThreads - 1' worker threads are
+ * started.
+ *
+ * @param[in]  nrThreads  Number of threads, [1..CIMLIB_PAR_MAX_THREADS].
+ *
+ * @return                Pointer to thread pool, NULL if there is no memory.
+ ******************************************************************************/
+par_pool_t *par_pool_create(int nrThreads)
+{
+    CIMLIB_PROF_FUNC(par_pool_create, 0);
+    int k;
+    par_pool_t *pPool;
+
+    if (nrThreads > CIMLIB_PAR_MAX_THREADS) {
+        nrThreads = CIMLIB_PAR_MAX_THREADS;
+    }
+
+    pPool = (par_pool_t *)malloc(sizeof(par_pool_t));
+    if (pPool == NULL) {
+        return NULL;
+    }
+
+    (void)pthread_mutex_init(&pPool->mutex, NULL);
+    (void)pthread_cond_init(&pPool->condJob, NULL);
+    (void)pthread_cond_init(&pPool->condDone, NULL);
+    pPool->job = NULL;
+    pPool->pCtx = NULL;
+    pPool->nrChunks = 0;
+    pPool->nextChunk = 0;
+    pPool->nrDone = 0;
+    pPool->jobId = 0;
+    pPool->flStop = false;
+
+    /* Pool works with less threads, if system can not start all of them */
+    pPool->nrThreads = 0;
+    for (k = 0; k < nrThreads - 1; k++) {
+        if (pthread_create(&pPool->threads[k], NULL, par_pool_worker,
+                           pPool) != 0) {
+            break;
+        }
+        pPool->nrThreads++;
+    }
+
+    return pPool;
+}
+
+
+/*******************************************************************************
+ * This function stops worker threads and frees thread pool.
+ *
+ * @param[in,out]  pPool  Pointer to thread pool, can be NULL.
+ ******************************************************************************/
+void par_pool_destroy(par_pool_t *pPool)
+{
+    CIMLIB_PROF_FUNC(par_pool_destroy, 0);
+    int k;
+
+    if (pPool == NULL) {
+        return;
+    }
+
+    (void)pthread_mutex_lock(&pPool->mutex);
+    pPool->flStop = true;
+    (void)pthread_cond_broadcast(&pPool->condJob);
+    (void)pthread_mutex_unlock(&pPool->mutex);
+
+    for (k = 0; k < pPool->nrThreads; k++) {
+        (void)pthread_join(pPool->threads[k], NULL);
+    }
+
+    (void)pthread_cond_destroy(&pPool->condDone);
+    (void)pthread_cond_destroy(&pPool->condJob);
+    (void)pthread_mutex_destroy(&pPool->mutex);
+    free(pPool);
+}
+
+
+/*******************************************************************************
+ * This function returns number of threads of thread pool, caller thread
+ * included.
+ *
+ * @param[in]  pPool  Pointer to thread pool, can be NULL.
+ *
+ * @return            Number of threads, 1 for NULL pool.
+ ******************************************************************************/
+int par_pool_threads(const par_pool_t *pPool)
+{
+    CIMLIB_PROF_CALL(par_pool_threads, 0);
+
+    return (pPool == NULL) ? 1 : (pPool->nrThreads + 1);
+}
+
+
+/*******************************************************************************
+ * This function runs job on thread pool and waits for its end. Chunks are
+ * taken by threads in any order, so job must write results of each chunk
+ * separately. Only one job runs on pool at a time, function is not
+ * reentrant for the same pool.
+ *
+ * @param[in,out]  pPool     Pointer to thread pool. If it is NULL, chunks are
+ *                           processed by caller thread in ascending order.
+ * @param[in]      job       Job function.
+ * @param[in]      pCtx      Pointer to job context.
+ * @param[in]      nrChunks  Number of chunks.
+ ******************************************************************************/
+void par_pool_run(par_pool_t *pPool, par_job_t job, void *pCtx, int nrChunks)
+{
+    CIMLIB_PROF_FUNC(par_pool_run, 0);
+    int chunk;
+
+    if ((pPool == NULL) || (pPool->nrThreads == 0) || (nrChunks < 2)) {
+        for (chunk = 0; chunk < nrChunks; chunk++) {
+            job(pCtx, chunk);
+        }
+        return;
+    }
+
+    (void)pthread_mutex_lock(&pPool->mutex);
+
+    pPool->job = job;
+    pPool->pCtx = pCtx;
+    pPool->nrChunks = nrChunks;
+    pPool->nextChunk = 0;
+    pPool->nrDone = 0;
+    pPool->jobId++;
+    (void)pthread_cond_broadcast(&pPool->condJob);
+
+    /* Caller thread works too */
+    par_pool_work(pPool);
+
+    while (pPool->nrDone < pPool->nrChunks) {
+        (void)pthread_cond_wait(&pPool->condDone, &pPool->mutex);
+    }
+
+    (void)pthread_mutex_unlock(&pPool->mutex);
+}
+
+
+/*******************************************************************************
+ * This function splits vector into chunks. Chunk boundaries depend on
+ * vector length and element size only, not on number of threads, so
+ * reductions over chunks give bit exact results for any pool.
+ *
+ * Chunk is 'CIMLIB_PAR_CHUNK_BYTES' bytes, it is longer for very long
+ * vectors to keep number of chunks up to 'CIMLIB_PAR_MAX_CHUNKS'.
+ *
+ * @param[out]  pChunkLen  Pointer to output chunk length, in elements.
+ * @param[in]   len        Vector length.
+ * @param[in]   size       Element size, in bytes.
+ *
+ * @return                 Number of chunks.
+ ******************************************************************************/
+int par_chunks(int *pChunkLen, int len, int size)
+{
+    CIMLIB_PROF_CALL(par_chunks, len);
+    int chunkLen;
+
+    chunkLen = CIMLIB_PAR_CHUNK_BYTES / size;
+    if (len > chunkLen * CIMLIB_PAR_MAX_CHUNKS) {
+        chunkLen = (len + CIMLIB_PAR_MAX_CHUNKS - 1) / CIMLIB_PAR_MAX_CHUNKS;
+    }
+
+    *pChunkLen = chunkLen;
+
+    return (len + chunkLen - 1) / chunkLen;
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Test job context */
+typedef struct {
+    int cnt[CIMLIB_PAR_MAX_CHUNKS];
+} test_ctx_t;
+
+
+/*******************************************************************************
+ * This function is test job, it counts calls of each chunk.
+ ******************************************************************************/
+static void test_par_pool_job(void *pCtx, int chunk)
+{
+    ((test_ctx_t *)pCtx)->cnt[chunk]++;
+}
+
+
+/*******************************************************************************
+ * This function tests 'par_pool_*' and 'par_chunks' functions. Returns
+ * 'true' if validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_par_pool(void)
+{
+    int k, n, chunkLen, nrChunks;
+    par_pool_t *pPool;
+    static test_ctx_t ctx;
+    bool flOk = true;
+
+    /* Fixed chunk boundaries */
+    nrChunks = par_chunks(&chunkLen, CIMLIB_PAR_CHUNK_BYTES + 1, 1);
+    if ((nrChunks != 2) || (chunkLen != CIMLIB_PAR_CHUNK_BYTES)) {
+        flOk = false;
+    }
+
+    nrChunks = par_chunks(&chunkLen, CIMLIB_PAR_CHUNK_BYTES *
+                          CIMLIB_PAR_MAX_CHUNKS * 2, 4);
+    if ((nrChunks > CIMLIB_PAR_MAX_CHUNKS) ||
+        (chunkLen * nrChunks < CIMLIB_PAR_CHUNK_BYTES *
+         CIMLIB_PAR_MAX_CHUNKS * 2)) {
+        flOk = false;
+    }
+
+    /* Each chunk is processed exactly once, several jobs on the same pool */
+    pPool = par_pool_create(4);
+    if ((pPool == NULL) || (par_pool_threads(pPool) < 1)) {
+        return false;
+    }
+
+    for (n = 0; n < 3; n++) {
+        for (k = 0; k < CIMLIB_PAR_MAX_CHUNKS; k++) {
+            ctx.cnt[k] = 0;
+        }
+
+        par_pool_run(pPool, test_par_pool_job, &ctx, 100 + n);
+
+        for (k = 0; k < CIMLIB_PAR_MAX_CHUNKS; k++) {
+            if (ctx.cnt[k] != ((k < 100 + n) ? 1 : 0)) {
+                flOk = false;
+            }
+        }
+    }
+
+    par_pool_destroy(pPool);
+
+    /* Without pool */
+    ctx.cnt[0] = 0;
+    par_pool_run(NULL, test_par_pool_job, &ctx, 1);
+    if ((ctx.cnt[0] != 1) || (par_pool_threads(NULL) != 1)) {
+        flOk = false;
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -0,0 +1,379 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200112L
+#include <sched.h>
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Atomic access to ring indexes, GCC/Clang builtins */
+#define LOAD_ACQ(P)      __atomic_load_n((P), __ATOMIC_ACQUIRE)
+#define LOAD_RLX(P)      __atomic_load_n((P), __ATOMIC_RELAXED)
+#define STORE_REL(P, V)  __atomic_store_n((P), (V), __ATOMIC_RELEASE)
+#define CAS(P, PEXP, V)                                                        \
+    __atomic_compare_exchange_n((P), (PEXP), (V), false, __ATOMIC_ACQ_REL,     \
+                                __ATOMIC_RELAXED)
+
+
+/* -----------------------------------------------------------------------------
+ * Local functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function fills view of ring elements, split into two spans at wrap
+ * around.
+ *
+ * @param[in]   pRing  Pointer to ring.
+ * @param[out]  pView  Pointer to output view.
+ * @param[in]   pos    Position of the first element.
+ * @param[in]   len    Number of elements.
+ ******************************************************************************/
+static void par_ring_view(const par_ring_t *pRing, par_ring_view_t *pView,
+                          unsigned int pos, int len)
+{
+    int offset = (int)(pos & pRing->mask);
+    int len1 = (int)pRing->mask + 1 - offset;
+
+    if (len1 > len) {
+        len1 = len;
+    }
+
+    pView->pos = pos;
+    pView->pX1 = pRing->pBuf + (size_t)offset * pRing->size;
+    pView->len1 = len1;
+    pView->pX2 = pRing->pBuf;
+    pView->len2 = len - len1;
+}
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function initialises ring buffer over memory block provided by
+ * caller. Ring elements are 'int16_t', 'int32_t', 'cint16_t', 'cint32_t' or
+ * any other type of given size.
+ *
+ * Ring is used either with single producer functions ('par_ring_reserve',
+ * 'par_ring_commit') or with multi producer ones ('par_ring_reserve_mp',
+ * 'par_ring_commit_mp'), consumer is single thread. Single producer ring and
+ * multi producer reservation are lock free, multi producer commit is
+ * blocking, see 'par_ring_commit_mp'.
+ *
+ * @param[out]  pRing  Pointer to ring.
+ * @param[in]   pBuf   Pointer to memory block, 'len * size' bytes.
+ * @param[in]   len    Ring length, in elements, power of 2.
+ * @param[in]   size   Element size, in bytes.
+ *
+ * @return             'true' if ring is initialised, 'false' - length is not
+ *                     power of 2.
+ ******************************************************************************/
+bool par_ring_init(par_ring_t *pRing, void *pBuf, int len, size_t size)
+{
+    CIMLIB_PROF_CALL(par_ring_init, 0);
+
+    if ((len <= 0) || ((len & (len - 1)) != 0)) {
+        return false;
+    }
+
+    pRing->pBuf = (uint8_t *)pBuf;
+    pRing->mask = (unsigned int)len - 1;
+    pRing->size = size;
+    pRing->head = 0;
+    pRing->commit = 0;
+    pRing->tail = 0;
+
+    return true;
+}
+
+
+/*******************************************************************************
+ * This function reserves free elements for single producer. Reserved
+ * elements are written through view and are passed to consumer by
+ * 'par_ring_commit' function.
+ *
+ * @param[in,out]  pRing  Pointer to ring.
+ * @param[out]     pView  Pointer to output view of reserved elements.
+ * @param[in]      len    Number of elements to reserve.
+ *
+ * @return                Number of reserved elements, less than 'len' if
+ *                        ring is full.
+ ******************************************************************************/
+int par_ring_reserve(par_ring_t *pRing, par_ring_view_t *pView, int len)
+{
+    CIMLIB_PROF_CALL(par_ring_reserve, len);
+    unsigned int head = pRing->head;
+    int lenFree = (int)(pRing->mask + 1 - (head - LOAD_ACQ(&pRing->tail)));
+
+    if (len > lenFree) {
+        len = lenFree;
+    }
+
+    pRing->head = head + (unsigned int)len;
+    par_ring_view(pRing, pView, head, len);
+
+    return len;
+}
+
+
+/*******************************************************************************
+ * This function reserves free elements for one of multiple producers.
+ * Producers reserve elements concurrently, without locks.
+ *
+ * @param[in,out]  pRing  Pointer to ring.
+ * @param[out]     pView  Pointer to output view of reserved elements.
+ * @param[in]      len    Number of elements to reserve.
+ *
+ * @return                Number of reserved elements, less than 'len' if
+ *                        ring is full.
+ ******************************************************************************/
+int par_ring_reserve_mp(par_ring_t *pRing, par_ring_view_t *pView, int len)
+{
+    CIMLIB_PROF_CALL(par_ring_reserve_mp, len);
+    int lenRsv, lenFree;
+    unsigned int head = LOAD_RLX(&pRing->head);
+
+    do {
+        lenFree = (int)(pRing->mask + 1 - (head - LOAD_ACQ(&pRing->tail)));
+        lenRsv = (len > lenFree) ? lenFree : len;
+    } while (!CAS(&pRing->head, &head, head + (unsigned int)lenRsv));
+
+    par_ring_view(pRing, pView, head, lenRsv);
+
+    return lenRsv;
+}
+
+
+/*******************************************************************************
+ * This function passes written reserved elements of single producer to
+ * consumer.
+ *
+ * @param[in,out]  pRing  Pointer to ring.
+ * @param[in]      pView  Pointer to view of reserved elements.
+ ******************************************************************************/
+void par_ring_commit(par_ring_t *pRing, const par_ring_view_t *pView)
+{
+    CIMLIB_PROF_CALL(par_ring_commit, 0);
+
+    STORE_REL(&pRing->commit,
+              pView->pos + (unsigned int)(pView->len1 + pView->len2));
+}
+
+
+/*******************************************************************************
+ * This function passes written reserved elements of one of multiple
+ * producers to consumer. Reservations are committed in reservation order,
+ * producer spins on 'sched_yield' until previous reservations are committed.
+ * So commit is blocking, not lock free: producer preempted or stopped between
+ * reserve and commit stalls commits of all later reservations.
+ *
+ * @param[in,out]  pRing  Pointer to ring.
+ * @param[in]      pView  Pointer to view of reserved elements.
+ ******************************************************************************/
+void par_ring_commit_mp(par_ring_t *pRing, const par_ring_view_t *pView)
+{
+    CIMLIB_PROF_CALL(par_ring_commit_mp, 0);
+
+    while (LOAD_ACQ(&pRing->commit) != pView->pos) {
+        (void)sched_yield();
+    }
+
+    STORE_REL(&pRing->commit,
+              pView->pos + (unsigned int)(pView->len1 + pView->len2));
+}
+
+
+/*******************************************************************************
+ * This function gets view of committed elements for consumer, without copy.
+ * View spans are contiguous and are passed directly to 'vec_*' and 'frm_*'
+ * functions.
+ *
+ * @param[in,out]  pRing  Pointer to ring.
+ * @param[out]     pView  Pointer to output view of committed elements.
+ * @param[in]      len    Maximum number of elements.
+ *
+ * @return                Number of elements in view.
+ ******************************************************************************/
+int par_ring_peek(par_ring_t *pRing, par_ring_view_t *pView, int len)
+{
+    CIMLIB_PROF_CALL(par_ring_peek, len);
+    unsigned int tail = pRing->tail;
+    int used = (int)(LOAD_ACQ(&pRing->commit) - tail);
+
+    if (len > used) {
+        len = used;
+    }
+
+    par_ring_view(pRing, pView, tail, len);
+
+    return len;
+}
+
+
+/*******************************************************************************
+ * This function releases consumed elements, their space is reused by
+ * producers.
+ *
+ * @param[in,out]  pRing  Pointer to ring.
+ * @param[in]      len    Number of consumed elements.
+ ******************************************************************************/
+void par_ring_release(par_ring_t *pRing, int len)
+{
+    CIMLIB_PROF_CALL(par_ring_release, len);
+
+    STORE_REL(&pRing->tail, pRing->tail + (unsigned int)len);
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+#include <pthread.h>
+
+/* Multi producer test parameters */
+#define NR_PRODUCERS  (3)
+#define NR_SAMPLES    (20000)
+#define RING_LEN      (64)
+
+
+/* Test ring, shared by producers */
+static par_ring_t testRing;
+
+
+/*******************************************************************************
+ * This function is test producer, it writes its index and sample counter
+ * in bulks of different length.
+ ******************************************************************************/
+static void *test_par_ring_producer(void *pArg)
+{
+    int k, n, len;
+    int32_t id = (int32_t)(intptr_t)pArg;
+    par_ring_view_t view;
+
+    for (n = 0; n < NR_SAMPLES; n += len) {
+        len = 1 + (n % 7);
+        if (len > NR_SAMPLES - n) {
+            len = NR_SAMPLES - n;
+        }
+
+        len = par_ring_reserve_mp(&testRing, &view, len);
+        if (len == 0) {
+            (void)sched_yield();
+            continue;
+        }
+
+        for (k = 0; k < len; k++) {
+            if (k < view.len1) {
+                ((int32_t *)view.pX1)[k] = (id << 24) | (n + k);
+            } else {
+                ((int32_t *)view.pX2)[k - view.len1] = (id << 24) | (n + k);
+            }
+        }
+        par_ring_commit_mp(&testRing, &view);
+    }
+
+    return NULL;
+}
+
+
+/*******************************************************************************
+ * This function tests 'par_ring_*' functions. Returns 'true' if validation
+ * is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_par_ring(void)
+{
+    int k, n, len, id, cnt;
+    int next[NR_PRODUCERS];
+    int32_t x;
+    pthread_t threads[NR_PRODUCERS];
+    par_ring_view_t view;
+    par_ring_t ring;
+    static int16_t buf[8];
+    static int32_t bufMp[RING_LEN];
+    bool flOk = true;
+
+    /* Single producer, view is split at wrap around */
+    if (par_ring_init(&ring, buf, 6, sizeof(int16_t)) ||
+        !par_ring_init(&ring, buf, 8, sizeof(int16_t))) {
+        flOk = false;
+    }
+
+    len = par_ring_reserve(&ring, &view, 5);
+    for (n = 0; n < view.len1; n++) {
+        ((int16_t *)view.pX1)[n] = 1;
+    }
+    par_ring_commit(&ring, &view);
+    len += par_ring_peek(&ring, &view, 8);
+    par_ring_release(&ring, view.len1 + view.len2);
+
+    len += par_ring_reserve(&ring, &view, 9);
+    if ((len != 18) || (view.len1 != 3) || (view.len2 != 5) ||
+        (view.pX1 != &buf[5]) || (view.pX2 != &buf[0])) {
+        flOk = false;
+    }
+
+    for (n = 0; n < view.len1; n++) {
+        ((int16_t *)view.pX1)[n] = 2;
+    }
+    for (n = 0; n < view.len2; n++) {
+        ((int16_t *)view.pX2)[n] = 3;
+    }
+    par_ring_commit(&ring, &view);
+
+    len = par_ring_peek(&ring, &view, 8);
+    if ((len != 8) || (view.len1 != 3) || (view.len2 != 5) ||
+        (vec_sum_s16((const int16_t *)view.pX1, view.len1) != 6) ||
+        (vec_sum_s16((const int16_t *)view.pX2, view.len2) != 15)) {
+        flOk = false;
+    }
+    par_ring_release(&ring, len);
+
+    /* Multi producer, consumer checks order of samples of each producer */
+    (void)par_ring_init(&testRing, bufMp, RING_LEN, sizeof(int32_t));
+    for (k = 0; k < NR_PRODUCERS; k++) {
+        next[k] = 0;
+        if (pthread_create(&threads[k], NULL, test_par_ring_producer,
+                           (void *)(intptr_t)k) != 0) {
+            return false;
+        }
+    }
+
+    for (cnt = 0; cnt < NR_PRODUCERS * NR_SAMPLES; cnt += len) {
+        len = par_ring_peek(&testRing, &view, RING_LEN);
+        for (n = 0; n < len; n++) {
+            x = (n < view.len1) ? ((int32_t *)view.pX1)[n] :
+                                  ((int32_t *)view.pX2)[n - view.len1];
+            id = x >> 24;
+            if ((id < 0) || (id >= NR_PRODUCERS) ||
+                ((x & 0xFFFFFF) != next[id])) {
+                flOk = false;
+                id = 0;
+            }
+            next[id]++;
+        }
+        par_ring_release(&testRing, len);
+
+        if (len == 0) {
+            (void)sched_yield();
+        }
+    }
+
+    for (k = 0; k < NR_PRODUCERS; k++) {
+        (void)pthread_join(threads[k], NULL);
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -0,0 +1,486 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200112L
+#include <stdlib.h>
+#include <pthread.h>
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Types
+ * ---------------------------------------------------------------------------*/
+
+/** Scheduler task, job function with its context and argument */
+typedef struct {
+    par_job_t job;                       /**< Job function */
+    void *pCtx;                          /**< Job context */
+    int arg;                             /**< Job argument */
+
+} par_task_t;
+
+
+/** Tasks deque of one thread, owner takes tasks from head, thieves from
+ *  tail. Submitted tasks are staged after tail until tick starts */
+typedef struct {
+    pthread_mutex_t mutex;               /**< Deque mutex */
+    par_task_t *pTasks;                  /**< Tasks buffer */
+    int head;                            /**< Index of the first task */
+    int tail;                            /**< Index after the last task */
+    int staged;                          /**< Index after the last submitted
+                                              task */
+
+} par_deque_t;
+
+
+/** Work stealing scheduler */
+struct par_sched_s {
+    pthread_t threads[CIMLIB_PAR_MAX_THREADS];  /**< Worker threads */
+    int nrThreads;                       /**< Number of worker threads */
+    int nrStarted;                       /**< Number of started workers */
+    par_deque_t deques[CIMLIB_PAR_MAX_THREADS]; /**< Deques, 0 is caller's */
+    int capacity;                        /**< Deque capacity, in tasks */
+    int nextDeque;                       /**< Deque of next submitted task */
+    par_task_t *pBuf;                    /**< Tasks buffer of all deques */
+    pthread_mutex_t mutex;               /**< Tick state mutex */
+    pthread_cond_t condTick;             /**< New tick or stop condition */
+    pthread_cond_t condDone;             /**< Tick done condition */
+    int nrPending;                       /**< Number of not finished tasks */
+    unsigned int tickId;                 /**< Tick counter, wakes workers */
+    bool flStop;                         /**< Stop workers flag */
+};
+
+
+/* -----------------------------------------------------------------------------
+ * Local functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function takes task from deque.
+ *
+ * @param[in,out]  pDeque   Pointer to deque.
+ * @param[out]     pTask    Pointer to output task.
+ * @param[in]      flSteal  Task is taken from tail (steal) or from head (own).
+ *
+ * @return                  'true' if task is taken, 'false' - deque is empty.
+ ******************************************************************************/
+static bool par_deque_take(par_deque_t *pDeque, par_task_t *pTask,
+                           bool flSteal)
+{
+    bool flTaken = false;
+
+    (void)pthread_mutex_lock(&pDeque->mutex);
+
+    if (pDeque->head < pDeque->tail) {
+        if (flSteal) {
+            *pTask = pDeque->pTasks[--pDeque->tail];
+        } else {
+            *pTask = pDeque->pTasks[pDeque->head++];
+        }
+        flTaken = true;
+    }
+
+    (void)pthread_mutex_unlock(&pDeque->mutex);
+
+    return flTaken;
+}
+
+
+/*******************************************************************************
+ * This function processes tasks of own deque, then steals tasks from other
+ * deques, until all deques are empty.
+ *
+ * @param[in,out]  pSched  Pointer to scheduler.
+ * @param[in]      self    Own deque index.
+ ******************************************************************************/
+static void par_sched_work(par_sched_t *pSched, int self)
+{
+    int k, nrDeques;
+    bool flTaken;
+    par_task_t task;
+
+    nrDeques = pSched->nrThreads + 1;
+
+    for (;;) {
+        flTaken = par_deque_take(&pSched->deques[self], &task, false);
+
+        /* Steal from other deques, starting from the next one */
+        for (k = 1; (!flTaken) && (k < nrDeques); k++) {
+            flTaken = par_deque_take(&pSched->deques[(self + k) % nrDeques],
+                                     &task, true);
+        }
+
+        if (!flTaken) {
+            break;
+        }
+
+        task.job(task.pCtx, task.arg);
+
+        (void)pthread_mutex_lock(&pSched->mutex);
+        if (--pSched->nrPending == 0) {
+            (void)pthread_cond_signal(&pSched->condDone);
+        }
+        (void)pthread_mutex_unlock(&pSched->mutex);
+    }
+}
+
+
+/*******************************************************************************
+ * This function is worker thread main loop, it waits for ticks and processes
+ * tasks together with caller thread.
+ *
+ * @param[in,out]  pArg  Pointer to scheduler.
+ *
+ * @return               NULL.
+ ******************************************************************************/
+static void *par_sched_worker(void *pArg)
+{
+    par_sched_t *pSched = (par_sched_t *)pArg;
+    unsigned int tickId = 0;
+    int self;
+
+    (void)pthread_mutex_lock(&pSched->mutex);
+
+    /* Own deque index */
+    self = ++pSched->nrStarted;
+
+    for (;;) {
+        while ((!pSched->flStop) && (pSched->tickId == tickId)) {
+            (void)pthread_cond_wait(&pSched->condTick, &pSched->mutex);
+        }
+
+        if (pSched->flStop) {
+            break;
+        }
+
+        tickId = pSched->tickId;
+
+        (void)pthread_mutex_unlock(&pSched->mutex);
+        par_sched_work(pSched, self);
+        (void)pthread_mutex_lock(&pSched->mutex);
+    }
+
+    (void)pthread_mutex_unlock(&pSched->mutex);
+
+    return NULL;
+}
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function creates work stealing scheduler of parallel backend. Each
+ * thread has deque of tasks, all memory is allocated here, so submission and
+ * processing of tasks do not allocate memory. Caller thread takes part in
+ * each tick, so 'nrThreads - 1' worker threads are started.
+ *
+ * @param[in]  nrThreads  Number of threads, [1..CIMLIB_PAR_MAX_THREADS].
+ * @param[in]  capacity   Deque capacity, in tasks.
+ *
+ * @return                Pointer to scheduler, NULL if there is no memory.
+ ******************************************************************************/
+par_sched_t *par_sched_create(int nrThreads, int capacity)
+{
+    CIMLIB_PROF_FUNC(par_sched_create, 0);
+    int k;
+    par_sched_t *pSched;
+
+    if (nrThreads > CIMLIB_PAR_MAX_THREADS) {
+        nrThreads = CIMLIB_PAR_MAX_THREADS;
+    }
+
+    if (nrThreads < 1) {
+        nrThreads = 1;
+    }
+
+    pSched = (par_sched_t *)malloc(sizeof(par_sched_t));
+    if (pSched == NULL) {
+        return NULL;
+    }
+
+    pSched->pBuf = (par_task_t *)malloc((size_t)nrThreads * capacity *
+                                        sizeof(par_task_t));
+    if (pSched->pBuf == NULL) {
+        free(pSched);
+        return NULL;
+    }
+
+    (void)pthread_mutex_init(&pSched->mutex, NULL);
+    (void)pthread_cond_init(&pSched->condTick, NULL);
+    (void)pthread_cond_init(&pSched->condDone, NULL);
+    pSched->capacity = capacity;
+    pSched->nextDeque = 0;
+    pSched->nrPending = 0;
+    pSched->tickId = 0;
+    pSched->flStop = false;
+
+    /* Scheduler works with less threads, if system can not start all of
+     * them */
+    pSched->nrThreads = 0;
+    pSched->nrStarted = 0;
+    for (k = 0; k < nrThreads - 1; k++) {
+        if (pthread_create(&pSched->threads[k], NULL, par_sched_worker,
+                           pSched) != 0) {
+            break;
+        }
+        pSched->nrThreads++;
+    }
+
+    /* Deques of caller and started threads, workers use them from the
+     * first tick only */
+    for (k = 0; k < pSched->nrThreads + 1; k++) {
+        (void)pthread_mutex_init(&pSched->deques[k].mutex, NULL);
+        pSched->deques[k].pTasks = &pSched->pBuf[k * capacity];
+        pSched->deques[k].head = 0;
+        pSched->deques[k].tail = 0;
+        pSched->deques[k].staged = 0;
+    }
+
+    return pSched;
+}
+
+
+/*******************************************************************************
+ * This function stops worker threads and frees scheduler.
+ *
+ * @param[in,out]  pSched  Pointer to scheduler, can be NULL.
+ ******************************************************************************/
+void par_sched_destroy(par_sched_t *pSched)
+{
+    CIMLIB_PROF_FUNC(par_sched_destroy, 0);
+    int k;
+
+    if (pSched == NULL) {
+        return;
+    }
+
+    (void)pthread_mutex_lock(&pSched->mutex);
+    pSched->flStop = true;
+    (void)pthread_cond_broadcast(&pSched->condTick);
+    (void)pthread_mutex_unlock(&pSched->mutex);
+
+    for (k = 0; k < pSched->nrThreads; k++) {
+        (void)pthread_join(pSched->threads[k], NULL);
+    }
+
+    for (k = 0; k < pSched->nrThreads + 1; k++) {
+        (void)pthread_mutex_destroy(&pSched->deques[k].mutex);
+    }
+
+    (void)pthread_cond_destroy(&pSched->condDone);
+    (void)pthread_cond_destroy(&pSched->condTick);
+    (void)pthread_mutex_destroy(&pSched->mutex);
+    free(pSched->pBuf);
+    free(pSched);
+}
+
+
+/*******************************************************************************
+ * This function submits task to the next tick. Tasks are spread over deques
+ * by turns, each thread processes its own deque in submission order and
+ * steals from tail of other deques, so heavy tasks submitted first give the
+ * shortest tick. Tasks are submitted by caller thread between ticks, they
+ * are not started before 'par_sched_wait' function call.
+ *
+ * @param[in,out]  pSched  Pointer to scheduler.
+ * @param[in]      job     Job function, kernel call.
+ * @param[in]      pCtx    Pointer to job context, kernel buffers.
+ * @param[in]      arg     Job argument, e.g. channel index.
+ *
+ * @return                 'true' if task is submitted, 'false' - all deques
+ *                         are full.
+ ******************************************************************************/
+bool par_sched_submit(par_sched_t *pSched, par_job_t job, void *pCtx, int arg)
+{
+    CIMLIB_PROF_CALL(par_sched_submit, 0);
+    int k, idx;
+    int nrDeques = pSched->nrThreads + 1;
+    par_deque_t *pDeque;
+
+    for (k = 0; k < nrDeques; k++) {
+        idx = pSched->nextDeque;
+        pSched->nextDeque = (idx + 1) % nrDeques;
+        pDeque = &pSched->deques[idx];
+
+        (void)pthread_mutex_lock(&pDeque->mutex);
+        if (pDeque->staged < pSched->capacity) {
+            pDeque->pTasks[pDeque->staged].job = job;
+            pDeque->pTasks[pDeque->staged].pCtx = pCtx;
+            pDeque->pTasks[pDeque->staged].arg = arg;
+            pDeque->staged++;
+            (void)pthread_mutex_unlock(&pDeque->mutex);
+
+            return true;
+        }
+        (void)pthread_mutex_unlock(&pDeque->mutex);
+    }
+
+    return false;
+}
+
+
+/*******************************************************************************
+ * This function runs tick, all submitted tasks are processed by worker
+ * threads and caller thread. It is completion barrier of tick, function
+ * returns when all tasks are finished.
+ *
+ * @param[in,out]  pSched  Pointer to scheduler.
+ ******************************************************************************/
+void par_sched_wait(par_sched_t *pSched)
+{
+    CIMLIB_PROF_FUNC(par_sched_wait, 0);
+    int k, nrTasks = 0;
+    int nrDeques = pSched->nrThreads + 1;
+    par_deque_t *pDeque;
+
+    /* Tasks are pending before they are visible to threads, thread of
+     * previous tick can take them at once */
+    for (k = 0; k < nrDeques; k++) {
+        nrTasks += pSched->deques[k].staged;
+    }
+
+    (void)pthread_mutex_lock(&pSched->mutex);
+    pSched->nrPending = nrTasks;
+    (void)pthread_mutex_unlock(&pSched->mutex);
+
+    for (k = 0; k < nrDeques; k++) {
+        pDeque = &pSched->deques[k];
+        (void)pthread_mutex_lock(&pDeque->mutex);
+        pDeque->tail = pDeque->staged;
+        (void)pthread_mutex_unlock(&pDeque->mutex);
+    }
+
+    (void)pthread_mutex_lock(&pSched->mutex);
+    pSched->tickId++;
+    (void)pthread_cond_broadcast(&pSched->condTick);
+    (void)pthread_mutex_unlock(&pSched->mutex);
+
+    /* Caller thread works too */
+    par_sched_work(pSched, 0);
+
+    (void)pthread_mutex_lock(&pSched->mutex);
+    while (pSched->nrPending > 0) {
+        (void)pthread_cond_wait(&pSched->condDone, &pSched->mutex);
+    }
+    pSched->nextDeque = 0;
+    (void)pthread_mutex_unlock(&pSched->mutex);
+
+    /* Empty deques are rewound, capacity is reused by next tick */
+    for (k = 0; k < nrDeques; k++) {
+        pDeque = &pSched->deques[k];
+        (void)pthread_mutex_lock(&pDeque->mutex);
+        pDeque->head = 0;
+        pDeque->tail = 0;
+        pDeque->staged = 0;
+        (void)pthread_mutex_unlock(&pDeque->mutex);
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Number of test tasks and deque capacity */
+#define NR_TASKS  (40)
+#define CAPACITY  (16)
+
+/* Maximum test vector length */
+#define MAX_LEN   (4096)
+
+
+/* Test job context */
+typedef struct {
+    int16_t x[NR_TASKS][MAX_LEN];
+    int16_t y[NR_TASKS][MAX_LEN];
+    int cnt[NR_TASKS];
+} test_ctx_t;
+
+
+/*******************************************************************************
+ * This function is test job, heterogeneous per task: sort or addition of
+ * constant to vector of task length.
+ ******************************************************************************/
+static void test_par_sched_job(void *pCtx, int arg)
+{
+    test_ctx_t *pTest = (test_ctx_t *)pCtx;
+    int len = (arg % 4 == 0) ? MAX_LEN : (arg + 1);
+
+    if (arg % 2 == 0) {
+        mem_sort_s16(pTest->y[arg], len);
+    } else {
+        vec_add_const_s16(pTest->y[arg], len, pTest->x[arg], 1);
+    }
+    pTest->cnt[arg]++;
+}
+
+
+/*******************************************************************************
+ * This function tests 'par_sched_*' functions. Returns 'true' if validation
+ * is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_par_sched(void)
+{
+    int k, n, tick, len, nrThreads;
+    par_sched_t *pSched;
+    static test_ctx_t ctx;
+    bool flOk = true;
+
+    for (nrThreads = 1; nrThreads <= 4; nrThreads += 3) {
+        pSched = par_sched_create(nrThreads, CAPACITY);
+        if (pSched == NULL) {
+            return false;
+        }
+
+        for (tick = 0; tick < 3; tick++) {
+            for (k = 0; k < NR_TASKS; k++) {
+                for (n = 0; n < MAX_LEN; n++) {
+                    ctx.x[k][n] = (int16_t)(n * 7919 + k * 31 + tick);
+                    ctx.y[k][n] = ctx.x[k][n];
+                }
+                ctx.cnt[k] = 0;
+            }
+
+            /* Tasks up to capacity of all deques are submitted */
+            for (k = 0; k < NR_TASKS; k++) {
+                if (par_sched_submit(pSched, test_par_sched_job, &ctx, k) !=
+                    (k < nrThreads * CAPACITY)) {
+                    flOk = false;
+                }
+            }
+
+            par_sched_wait(pSched);
+
+            /* Each submitted task is processed exactly once */
+            for (k = 0; k < NR_TASKS; k++) {
+                len = (k % 4 == 0) ? MAX_LEN : (k + 1);
+                if (ctx.cnt[k] != ((k < nrThreads * CAPACITY) ? 1 : 0)) {
+                    flOk = false;
+                }
+                for (n = 0; (ctx.cnt[k] == 1) && (n < len); n++) {
+                    if ((k % 2 == 0) && (n > 0) &&
+                        (ctx.y[k][n] < ctx.y[k][n - 1])) {
+                        flOk = false;
+                    }
+                    if ((k % 2 != 0) &&
+                        (ctx.y[k][n] != (int16_t)(ctx.x[k][n] + 1))) {
+                        flOk = false;
+                    }
+                }
+            }
+        }
+
+        par_sched_destroy(pSched);
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
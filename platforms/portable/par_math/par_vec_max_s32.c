@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Types
+ * ---------------------------------------------------------------------------*/
+
+/** Job context */
+typedef struct {
+    const int32_t *pX;                   /**< Input vector */
+    int len;                             /**< Vector length */
+    int chunkLen;                        /**< Chunk length */
+    int32_t max[CIMLIB_PAR_MAX_CHUNKS];  /**< Maximums of chunks */
+    int idx[CIMLIB_PAR_MAX_CHUNKS];      /**< Maximums indexes of chunks */
+
+} par_max_s32_t;
+
+
+/* -----------------------------------------------------------------------------
+ * Local functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function processes one chunk.
+ *
+ * @param[in,out]  pCtx   Pointer to job context.
+ * @param[in]      chunk  Chunk index.
+ ******************************************************************************/
+static void par_vec_max_s32_job(void *pCtx, int chunk)
+{
+    par_max_s32_t *pJob = (par_max_s32_t *)pCtx;
+    int n = chunk * pJob->chunkLen;
+    int len = pJob->len - n;
+
+    if (len > pJob->chunkLen) {
+        len = pJob->chunkLen;
+    }
+
+    pJob->max[chunk] = vec_max_s32(&pJob->idx[chunk], &pJob->pX[n], len);
+    pJob->idx[chunk] += n;
+}
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function searches maximum and it index of input vector, 32 bit
+ * signed, on thread pool. Vector is split into chunks with fixed boundaries,
+ * maximums of chunks are found by 'vec_max_s32' function and are compared
+ * in chunks order, so the first maximum index is returned as by
+ * 'vec_max_s32' for any number of threads. Vectors shorter than
+ * 'CIMLIB_PAR_MIN_LEN' are processed by caller thread.
+ *
+ * @param[in,out]  pPool    Pointer to thread pool, can be NULL.
+ * @param[out]     pIdxMax  Pointer to output maximum index.
+ * @param[in]      pX       Pointer to input vector, 32 bit signed.
+ * @param[in]      len      Vector length.
+ *
+ * @return                  Maximum, 32 bit signed.
+ ******************************************************************************/
+int32_t par_vec_max_s32(par_pool_t *pPool, int *pIdxMax, const int32_t *pX,
+                        int len)
+{
+    CIMLIB_PROF_FUNC(par_vec_max_s32, len);
+    int k, nrChunks;
+    par_max_s32_t job;
+
+    if ((pPool == NULL) || (len < CIMLIB_PAR_MIN_LEN)) {
+        return vec_max_s32(pIdxMax, pX, len);
+    }
+
+    job.pX = pX;
+    job.len = len;
+    nrChunks = par_chunks(&job.chunkLen, len, sizeof(int32_t));
+
+    par_pool_run(pPool, par_vec_max_s32_job, &job, nrChunks);
+
+    /* The first chunk with maximum */
+    *pIdxMax = job.idx[0];
+    for (k = 1; k < nrChunks; k++) {
+        if (job.max[k] > job.max[0]) {
+            job.max[0] = job.max[k];
+            *pIdxMax = job.idx[k];
+        }
+    }
+
+    return job.max[0];
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Test vector length, several chunks */
+#define LEN  (CIMLIB_PAR_MIN_LEN + 12345)
+
+
+/*******************************************************************************
+ * This function tests 'par_vec_max_s32' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_par_vec_max_s32(void)
+{
+    int n, idx1, idx4, idxRes;
+    unsigned int seed;
+    par_pool_t *pPool;
+    int32_t y1, y4, res;
+    static int32_t x[LEN];
+    bool flOk = true;
+
+    /* Pseudo random input */
+    seed = 12345u;
+    for (n = 0; n < LEN; n++) {
+        seed = seed * 1103515245u + 12345u;
+        x[n] = (int32_t)seed;
+    }
+
+    /* Maximum repeats in several chunks, the first one must be found */
+    x[LEN - 1] = INT32_MAX;
+    x[LEN / 2] = INT32_MAX;
+    x[LEN / 2 + 1] = INT32_MAX;
+
+    /* Reference, one thread */
+    res = vec_max_s32(&idxRes, x, LEN);
+
+    /* Call 'par_vec_max_s32' function, results do not depend on pool */
+    pPool = par_pool_create(1);
+    y1 = par_vec_max_s32(pPool, &idx1, x, LEN);
+    par_pool_destroy(pPool);
+
+    pPool = par_pool_create(4);
+    y4 = par_vec_max_s32(pPool, &idx4, x, LEN);
+    par_pool_destroy(pPool);
+
+    /* Check the correctness of the results */
+    if ((y1 != res) || (y4 != res) || (idx1 != idxRes) || (idx4 != idxRes) ||
+        (idxRes != LEN / 2)) {
+        flOk = false;
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Types
+ * ---------------------------------------------------------------------------*/
+
+/** Job context */
+typedef struct {
+    cint16_t *pZ;                        /**< Output vector */
+    const cint16_t *pX;                  /**< Input vector */
+    const cint16_t *pY;                  /**< Input vector */
+    int len;                             /**< Vector length */
+    int chunkLen;                        /**< Chunk length */
+    int radix;                           /**< Radix */
+
+} par_mul_c16_t;
+
+
+/* -----------------------------------------------------------------------------
+ * Local functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function processes one chunk.
+ *
+ * @param[in]  pCtx   Pointer to job context.
+ * @param[in]  chunk  Chunk index.
+ ******************************************************************************/
+static void par_vec_mul_c16_job(void *pCtx, int chunk)
+{
+    const par_mul_c16_t *pJob = (const par_mul_c16_t *)pCtx;
+    int n = chunk * pJob->chunkLen;
+    int len = pJob->len - n;
+
+    if (len > pJob->chunkLen) {
+        len = pJob->chunkLen;
+    }
+
+    vec_mul_c16(&pJob->pZ[n], len, pJob->radix, &pJob->pX[n], &pJob->pY[n]);
+}
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates by element complex multiply of input vectors,
+ * 16 bit complex, on thread pool. Vector is split into cache sized chunks,
+ * each chunk is processed by 'vec_mul_c16' function. Vectors shorter than
+ * 'CIMLIB_PAR_MIN_LEN' are processed by caller thread.
+ *
+ * @param[in,out]  pPool  Pointer to thread pool, can be NULL.
+ * @param[out]     pZ     Pointer to output vector, 16 bit complex.
+ * @param[in]      len    Vector length.
+ * @param[in]      radix  Radix.
+ * @param[in]      pX     Pointer to input vector, 16 bit complex.
+ * @param[in]      pY     Pointer to input vector, 16 bit complex.
+ ******************************************************************************/
+void par_vec_mul_c16(par_pool_t *pPool, cint16_t *pZ, int len, int radix,
+                     const cint16_t *pX, const cint16_t *pY)
+{
+    CIMLIB_PROF_FUNC(par_vec_mul_c16, len);
+    int nrChunks;
+    par_mul_c16_t job;
+
+    if ((pPool == NULL) || (len < CIMLIB_PAR_MIN_LEN)) {
+        vec_mul_c16(pZ, len, radix, pX, pY);
+        return;
+    }
+
+    job.pZ = pZ;
+    job.pX = pX;
+    job.pY = pY;
+    job.len = len;
+    job.radix = radix;
+    nrChunks = par_chunks(&job.chunkLen, len, sizeof(cint16_t));
+
+    par_pool_run(pPool, par_vec_mul_c16_job, &job, nrChunks);
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX  (14)
+
+/* Test vector length, several chunks */
+#define LEN  (CIMLIB_PAR_MIN_LEN + 12345)
+
+
+/*******************************************************************************
+ * This function tests 'par_vec_mul_c16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_par_vec_mul_c16(void)
+{
+    int n;
+    unsigned int seed;
+    par_pool_t *pPool;
+    static cint16_t x[LEN], y[LEN], z[LEN], res[LEN];
+    bool flOk = true;
+
+    /* Pseudo random input */
+    seed = 12345u;
+    for (n = 0; n < LEN; n++) {
+        seed = seed * 1103515245u + 12345u;
+        x[n].re = (int16_t)(seed >> 16);
+        seed = seed * 1103515245u + 12345u;
+        x[n].im = (int16_t)(seed >> 16);
+        seed = seed * 1103515245u + 12345u;
+        y[n].re = (int16_t)(seed >> 16);
+        seed = seed * 1103515245u + 12345u;
+        y[n].im = (int16_t)(seed >> 16);
+    }
+
+    /* Reference, one thread */
+    vec_mul_c16(res, LEN, RADIX, x, y);
+
+    /* Call 'par_vec_mul_c16' function */
+    pPool = par_pool_create(3);
+    par_vec_mul_c16(pPool, z, LEN, RADIX, x, y);
+    par_pool_destroy(pPool);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_CPLX(z, res, LEN, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
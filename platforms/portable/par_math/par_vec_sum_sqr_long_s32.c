@@ -0,0 +1,142 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Types
+ * ---------------------------------------------------------------------------*/
+
+/** Job context */
+typedef struct {
+    const int32_t *pX;                   /**< Input vector */
+    int len;                             /**< Vector length */
+    int chunkLen;                        /**< Chunk length */
+    uint64_t part[CIMLIB_PAR_MAX_CHUNKS]; /**< Partial sums of chunks */
+
+} par_sum_sqr_long_s32_t;
+
+
+/* -----------------------------------------------------------------------------
+ * Local functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function processes one chunk.
+ *
+ * @param[in,out]  pCtx   Pointer to job context.
+ * @param[in]      chunk  Chunk index.
+ ******************************************************************************/
+static void par_vec_sum_sqr_long_s32_job(void *pCtx, int chunk)
+{
+    par_sum_sqr_long_s32_t *pJob = (par_sum_sqr_long_s32_t *)pCtx;
+    int n = chunk * pJob->chunkLen;
+    int len = pJob->len - n;
+
+    if (len > pJob->chunkLen) {
+        len = pJob->chunkLen;
+    }
+
+    pJob->part[chunk] = vec_sum_sqr_long_s32(&pJob->pX[n], len);
+}
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates sum of squares of vector, 32 bit signed, on
+ * thread pool. Vector is split into chunks with fixed boundaries, partial
+ * sums of chunks are calculated by 'vec_sum_sqr_long_s32' function and are
+ * summed in chunks order, so result does not depend on number of threads.
+ * Vectors shorter than 'CIMLIB_PAR_MIN_LEN' are processed by caller thread.
+ *
+ * @param[in,out]  pPool  Pointer to thread pool, can be NULL.
+ * @param[in]      pX     Pointer to input vector, 32 bit signed.
+ * @param[in]      len    Vector length.
+ *
+ * @return                Sum of squares, 64 bit unsigned.
+ ******************************************************************************/
+uint64_t par_vec_sum_sqr_long_s32(par_pool_t *pPool, const int32_t *pX,
+                                  int len)
+{
+    CIMLIB_PROF_FUNC(par_vec_sum_sqr_long_s32, len);
+    int k, nrChunks;
+    uint64_t acc = 0;
+    par_sum_sqr_long_s32_t job;
+
+    if ((pPool == NULL) || (len < CIMLIB_PAR_MIN_LEN)) {
+        return vec_sum_sqr_long_s32(pX, len);
+    }
+
+    job.pX = pX;
+    job.len = len;
+    nrChunks = par_chunks(&job.chunkLen, len, sizeof(int32_t));
+
+    par_pool_run(pPool, par_vec_sum_sqr_long_s32_job, &job, nrChunks);
+
+    for (k = 0; k < nrChunks; k++) {
+        acc += job.part[k];
+    }
+
+    return acc;
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Test vector length, several chunks */
+#define LEN  (CIMLIB_PAR_MIN_LEN + 12345)
+
+
+/*******************************************************************************
+ * This function tests 'par_vec_sum_sqr_long_s32' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_par_vec_sum_sqr_long_s32(void)
+{
+    int n;
+    unsigned int seed;
+    par_pool_t *pPool;
+    uint64_t y1, y4, res;
+    static int32_t x[LEN];
+    bool flOk = true;
+
+    /* Pseudo random input */
+    seed = 12345u;
+    for (n = 0; n < LEN; n++) {
+        seed = seed * 1103515245u + 12345u;
+        x[n] = (int32_t)(seed >> 16);
+    }
+
+    /* Reference, one thread */
+    res = vec_sum_sqr_long_s32(x, LEN);
+
+    /* Call 'par_vec_sum_sqr_long_s32' function, results do not depend on
+     * pool */
+    pPool = par_pool_create(1);
+    y1 = par_vec_sum_sqr_long_s32(pPool, x, LEN);
+    par_pool_destroy(pPool);
+
+    pPool = par_pool_create(4);
+    y4 = par_vec_sum_sqr_long_s32(pPool, x, LEN);
+    par_pool_destroy(pPool);
+
+    /* Check the correctness of the results */
+    if ((y1 != res) || (y4 != res)) {
+        flOk = false;
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
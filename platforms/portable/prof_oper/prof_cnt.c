@@ -0,0 +1,359 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200112L
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Function name string of 'CIMLIB_PROF_FUNCS' list */
+#define PROF_NAME(NAME)  #NAME,
+
+
+#if (CIMLIB_PROFILE == 1)
+/* -----------------------------------------------------------------------------
+ * Types
+ * ---------------------------------------------------------------------------*/
+
+/** Profile counters of one thread */
+typedef struct prof_thread_s {
+    prof_cnt_t cnt[CIMLIB_PROF_NR_FUNCS];   /**< Counters, updated by owner
+                                                 thread only */
+    prof_cnt_t base[CIMLIB_PROF_NR_FUNCS];  /**< Counters at last reset */
+    prof_sat_t sat[CIMLIB_PROF_NR_FUNCS];   /**< Saturation statistics,
+                                                 owner thread only */
+    struct prof_thread_s *pNext;         /**< Next registered thread */
+
+} prof_thread_t;
+#endif /* (CIMLIB_PROFILE == 1) */
+
+
+/* -----------------------------------------------------------------------------
+ * Global variables
+ * ---------------------------------------------------------------------------*/
+
+/* Names of profiled functions */
+static const char *names[CIMLIB_PROF_NR_FUNCS] = {
+    CIMLIB_PROF_FUNCS(PROF_NAME)
+};
+
+#if (CIMLIB_PROFILE == 1)
+/* Counters and saturation statistics of calling thread */
+__thread prof_cnt_t *prof_pThreadCnt = NULL;
+__thread prof_sat_t *prof_pThreadSat = NULL;
+static __thread prof_thread_t *pThread = NULL;
+
+/* Registered threads list, counters of exited threads and sum of all
+ * counters at last reset, guarded by mutex */
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static prof_thread_t *pThreads = NULL;
+static prof_cnt_t retired[CIMLIB_PROF_NR_FUNCS];
+static prof_cnt_t base[CIMLIB_PROF_NR_FUNCS];
+
+/* Counters of threads which can not be registered, they are not reported
+ * by snapshot of all threads */
+static prof_cnt_t spare[CIMLIB_PROF_NR_FUNCS];
+static prof_sat_t spareSat[CIMLIB_PROF_NR_FUNCS];
+
+/* Thread exit key */
+static pthread_once_t keyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t key;
+static bool flKey = false;
+
+
+/* -----------------------------------------------------------------------------
+ * Local functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function adds or subtracts counters, 'pY' = 'pY' +/- 'pX'.
+ *
+ * @param[in,out]  pY     Pointer to counters.
+ * @param[in]      pX     Pointer to added counters.
+ * @param[in]      flSub  Flag, if 'true' counters are subtracted.
+ ******************************************************************************/
+static void prof_add(prof_cnt_t *pY, const prof_cnt_t *pX, bool flSub)
+{
+    int n;
+
+    for (n = 0; n < CIMLIB_PROF_NR_FUNCS; n++) {
+        if (flSub) {
+            pY[n].calls -= pX[n].calls;
+            pY[n].elems -= pX[n].elems;
+            pY[n].cycles -= pX[n].cycles;
+        } else {
+            pY[n].calls += pX[n].calls;
+            pY[n].elems += pX[n].elems;
+            pY[n].cycles += pX[n].cycles;
+        }
+    }
+}
+
+
+/*******************************************************************************
+ * This function sums counters of all threads, exited ones included. Mutex
+ * must be locked by caller.
+ *
+ * @param[out]  pCnt  Pointer to counters.
+ *
+ * @return            Number of registered threads.
+ ******************************************************************************/
+static int prof_sum(prof_cnt_t *pCnt)
+{
+    int nrThreads = 0;
+    prof_thread_t *pThr;
+
+    memcpy(pCnt, retired, sizeof(retired));
+    for (pThr = pThreads; pThr != NULL; pThr = pThr->pNext) {
+        prof_add(pCnt, pThr->cnt, false);
+        nrThreads++;
+    }
+
+    return nrThreads;
+}
+
+
+/*******************************************************************************
+ * This function is called at thread exit, counters of thread are moved to
+ * counters of exited threads.
+ *
+ * @param[in]  pArg  Pointer to counters of thread.
+ ******************************************************************************/
+static void prof_exit_thread(void *pArg)
+{
+    prof_thread_t *pThr = (prof_thread_t *)pArg;
+    prof_thread_t **ppThr;
+
+    (void)pthread_mutex_lock(&mutex);
+    prof_add(retired, pThr->cnt, false);
+    for (ppThr = &pThreads; *ppThr != NULL; ppThr = &(*ppThr)->pNext) {
+        if (*ppThr == pThr) {
+            *ppThr = pThr->pNext;
+            break;
+        }
+    }
+    (void)pthread_mutex_unlock(&mutex);
+
+    prof_pThreadCnt = NULL;
+    prof_pThreadSat = NULL;
+    pThread = NULL;
+    free(pThr);
+}
+
+
+/*******************************************************************************
+ * This function creates thread exit key, once.
+ ******************************************************************************/
+static void prof_create_key(void)
+{
+    flKey = (pthread_key_create(&key, prof_exit_thread) == 0);
+}
+#endif /* (CIMLIB_PROFILE == 1) */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function registers calling thread, it is called by instrumented
+ * functions at the first call of thread. Counters of thread are summed to
+ * counters of exited threads when thread exits.
+ *
+ * @return  Pointer to counters of calling thread, NULL - build is not
+ *          instrumented.
+ ******************************************************************************/
+prof_cnt_t *prof_register(void)
+{
+#if (CIMLIB_PROFILE == 1)
+    prof_thread_t *pThr;
+
+    (void)pthread_once(&keyOnce, prof_create_key);
+
+    pThr = (prof_thread_t *)calloc(1, sizeof(prof_thread_t));
+    if ((pThr == NULL) || !flKey ||
+        (pthread_setspecific(key, pThr) != 0)) {
+        free(pThr);
+        prof_pThreadCnt = spare;
+        prof_pThreadSat = spareSat;
+        return spare;
+    }
+
+    (void)pthread_mutex_lock(&mutex);
+    pThr->pNext = pThreads;
+    pThreads = pThr;
+    (void)pthread_mutex_unlock(&mutex);
+
+    pThread = pThr;
+    prof_pThreadCnt = pThr->cnt;
+    prof_pThreadSat = pThr->sat;
+
+    return pThr->cnt;
+#else
+    return NULL;
+#endif
+}
+
+
+/*******************************************************************************
+ * This function resets profile counters of all threads. Counters are not
+ * cleared, they are saved as base of next snapshots, so counters of other
+ * threads are written by their owners only.
+ ******************************************************************************/
+void prof_reset(void)
+{
+#if (CIMLIB_PROFILE == 1)
+    prof_thread_t *pThr;
+
+    (void)pthread_mutex_lock(&mutex);
+    (void)prof_sum(base);
+    for (pThr = pThreads; pThr != NULL; pThr = pThr->pNext) {
+        memcpy(pThr->base, pThr->cnt, sizeof(pThr->cnt));
+    }
+    (void)pthread_mutex_unlock(&mutex);
+#endif
+}
+
+
+/*******************************************************************************
+ * This function takes snapshot of profile counters since last reset, of all
+ * threads or of calling thread. Counters of other threads are read while
+ * they run, so snapshot is not atomic.
+ *
+ * @param[out]  pSnap         Pointer to snapshot.
+ * @param[in]   flAllThreads  Flag, if 'true' counters of all threads are
+ *                            summed, exited ones included, otherwise
+ *                            counters of calling thread are taken.
+ *
+ * @return                    'true' if build is instrumented, 'false' -
+ *                            otherwise, snapshot is empty.
+ ******************************************************************************/
+bool prof_snapshot(prof_snap_t *pSnap, bool flAllThreads)
+{
+    memset(pSnap, 0, sizeof(prof_snap_t));
+
+#if (CIMLIB_PROFILE == 1)
+    (void)pthread_mutex_lock(&mutex);
+    if (flAllThreads) {
+        pSnap->nrThreads = prof_sum(pSnap->cnt);
+        prof_add(pSnap->cnt, base, true);
+    } else if (pThread != NULL) {
+        pSnap->nrThreads = 1;
+        memcpy(pSnap->cnt, pThread->cnt, sizeof(pSnap->cnt));
+        prof_add(pSnap->cnt, pThread->base, true);
+    }
+    (void)pthread_mutex_unlock(&mutex);
+
+    return true;
+#else
+    (void)flAllThreads;
+
+    return false;
+#endif
+}
+
+
+/*******************************************************************************
+ * This function returns name of profiled function.
+ *
+ * @param[in]  id  Function identifier, 'CIMLIB_PROF_ID(NAME)'.
+ *
+ * @return         Function name, NULL - identifier is not valid.
+ ******************************************************************************/
+const char *prof_name(int id)
+{
+    if ((id < 0) || (id >= CIMLIB_PROF_NR_FUNCS)) {
+        return NULL;
+    }
+
+    return names[id];
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/*******************************************************************************
+ * This function is thread of profile counters test, it calls profiled
+ * function once.
+ ******************************************************************************/
+static void *test_prof_cnt_thread(void *pArg)
+{
+    int16_t z[4];
+    const int16_t *pX = (const int16_t *)pArg;
+
+    vec_add_s16(z, 4, pX, pX);
+
+    return NULL;
+}
+
+
+/*******************************************************************************
+ * This function tests profile counters functions. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_prof_cnt(void)
+{
+    int16_t z[4];
+    static const int16_t x[4] = {1, 2, 3, 4};
+    static prof_snap_t snap, snapAll;
+    pthread_t thread;
+    bool flProf;
+    bool flOk = true;
+    const int idAdd = CIMLIB_PROF_ID(vec_add_s16);
+    const int idSc = CIMLIB_PROF_ID(sc_add_sat_s16);
+
+    /* Call profiled functions by this and other thread */
+    prof_reset();
+    vec_add_s16(z, 4, x, x);
+    vec_add_s16(z, 4, x, x);
+    (void)sc_add_sat_s16(x[0], x[1]);
+    if (pthread_create(&thread, NULL, test_prof_cnt_thread,
+                       (void *)x) != 0) {
+        return false;
+    }
+    (void)pthread_join(thread, NULL);
+
+    flProf = prof_snapshot(&snap, false);
+    (void)prof_snapshot(&snapAll, true);
+
+    /* Check the correctness of the result */
+#if (CIMLIB_PROFILE == 1)
+    flOk = flOk && flProf && (snap.nrThreads == 1);
+    flOk = flOk && (snap.cnt[idAdd].calls == 2) &&
+           (snap.cnt[idAdd].elems == 8) && (snap.cnt[idSc].calls == 1) &&
+           (snap.cnt[idSc].elems == 1);
+    flOk = flOk && (snapAll.cnt[idAdd].calls == 3) &&
+           (snapAll.cnt[idAdd].elems == 12);
+
+    prof_reset();
+    (void)prof_snapshot(&snap, false);
+    (void)prof_snapshot(&snapAll, true);
+    flOk = flOk && (snap.cnt[idAdd].calls == 0) &&
+           (snapAll.cnt[idAdd].calls == 0);
+#else
+    flOk = flOk && !flProf && (snap.cnt[idAdd].calls == 0) &&
+           (snapAll.nrThreads == 0);
+    (void)idSc;
+#endif
+
+    flOk = flOk && (strcmp(prof_name(idAdd), "vec_add_s16") == 0) &&
+           (prof_name(-1) == NULL) &&
+           (prof_name(CIMLIB_PROF_NR_FUNCS) == NULL);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -0,0 +1,298 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <inttypes.h>
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Types
+ * ---------------------------------------------------------------------------*/
+
+/** Dump output buffer */
+typedef struct {
+    char *pBuf;                          /**< Buffer */
+    size_t size;                         /**< Buffer size, in bytes */
+    size_t len;                          /**< Dump length, it can exceed
+                                              buffer size */
+
+} prof_out_t;
+
+
+/* -----------------------------------------------------------------------------
+ * Local functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function appends formatted string to dump, output is truncated to
+ * buffer size, length is counted in full.
+ ******************************************************************************/
+static void prof_printf(prof_out_t *pOut, const char *pFmt, ...)
+{
+    int len;
+    va_list args;
+
+    va_start(args, pFmt);
+    len = vsnprintf((pOut->len < pOut->size) ? pOut->pBuf + pOut->len : NULL,
+                    (pOut->len < pOut->size) ? pOut->size - pOut->len : 0,
+                    pFmt, args);
+    va_end(args);
+
+    pOut->len += (len > 0) ? (size_t)len : 0;
+}
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function dumps profile snapshot as text table or JSON object. Only
+ * called functions are dumped, they are sorted by cycles, so dominating
+ * functions are the first ones.
+ *
+ * @param[out]  pBuf    Pointer to output buffer, output is null terminated
+ *                      and truncated to buffer size.
+ * @param[in]   size    Output buffer size, in bytes.
+ * @param[in]   pSnap   Pointer to snapshot.
+ * @param[in]   format  Dump format, 'CIMLIB_PROF_TEXT' or 'CIMLIB_PROF_JSON'.
+ *
+ * @return              Dump length, without null terminator. If it is not
+ *                      less than buffer size, output is truncated.
+ ******************************************************************************/
+int prof_dump(char *pBuf, size_t size, const prof_snap_t *pSnap,
+              unsigned int format)
+{
+    int n, k, nrIds = 0;
+    int ids[CIMLIB_PROF_NR_FUNCS];
+    const prof_cnt_t *pCnt;
+    prof_out_t out;
+
+    out.pBuf = pBuf;
+    out.size = size;
+    out.len = 0;
+    if (size > 0) {
+        pBuf[0] = '\0';
+    }
+
+    /* Sort called functions by cycles, then by calls, insertion sort */
+    for (n = 0; n < CIMLIB_PROF_NR_FUNCS; n++) {
+        pCnt = &pSnap->cnt[n];
+        if (pCnt->calls == 0) {
+            continue;
+        }
+        for (k = nrIds; k > 0; k--) {
+            if ((pSnap->cnt[ids[k - 1]].cycles > pCnt->cycles) ||
+                ((pSnap->cnt[ids[k - 1]].cycles == pCnt->cycles) &&
+                 (pSnap->cnt[ids[k - 1]].calls >= pCnt->calls))) {
+                break;
+            }
+            ids[k] = ids[k - 1];
+        }
+        ids[k] = n;
+        nrIds++;
+    }
+
+    if (format == CIMLIB_PROF_JSON) {
+        prof_printf(&out, "{\"threads\": %d, \"functions\": [",
+                    pSnap->nrThreads);
+        for (k = 0; k < nrIds; k++) {
+            pCnt = &pSnap->cnt[ids[k]];
+            prof_printf(&out, "%s\n  {\"name\": \"%s\", \"calls\": %" PRIu64
+                        ", \"elems\": %" PRIu64 ", \"cycles\": %" PRIu64 "}",
+                        (k == 0) ? "" : ",", prof_name(ids[k]), pCnt->calls,
+                        pCnt->elems, pCnt->cycles);
+        }
+        prof_printf(&out, "\n]}\n");
+    } else {
+        prof_printf(&out, "Profile of %d threads:\n", pSnap->nrThreads);
+        prof_printf(&out, "  %-28s %12s %14s %16s %10s %9s\n", "function",
+                    "calls", "elements", "cycles", "cyc/call", "cyc/elem");
+        for (k = 0; k < nrIds; k++) {
+            pCnt = &pSnap->cnt[ids[k]];
+            prof_printf(&out, "  %-28s %12" PRIu64 " %14" PRIu64 " %16"
+                        PRIu64 " %10.1f", prof_name(ids[k]), pCnt->calls,
+                        pCnt->elems, pCnt->cycles,
+                        (double)pCnt->cycles / (double)pCnt->calls);
+            if (pCnt->elems != 0) {
+                prof_printf(&out, " %9.2f\n",
+                            (double)pCnt->cycles / (double)pCnt->elems);
+            } else {
+                prof_printf(&out, " %9s\n", "-");
+            }
+        }
+    }
+
+    return (int)out.len;
+}
+
+
+/*******************************************************************************
+ * This function dumps saturation statistics as text table or JSON object.
+ * Only functions with saturated values are dumped, they are sorted by clips,
+ * so functions which need lower radix are the first ones. Observed range and
+ * headroom are dumped if range is tracked.
+ *
+ * @param[out]  pBuf    Pointer to output buffer, output is null terminated
+ *                      and truncated to buffer size.
+ * @param[in]   size    Output buffer size, in bytes.
+ * @param[in]   pSat    Pointer to saturation statistics,
+ *                      'CIMLIB_PROF_NR_FUNCS' entries.
+ * @param[in]   format  Dump format, 'CIMLIB_PROF_TEXT' or 'CIMLIB_PROF_JSON'.
+ *
+ * @return              Dump length, without null terminator. If it is not
+ *                      less than buffer size, output is truncated.
+ ******************************************************************************/
+int prof_sat_dump(char *pBuf, size_t size, const prof_sat_t *pSat,
+                  unsigned int format)
+{
+    int n, k, nrIds = 0;
+    int ids[CIMLIB_PROF_NR_FUNCS];
+    const prof_sat_t *pS;
+    prof_out_t out;
+
+    out.pBuf = pBuf;
+    out.size = size;
+    out.len = 0;
+    if (size > 0) {
+        pBuf[0] = '\0';
+    }
+
+    /* Sort saturating functions by clips, then by saturations */
+    for (n = 0; n < CIMLIB_PROF_NR_FUNCS; n++) {
+        pS = &pSat[n];
+        if (pS->sats == 0) {
+            continue;
+        }
+        for (k = nrIds; k > 0; k--) {
+            if ((pSat[ids[k - 1]].clips > pS->clips) ||
+                ((pSat[ids[k - 1]].clips == pS->clips) &&
+                 (pSat[ids[k - 1]].sats >= pS->sats))) {
+                break;
+            }
+            ids[k] = ids[k - 1];
+        }
+        ids[k] = n;
+        nrIds++;
+    }
+
+    if (format == CIMLIB_PROF_JSON) {
+        prof_printf(&out, "{\"functions\": [");
+        for (k = 0; k < nrIds; k++) {
+            pS = &pSat[ids[k]];
+            prof_printf(&out, "%s\n  {\"name\": \"%s\", \"sats\": %" PRIu64
+                        ", \"clips\": %" PRIu64, (k == 0) ? "" : ",",
+                        prof_name(ids[k]), pS->sats, pS->clips);
+            if (pS->lim > 0) {
+                prof_printf(&out, ", \"min\": %" PRId64 ", \"max\": %"
+                            PRId64 ", \"headroom\": %d", pS->min, pS->max,
+                            prof_sat_headroom(pS));
+            }
+            prof_printf(&out, "}");
+        }
+        prof_printf(&out, "\n]}\n");
+    } else {
+        prof_printf(&out, "Saturation statistics:\n");
+        prof_printf(&out, "  %-28s %14s %14s %8s %14s %14s %8s\n",
+                    "function", "saturations", "clips", "clips,%", "min",
+                    "max", "headroom");
+        for (k = 0; k < nrIds; k++) {
+            pS = &pSat[ids[k]];
+            prof_printf(&out, "  %-28s %14" PRIu64 " %14" PRIu64 " %8.3f",
+                        prof_name(ids[k]), pS->sats, pS->clips,
+                        100.0 * (double)pS->clips / (double)pS->sats);
+            if (pS->lim > 0) {
+                prof_printf(&out, " %14" PRId64 " %14" PRId64 " %8d\n",
+                            pS->min, pS->max, prof_sat_headroom(pS));
+            } else {
+                prof_printf(&out, " %14s %14s %8s\n", "-", "-", "-");
+            }
+        }
+    }
+
+    return (int)out.len;
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/*******************************************************************************
+ * This function tests 'prof_dump' and 'prof_sat_dump' functions. Returns
+ * 'true' if validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_prof_dump(void)
+{
+    int len;
+    char buf[512];
+    static prof_snap_t snap;
+    static prof_sat_t sat[CIMLIB_PROF_NR_FUNCS];
+    static const char res[] =
+        "{\"threads\": 2, \"functions\": [\n"
+        "  {\"name\": \"frm_ema_s16\", \"calls\": 3, \"elems\": 30, "
+        "\"cycles\": 900},\n"
+        "  {\"name\": \"vec_add_s16\", \"calls\": 2, \"elems\": 8, "
+        "\"cycles\": 100}\n"
+        "]}\n";
+    static const char resSat[] =
+        "{\"functions\": [\n"
+        "  {\"name\": \"vec_add_sat_s16\", \"sats\": 8, \"clips\": 2, "
+        "\"min\": -40000, \"max\": 100, \"headroom\": -1},\n"
+        "  {\"name\": \"sc_add_sat_s16\", \"sats\": 3, \"clips\": 0}\n"
+        "]}\n";
+    bool flOk = true;
+
+    memset(&snap, 0, sizeof(snap));
+    snap.nrThreads = 2;
+    snap.cnt[CIMLIB_PROF_ID(vec_add_s16)].calls = 2;
+    snap.cnt[CIMLIB_PROF_ID(vec_add_s16)].elems = 8;
+    snap.cnt[CIMLIB_PROF_ID(vec_add_s16)].cycles = 100;
+    snap.cnt[CIMLIB_PROF_ID(frm_ema_s16)].calls = 3;
+    snap.cnt[CIMLIB_PROF_ID(frm_ema_s16)].elems = 30;
+    snap.cnt[CIMLIB_PROF_ID(frm_ema_s16)].cycles = 900;
+
+    /* Call 'prof_dump' function */
+    len = prof_dump(buf, sizeof(buf), &snap, CIMLIB_PROF_JSON);
+
+    /* Check the correctness of the result */
+    flOk = flOk && (len == (int)strlen(res)) && (strcmp(buf, res) == 0);
+
+    /* Text table, sorted by cycles */
+    len = prof_dump(buf, sizeof(buf), &snap, CIMLIB_PROF_TEXT);
+    flOk = flOk && (len == (int)strlen(buf)) &&
+           (strstr(buf, "frm_ema_s16") != NULL) &&
+           (strstr(buf, "frm_ema_s16") < strstr(buf, "vec_add_s16"));
+
+    /* Truncated output, length is counted in full */
+    flOk = flOk && (prof_dump(buf, 8, &snap, CIMLIB_PROF_JSON) ==
+                    (int)strlen(res)) && (strlen(buf) == 7);
+
+    /* Saturation statistics, sorted by clips */
+    memset(sat, 0, sizeof(sat));
+    sat[CIMLIB_PROF_ID(sc_add_sat_s16)].sats = 3;
+    sat[CIMLIB_PROF_ID(vec_add_sat_s16)].sats = 8;
+    sat[CIMLIB_PROF_ID(vec_add_sat_s16)].clips = 2;
+    sat[CIMLIB_PROF_ID(vec_add_sat_s16)].min = -40000;
+    sat[CIMLIB_PROF_ID(vec_add_sat_s16)].max = 100;
+    sat[CIMLIB_PROF_ID(vec_add_sat_s16)].lim = INT16_MAX;
+    len = prof_sat_dump(buf, sizeof(buf), sat, CIMLIB_PROF_JSON);
+    flOk = flOk && (len == (int)strlen(resSat)) && (strcmp(buf, resSat) == 0);
+
+    len = prof_sat_dump(buf, sizeof(buf), sat, CIMLIB_PROF_TEXT);
+    flOk = flOk && (len == (int)strlen(buf)) &&
+           (strstr(buf, "vec_add_sat_s16") != NULL) &&
+           (strstr(buf, "vec_add_sat_s16") < strstr(buf, "sc_add_sat_s16"));
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -0,0 +1,207 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include <string.h>
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Local functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates number of bits of unsigned value, e.g. 15 for
+ * [0..32767] range.
+ *
+ * @param[in]  x  Value.
+ *
+ * @return        Number of bits.
+ ******************************************************************************/
+static int prof_bits(uint64_t x)
+{
+    int bits = 0;
+
+    while (x != 0) {
+        x >>= 1;
+        bits++;
+    }
+
+    return bits;
+}
+
+
+/*******************************************************************************
+ * This function calculates number of bits of integer part of signed value,
+ * sign bit excluded, e.g. 15 for [-32768..32767] range.
+ *
+ * @param[in]  x  Value.
+ *
+ * @return        Number of bits.
+ ******************************************************************************/
+static int prof_bits_s64(int64_t x)
+{
+    return prof_bits((x < 0) ? ~(uint64_t)x : (uint64_t)x);
+}
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function takes saturation statistics of calling thread since last
+ * saturation reset, for each profiled function. Statistics are counted by
+ * 'CIMLIB_SAT_*' macros of function body, nested profiled functions count
+ * their own ones.
+ *
+ * @param[out]  pSat  Pointer to saturation statistics, 'CIMLIB_PROF_NR_FUNCS'
+ *                    entries indexed by 'CIMLIB_PROF_ID(NAME)'.
+ *
+ * @return            'true' if build is instrumented, 'false' - otherwise,
+ *                    statistics are empty.
+ ******************************************************************************/
+bool prof_sat_snapshot(prof_sat_t *pSat)
+{
+    memset(pSat, 0, CIMLIB_PROF_NR_FUNCS * sizeof(prof_sat_t));
+
+#if (CIMLIB_PROFILE == 1)
+    if (prof_pThreadSat != NULL) {
+        memcpy(pSat, prof_pThreadSat,
+               CIMLIB_PROF_NR_FUNCS * sizeof(prof_sat_t));
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+/*******************************************************************************
+ * This function resets saturation statistics of calling thread.
+ ******************************************************************************/
+void prof_sat_reset(void)
+{
+#if (CIMLIB_PROFILE == 1)
+    if (prof_pThreadSat != NULL) {
+        memset(prof_pThreadSat, 0,
+               CIMLIB_PROF_NR_FUNCS * sizeof(prof_sat_t));
+    }
+#endif
+}
+
+
+/*******************************************************************************
+ * This function calculates headroom of function output, number of bits by
+ * which observed range can grow before clipping at saturation limit.
+ * Negative headroom is number of bits of observed overflow, radix must be
+ * lowered by them to avoid clipping. It is negative if function clips, value
+ * counted as 'INT64_MAX' can be wider than it.
+ *
+ * @param[in]  pSat  Pointer to saturation statistics of function.
+ *
+ * @return           Headroom, in bits, 0 - range is not tracked or there
+ *                   are no saturated values.
+ ******************************************************************************/
+int prof_sat_headroom(const prof_sat_t *pSat)
+{
+    int bitsMin, bitsMax, headroom;
+
+    if ((pSat->sats == 0) || (pSat->lim == 0)) {
+        return 0;
+    }
+
+    bitsMin = prof_bits_s64(pSat->min);
+    bitsMax = prof_bits_s64(pSat->max);
+    headroom = prof_bits(pSat->lim) - ((bitsMin > bitsMax) ? bitsMin : bitsMax);
+
+    return ((pSat->clips != 0) && (headroom >= 0)) ? -1 : headroom;
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/*******************************************************************************
+ * This function tests saturation statistics functions. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_prof_sat(void)
+{
+    int16_t z[4];
+    uint64_t z64[2];
+    static const int16_t x[4] = {30000, -30000, 100, -5};
+    static const int16_t y[4] = {10000, -10000, 0, 0};
+    static const int64_t x64[2] = {INT64_C(4294967295), INT64_C(4294967296)};
+    static prof_sat_t sat[CIMLIB_PROF_NR_FUNCS];
+    prof_sat_t one;
+    bool flProf;
+    bool flOk = true;
+    const int idAdd = CIMLIB_PROF_ID(vec_add_sat_s16);
+    const int idSc = CIMLIB_PROF_ID(sc_add_sat_s16);
+    const int idSqr = CIMLIB_PROF_ID(vec_sqr_sat_s64);
+
+    /* Saturate by vector and scalar function, 2 + 1 clips */
+    vec_add_sat_s16(z, 4, x, y);
+    prof_sat_reset();
+    vec_add_sat_s16(z, 4, x, y);
+    (void)sc_add_sat_s16(x[0], y[0]);
+    (void)sc_add_sat_s16(x[2], y[2]);
+
+    /* Squares 2^64 - 2^33 + 1 and 2^64, the last one is clipped */
+    vec_sqr_sat_s64(z64, 2, 0, x64);
+
+    flProf = prof_sat_snapshot(sat);
+
+    /* Check the correctness of the result */
+#if (CIMLIB_PROFILE == 1)
+    flOk = flOk && flProf && (sat[idAdd].sats == 4) &&
+           (sat[idAdd].clips == 2) && (sat[idSc].sats == 2) &&
+           (sat[idSc].clips == 1) && (sat[idSqr].sats == 2) &&
+           (sat[idSqr].clips == 1);
+#if (CIMLIB_PROFILE_RANGE == 1)
+    flOk = flOk && (sat[idAdd].min == -40000) &&
+           (sat[idAdd].max == 40000) && (sat[idAdd].lim == INT16_MAX) &&
+           (prof_sat_headroom(&sat[idAdd]) == -1) &&
+           (sat[idSqr].max == INT64_MAX) && (sat[idSqr].lim == UINT64_MAX) &&
+           (prof_sat_headroom(&sat[idSqr]) == -1);
+#endif
+
+    prof_sat_reset();
+    (void)prof_sat_snapshot(sat);
+    flOk = flOk && (sat[idAdd].sats == 0) && (sat[idSc].clips == 0);
+#else
+    flOk = flOk && !flProf && (sat[idAdd].sats == 0) &&
+           (sat[idSc].clips == 0) && (sat[idSqr].clips == 0);
+#endif
+
+    /* Headroom of observed range */
+    memset(&one, 0, sizeof(one));
+    one.sats = 1;
+    one.min = -100;
+    one.max = 1000;
+    one.lim = INT16_MAX;
+    flOk = flOk && (prof_sat_headroom(&one) == 5);
+    one.min = -32769;
+    flOk = flOk && (prof_sat_headroom(&one) == -1);
+
+    /* Exact near 64 bit limits, value wider than it is clipped */
+    one.min = INT64_MIN;
+    one.max = INT64_MAX;
+    one.lim = UINT64_MAX;
+    flOk = flOk && (prof_sat_headroom(&one) == 1);
+    one.clips = 1;
+    flOk = flOk && (prof_sat_headroom(&one) == -1);
+    one.lim = 0;
+    flOk = flOk && (prof_sat_headroom(&one) == 0);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
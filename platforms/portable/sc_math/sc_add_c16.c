@@ -25,6 +25,7 @@
  ******************************************************************************/
 cint16_t sc_add_c16(cint16_t x, cint16_t y)
 {
+    CIMLIB_PROF_CALL(sc_add_c16, 1);
     cint16_t z;
 
     z.re = x.re + y.re;
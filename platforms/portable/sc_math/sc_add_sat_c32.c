@@ -26,6 +26,7 @@
  ******************************************************************************/
 cint32_t sc_add_sat_c32(cint32_t x, cint32_t y)
 {
+    CIMLIB_PROF_CALL(sc_add_sat_c32, 1);
     cint32_t z;
     int64_t re, im;
 
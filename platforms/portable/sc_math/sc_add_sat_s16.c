@@ -26,6 +26,7 @@
  ******************************************************************************/
 int16_t sc_add_sat_s16(int16_t x, int16_t y)
 {
+    CIMLIB_PROF_CALL(sc_add_sat_s16, 1);
     int16_t z;
     int32_t tmp;
 
@@ -26,6 +26,7 @@
  ******************************************************************************/
 int32_t sc_add_sat_s32(int32_t x, int32_t y)
 {
+    CIMLIB_PROF_CALL(sc_add_sat_s32, 1);
     int32_t z;
     int64_t tmp;
 
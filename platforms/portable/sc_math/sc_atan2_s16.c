@@ -42,6 +42,7 @@
  ******************************************************************************/
 int16_t sc_atan2_s16(int16_t y, int16_t x, int radix)
 {
+    CIMLIB_PROF_CALL(sc_atan2_s16, 1);
     int16_t tmp, c28_m_pi, one;
     int16_t arctantent = 0;
 
@@ -42,6 +42,7 @@
  ******************************************************************************/
 int32_t sc_atan2_s32(int32_t y, int32_t x, int radix)
 {
+    CIMLIB_PROF_CALL(sc_atan2_s32, 1);
     int32_t tmp, c28_m_pi, one;
     int32_t arctantent = 0;
 
@@ -26,6 +26,7 @@
  ******************************************************************************/
 int16_t sc_cos_s16(int16_t x, int radix)
 {
+    CIMLIB_PROF_CALL(sc_cos_s16, 1);
     int16_t cosine;
 
     /* Calculate cosine as cos = sin(x + pi / 2) */
@@ -26,6 +26,7 @@
  ******************************************************************************/
 int32_t sc_cos_s32(int32_t x, int radix)
 {
+    CIMLIB_PROF_CALL(sc_cos_s32, 1);
     int32_t cosine;
 
     /* Calculate cosine as cos = sin(x + pi / 2) */
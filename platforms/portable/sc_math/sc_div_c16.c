@@ -26,6 +26,7 @@
  ******************************************************************************/
 cint16_t sc_div_c16(cint16_t x, cint16_t y, int radix)
 {
+    CIMLIB_PROF_CALL(sc_div_c16, 1);
     cint16_t z;
     int32_t y2;
 
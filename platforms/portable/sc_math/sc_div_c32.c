@@ -26,6 +26,7 @@
  ******************************************************************************/
 cint32_t sc_div_c32(cint32_t x, cint32_t y, int radix)
 {
+    CIMLIB_PROF_CALL(sc_div_c32, 1);
     cint32_t z;
     int32_t y2;
 
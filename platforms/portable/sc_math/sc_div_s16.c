@@ -26,6 +26,8 @@
  ******************************************************************************/
 int16_t sc_div_s16(int16_t x, int16_t y, int radix)
 {
+    CIMLIB_PROF_CALL(sc_div_s16, 1);
+
     x = (int16_t)(((int32_t)x * (1 << radix)) / y);
 
     return x;
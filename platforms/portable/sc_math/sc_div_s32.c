@@ -26,6 +26,8 @@
  ******************************************************************************/
 int32_t sc_div_s32(int32_t x, int32_t y, int radix)
 {
+    CIMLIB_PROF_CALL(sc_div_s32, 1);
+
     x = (int32_t)(((int64_t)x * (1 << radix)) / y);
 
     return x;
@@ -29,6 +29,7 @@
  ******************************************************************************/
 int16_t sc_ema_s16(int16_t acc, int16_t x, int16_t alpha, int radix)
 {
+    CIMLIB_PROF_CALL(sc_ema_s16, 1);
     int32_t tmp;
     int16_t rnd = 0;
 
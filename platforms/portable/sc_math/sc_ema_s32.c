@@ -29,6 +29,7 @@
  ******************************************************************************/
 int32_t sc_ema_s32(int32_t acc, int32_t x, int32_t alpha, int radix)
 {
+    CIMLIB_PROF_CALL(sc_ema_s32, 1);
     int64_t tmp;
     int32_t rnd = 0;
 
@@ -26,6 +26,7 @@
  ******************************************************************************/
 int16_t sc_log10_u16(uint16_t x, int radix)
 {
+    CIMLIB_PROF_CALL(sc_log10_u16, 1);
     int16_t y;
 
     /* Calculate logarithm by base 2 */
@@ -26,6 +26,7 @@
  ******************************************************************************/
 int32_t sc_log10_u32(uint32_t x, int radix)
 {
+    CIMLIB_PROF_CALL(sc_log10_u32, 1);
     int32_t y;
 
     /* Calculate logarithm by base 2 */
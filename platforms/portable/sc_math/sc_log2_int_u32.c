@@ -9,6 +9,7 @@
  * Includes
  * ---------------------------------------------------------------------------*/
 #include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
 
 
 /* -----------------------------------------------------------------------------
@@ -26,21 +27,9 @@
  ******************************************************************************/
 int sc_log2_int_u32(uint32_t x)
 {
-    int result;
-    static const int tableLog2[32] = {
-        0,  9,  1, 10, 13, 21,  2, 29, 11, 14, 16, 18, 22, 25, 3, 30,
-        8, 12, 20, 28, 15, 17, 24,  7, 19, 27, 23,  6, 26,  5, 4, 31
-    };
+    CIMLIB_PROF_CALL(sc_log2_int_u32, 1);
 
-    x |= x >> 1;
-    x |= x >> 2;
-    x |= x >> 4;
-    x |= x >> 8;
-    x |= x >> 16;
-
-    result = tableLog2[(uint32_t)(x * 0x07C4ACDD) >> 27];
-
-    return result;
+    return sc_log2_int_u32_core(x);
 }
 
 
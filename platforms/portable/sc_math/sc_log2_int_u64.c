@@ -9,6 +9,7 @@
  * Includes
  * ---------------------------------------------------------------------------*/
 #include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
 
 
 /* -----------------------------------------------------------------------------
@@ -26,30 +27,9 @@
  ******************************************************************************/
 int sc_log2_int_u64(uint64_t x)
 {
-    int result;
-    uint32_t y;
-    static const uint8_t tableLog2[32] = {
-        0,  9,  1, 10, 13, 21,  2, 29, 11, 14, 16, 18, 22, 25, 3, 30,
-        8, 12, 20, 28, 15, 17, 24,  7, 19, 27, 23,  6, 26,  5, 4, 31
-    };
-
-    /* Check high word */
-    result = 32;
-    y = (uint32_t)(x >> 32);
-    if (y == 0) {
-        result = 0;
-        y = (uint32_t)x;
-    }
-
-    /* Check low word */
-    y |= y >> 1;
-    y |= y >> 2;
-    y |= y >> 4;
-    y |= y >> 8;
-    y |= y >> 16;
-    result += tableLog2[(uint32_t)(y * 0x07C4ACDD) >> 27];
+    CIMLIB_PROF_CALL(sc_log2_int_u64, 1);
 
-    return result;
+    return sc_log2_int_u64_core(x);
 }
 
 
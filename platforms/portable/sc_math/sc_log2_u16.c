@@ -29,6 +29,7 @@
  ******************************************************************************/
 int16_t sc_log2_u16(uint16_t x, int radix)
 {
+    CIMLIB_PROF_CALL(sc_log2_u16, 1);
     int n;
     int16_t y = 0;
     int16_t b = (1 << (radix - 1));
@@ -29,6 +29,7 @@
  ******************************************************************************/
 int32_t sc_log2_u32(uint32_t x, int radix)
 {
+    CIMLIB_PROF_CALL(sc_log2_u32, 1);
     int n;
     int32_t y = 0;
     int32_t b = (1 << (radix - 1));
@@ -28,6 +28,7 @@
  ******************************************************************************/
 cint32_t sc_mac_c32(cint32_t x, cint32_t y, cint32_t acc, int radix)
 {
+    CIMLIB_PROF_CALL(sc_mac_c32, 1);
     int64_t re, im;
 
     re = (int64_t)x.re * y.re - (int64_t)x.im * y.im;
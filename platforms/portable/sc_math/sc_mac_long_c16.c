@@ -27,6 +27,8 @@
  ******************************************************************************/
 cint32_t sc_mac_long_c16(cint16_t x, cint16_t y, cint32_t acc)
 {
+    CIMLIB_PROF_CALL(sc_mac_long_c16, 1);
+
     acc.re += (int32_t)x.re * y.re - (int32_t)x.im * y.im;
     acc.im += (int32_t)x.im * y.re + (int32_t)x.re * y.im;
 
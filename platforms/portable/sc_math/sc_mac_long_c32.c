@@ -27,6 +27,8 @@
  ******************************************************************************/
 cint64_t sc_mac_long_c32(cint32_t x, cint32_t y, cint64_t acc)
 {
+    CIMLIB_PROF_CALL(sc_mac_long_c32, 1);
+
     acc.re += (int64_t)x.re * y.re - (int64_t)x.im * y.im;
     acc.im += (int64_t)x.im * y.re + (int64_t)x.re * y.im;
 
@@ -27,6 +27,8 @@
  ******************************************************************************/
 int32_t sc_mac_long_s16(int16_t x, int16_t y, int32_t acc)
 {
+    CIMLIB_PROF_CALL(sc_mac_long_s16, 1);
+
     acc += (int32_t)x * y;
 
     return acc;
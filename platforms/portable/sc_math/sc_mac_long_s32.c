@@ -27,6 +27,8 @@
  ******************************************************************************/
 int64_t sc_mac_long_s32(int32_t x, int32_t y, int64_t acc)
 {
+    CIMLIB_PROF_CALL(sc_mac_long_s32, 1);
+
     acc += (int64_t)x * y;
 
     return acc;
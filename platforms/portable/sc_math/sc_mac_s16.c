@@ -28,6 +28,8 @@
  ******************************************************************************/
 int16_t sc_mac_s16(int16_t x, int16_t y, int16_t acc, int radix)
 {
+    CIMLIB_PROF_CALL(sc_mac_s16, 1);
+
     acc += (int16_t)(((int32_t)x * y) >> radix);
 
     return acc;
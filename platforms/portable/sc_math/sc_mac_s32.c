@@ -28,6 +28,8 @@
  ******************************************************************************/
 int32_t sc_mac_s32(int32_t x, int32_t y, int32_t acc, int radix)
 {
+    CIMLIB_PROF_CALL(sc_mac_s32, 1);
+
     acc += (int32_t)(((int64_t)x * y) >> radix);
 
     return acc;
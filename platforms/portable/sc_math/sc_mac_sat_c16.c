@@ -28,6 +28,7 @@
  ******************************************************************************/
 cint16_t sc_mac_sat_c16(cint16_t x, cint16_t y, cint16_t acc, int radix)
 {
+    CIMLIB_PROF_CALL(sc_mac_sat_c16, 1);
     int32_t re, im;
 
     re = (int32_t)x.re * y.re - (int32_t)x.im * y.im;
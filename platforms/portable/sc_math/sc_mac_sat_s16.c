@@ -28,6 +28,7 @@
  ******************************************************************************/
 int16_t sc_mac_sat_s16(int16_t x, int16_t y, int16_t acc, int radix)
 {
+    CIMLIB_PROF_CALL(sc_mac_sat_s16, 1);
     int32_t tmp;
 
     tmp = (int32_t)x * y;
@@ -28,6 +28,7 @@
  ******************************************************************************/
 int32_t sc_mac_sat_s32(int32_t x, int32_t y, int32_t acc, int radix)
 {
+    CIMLIB_PROF_CALL(sc_mac_sat_s32, 1);
     int64_t tmp;
 
     tmp = (int64_t)x * y;
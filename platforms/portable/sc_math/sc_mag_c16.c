@@ -9,6 +9,7 @@
  * Includes
  * ---------------------------------------------------------------------------*/
 #include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
 
 
 /* -----------------------------------------------------------------------------
@@ -25,11 +26,12 @@
  ******************************************************************************/
 uint16_t sc_mag_c16(cint16_t x)
 {
+    CIMLIB_PROF_CALL(sc_mag_c16, 1);
     uint16_t y;
     uint32_t eng;
 
-    eng = (uint32_t)((int32_t)x.re * x.re + (int32_t)x.im * x.im);
-    y = sc_sqrt_u32(eng);
+    eng = (uint32_t)((int32_t)x.re * x.re) + (uint32_t)((int32_t)x.im * x.im);
+    y = sc_sqrt_u32_core(eng);
 
     return y;
 }
@@ -9,6 +9,7 @@
  * Includes
  * ---------------------------------------------------------------------------*/
 #include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
 
 
 /* -----------------------------------------------------------------------------
@@ -25,11 +26,12 @@
  ******************************************************************************/
 uint32_t sc_mag_c32(cint32_t x)
 {
+    CIMLIB_PROF_CALL(sc_mag_c32, 1);
     uint32_t y;
     uint64_t eng;
 
-    eng = (uint64_t)((int64_t)x.re * x.re + (int64_t)x.im * x.im);
-    y = sc_sqrt_u64(eng);
+    eng = (uint64_t)((int64_t)x.re * x.re) + (uint64_t)((int64_t)x.im * x.im);
+    y = sc_sqrt_u64_core(eng);
 
     return y;
 }
@@ -25,6 +25,8 @@
  ******************************************************************************/
 int32_t sc_max_s32(int32_t x, int32_t y)
 {
+    CIMLIB_PROF_CALL(sc_max_s32, 1);
+
     if (y > x) {
         x = y;
     }
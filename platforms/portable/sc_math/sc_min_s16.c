@@ -25,6 +25,8 @@
  ******************************************************************************/
 int16_t sc_min_s16(int16_t x, int16_t y)
 {
+    CIMLIB_PROF_CALL(sc_min_s16, 1);
+
     if (y < x) {
         x = y;
     }
@@ -24,6 +24,7 @@
  ******************************************************************************/
 cint16_t sc_mul_c16s16(cint16_t x, int16_t y, int radix)
 {
+    CIMLIB_PROF_CALL(sc_mul_c16s16, 1);
     cint16_t z;
     int32_t re, im;
 
@@ -24,6 +24,7 @@
  ******************************************************************************/
 cint32_t sc_mul_c32s32(cint32_t x, int32_t y, int radix)
 {
+    CIMLIB_PROF_CALL(sc_mul_c32s32, 1);
     cint32_t z;
     int64_t re, im;
 
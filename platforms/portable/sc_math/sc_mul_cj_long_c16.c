@@ -26,6 +26,7 @@
  ******************************************************************************/
 cint32_t sc_mul_cj_long_c16(cint16_t x, cint16_t y)
 {
+    CIMLIB_PROF_CALL(sc_mul_cj_long_c16, 1);
     cint32_t z;
 
     z.re = (int32_t)x.re * y.re + (int32_t)x.im * y.im;
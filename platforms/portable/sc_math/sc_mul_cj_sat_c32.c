@@ -27,6 +27,7 @@
  ******************************************************************************/
 cint32_t sc_mul_cj_sat_c32(cint32_t x, cint32_t y, int radix)
 {
+    CIMLIB_PROF_CALL(sc_mul_cj_sat_c32, 1);
     cint32_t z;
     int64_t re, im;
 
@@ -26,6 +26,7 @@
  ******************************************************************************/
 cint64_t sc_mul_long_c32(cint32_t x, cint32_t y)
 {
+    CIMLIB_PROF_CALL(sc_mul_long_c32, 1);
     cint64_t z;
 
     z.re = (int64_t)x.re * y.re - (int64_t)x.im * y.im;
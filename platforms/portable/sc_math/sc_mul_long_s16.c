@@ -26,6 +26,7 @@
  ******************************************************************************/
 int32_t sc_mul_long_s16(int16_t x, int16_t y)
 {
+    CIMLIB_PROF_CALL(sc_mul_long_s16, 1);
     int32_t z;
 
     z = (int32_t)x * y;
@@ -26,6 +26,7 @@
  ******************************************************************************/
 int64_t sc_mul_long_s32(int32_t x, int32_t y)
 {
+    CIMLIB_PROF_CALL(sc_mul_long_s32, 1);
     int64_t z;
 
     z = (int64_t)x * y;
@@ -26,6 +26,7 @@
  ******************************************************************************/
 int16_t sc_mul_s16(int16_t x, int16_t y, int radix)
 {
+    CIMLIB_PROF_CALL(sc_mul_s16, 1);
     int16_t z;
 
     z = (int16_t)(((int32_t)x * y) >> radix);
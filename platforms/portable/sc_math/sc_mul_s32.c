@@ -26,6 +26,7 @@
  ******************************************************************************/
 int32_t sc_mul_s32(int32_t x, int32_t y, int radix)
 {
+    CIMLIB_PROF_CALL(sc_mul_s32, 1);
     int32_t z;
 
     z = (int32_t)(((int64_t)x * y) >> radix);
@@ -27,6 +27,7 @@
  ******************************************************************************/
 int16_t sc_mul_sat_s16(int16_t x, int16_t y, int radix)
 {
+    CIMLIB_PROF_CALL(sc_mul_sat_s16, 1);
     int16_t z;
     int32_t tmp;
 
@@ -27,6 +27,7 @@
  ******************************************************************************/
 int32_t sc_mul_sat_s32(int32_t x, int32_t y, int radix)
 {
+    CIMLIB_PROF_CALL(sc_mul_sat_s32, 1);
     int32_t z;
     int64_t tmp;
 
@@ -25,6 +25,7 @@
  ******************************************************************************/
 cint16_t sc_norm_c16(cint16_t x, int radix)
 {
+    CIMLIB_PROF_CALL(sc_norm_c16, 1);
     cint16_t y;
     int16_t norm;
 
@@ -25,6 +25,7 @@
  ******************************************************************************/
 cint32_t sc_norm_c32(cint32_t x, int radix)
 {
+    CIMLIB_PROF_CALL(sc_norm_c32, 1);
     cint32_t y;
     int32_t norm;
 
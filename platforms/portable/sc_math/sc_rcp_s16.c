@@ -25,6 +25,7 @@
  ******************************************************************************/
 int16_t sc_rcp_s16(int16_t x, int radix)
 {
+    CIMLIB_PROF_CALL(sc_rcp_s16, 1);
     int16_t y;
     int32_t tmp;
 
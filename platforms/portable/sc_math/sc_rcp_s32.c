@@ -25,6 +25,7 @@
  ******************************************************************************/
 int32_t sc_rcp_s32(int32_t x, int radix)
 {
+    CIMLIB_PROF_CALL(sc_rcp_s32, 1);
     int32_t y;
     int64_t tmp;
 
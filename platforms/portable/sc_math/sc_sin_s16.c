@@ -37,6 +37,7 @@
  ******************************************************************************/
 int16_t sc_sin_s16(int16_t x, int radix)
 {
+    CIMLIB_PROF_CALL(sc_sin_s16, 1);
     int16_t y, tmp, one;
 
     /* Constants */
@@ -37,6 +37,7 @@
  ******************************************************************************/
 int32_t sc_sin_s32(int32_t x, int radix)
 {
+    CIMLIB_PROF_CALL(sc_sin_s32, 1);
     int32_t y, tmp, one;
 
     /* Constants */
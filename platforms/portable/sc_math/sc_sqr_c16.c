@@ -25,6 +25,7 @@
  ******************************************************************************/
 uint16_t sc_sqr_c16(cint16_t x, int radix)
 {
+    CIMLIB_PROF_CALL(sc_sqr_c16, 1);
     uint16_t y;
     uint32_t tmp;
 
@@ -9,6 +9,7 @@
  * Includes
  * ---------------------------------------------------------------------------*/
 #include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
 
 
 /* -----------------------------------------------------------------------------
@@ -25,12 +26,9 @@
  ******************************************************************************/
 uint32_t sc_sqr_long_c16(cint16_t x)
 {
-    uint32_t y;
+    CIMLIB_PROF_CALL(sc_sqr_long_c16, 1);
 
-    y = (uint32_t)((int32_t)x.re * x.re);
-    y += (uint32_t)((int32_t)x.im * x.im);
-
-    return y;
+    return sc_sqr_long_c16_core(x);
 }
 
 
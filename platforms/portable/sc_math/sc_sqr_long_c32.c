@@ -9,6 +9,7 @@
  * Includes
  * ---------------------------------------------------------------------------*/
 #include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
 
 
 /* -----------------------------------------------------------------------------
@@ -25,12 +26,9 @@
  ******************************************************************************/
 uint64_t sc_sqr_long_c32(cint32_t x)
 {
-    uint64_t y;
+    CIMLIB_PROF_CALL(sc_sqr_long_c32, 1);
 
-    y = (uint64_t)((int64_t)x.re * x.re);
-    y += (uint64_t)((int64_t)x.im * x.im);
-
-    return y;
+    return sc_sqr_long_c32_core(x);
 }
 
 
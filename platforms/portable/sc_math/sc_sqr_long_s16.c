@@ -25,6 +25,7 @@
  ******************************************************************************/
 uint32_t sc_sqr_long_s16(int16_t x)
 {
+    CIMLIB_PROF_CALL(sc_sqr_long_s16, 1);
     uint32_t y;
 
     y = (uint32_t)((int32_t)x * x);
@@ -25,6 +25,7 @@
  ******************************************************************************/
 uint64_t sc_sqr_long_s32(int32_t x)
 {
+    CIMLIB_PROF_CALL(sc_sqr_long_s32, 1);
     uint64_t y;
 
     y = (uint64_t)((int64_t)x * x);
@@ -25,6 +25,7 @@
  ******************************************************************************/
 uint16_t sc_sqr_s16(int16_t x, int radix)
 {
+    CIMLIB_PROF_CALL(sc_sqr_s16, 1);
     uint16_t y;
 
     y = (uint16_t)(((int32_t)x * x) >> radix);
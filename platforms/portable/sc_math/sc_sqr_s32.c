@@ -25,6 +25,7 @@
  ******************************************************************************/
 uint32_t sc_sqr_s32(int32_t x, int radix)
 {
+    CIMLIB_PROF_CALL(sc_sqr_s32, 1);
     uint32_t y;
 
     y = (uint32_t)(((int64_t)x * x) >> radix);
@@ -26,6 +26,7 @@
  ******************************************************************************/
 uint32_t sc_sqr_sat_c32(cint32_t x, int radix)
 {
+    CIMLIB_PROF_CALL(sc_sqr_sat_c32, 1);
     uint32_t y;
     uint64_t tmp;
 
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates square of value, 64 bit signed, result with
+ * 128 bit precision. Calculated by 32 bit halves, no compiler 128 bit
+ * support is needed.
+ *
+ * @param[in]  x  Input value, 64 bit signed.
+ *
+ * @return        Square of value, 128 bit unsigned.
+ ******************************************************************************/
+uint128_t sc_sqr_xlong_s64(int64_t x)
+{
+    CIMLIB_PROF_CALL(sc_sqr_xlong_s64, 1);
+
+    return sc_sqr_xlong_s64_core(x);
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX     (40)
+#define CONST(X)  CIMLIB_CONST_S64(X, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'sc_sqr_xlong_s64' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_sc_sqr_xlong_s64(void)
+{
+    int n;
+    uint128_t y[4];
+    static int64_t x[4] = {
+        CONST(-0.5), CONST(3.0), INT64_MIN, INT64_MAX
+    };
+    static uint128_t res[4] = {
+        {(uint64_t)1 << (RADIX * 2 - 2 - 64), 0},
+        {(uint64_t)9 << (RADIX * 2 - 64), 0},
+        {(uint64_t)1 << 62, 0},
+        {((uint64_t)1 << 62) - 1, 1}
+    };
+    bool flOk = true;
+
+    /* Call 'sc_sqr_xlong_s64' function */
+    for (n = 0; n < 4; n++) {
+        y[n] = sc_sqr_xlong_s64(x[n]);
+    }
+
+    /* Check the correctness of the results */
+    for (n = 0; n < 4; n++) {
+        if ((y[n].hi != res[n].hi) || (y[n].lo != res[n].lo)) {
+            flOk = false;
+        }
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
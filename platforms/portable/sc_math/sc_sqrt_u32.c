@@ -9,6 +9,7 @@
  * Includes
  * ---------------------------------------------------------------------------*/
 #include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
 
 
 /* -----------------------------------------------------------------------------
@@ -24,22 +25,9 @@
  ******************************************************************************/
 uint16_t sc_sqrt_u32(uint32_t x)
 {
-    uint16_t y, t, s;
+    CIMLIB_PROF_CALL(sc_sqrt_u32, 1);
 
-    y = (1 << (sc_log2_int_u32(x) >> 1));
-    s = y >> 1;
-    t = y + s;
-
-    while (s > 0) {
-        if (((uint32_t)t * t) <= x) {
-            y = t;
-        }
-
-        s >>= 1;
-        t = y + s;
-    }
-
-    return y;
+    return sc_sqrt_u32_core(x);
 }
 
 
@@ -58,22 +46,22 @@ uint16_t sc_sqrt_u32(uint32_t x)
 bool test_sc_sqrt_u32(void)
 {
     int n;
-    uint16_t y[4];
-    static uint32_t x[4] = {
-        CONST_U32(9.0), CONST_U32(36.0), CONST_U32(4.0), CONST_U32(1.0)
+    uint16_t y[5];
+    static uint32_t x[5] = {
+        CONST_U32(9.0), CONST_U32(36.0), CONST_U32(4.0), CONST_U32(1.0), 0
     };
-    static uint16_t res[4] = {
-        CONST_U16(3.0), CONST_U16(6.0), CONST_U16(2.0), CONST_U16(1.0)
+    static uint16_t res[5] = {
+        CONST_U16(3.0), CONST_U16(6.0), CONST_U16(2.0), CONST_U16(1.0), 0
     };
     bool flOk = true;
 
     /* Call 'sc_sqrt_u32' function */
-    for (n = 0; n < 4; n++) {
+    for (n = 0; n < 5; n++) {
         y[n] = sc_sqrt_u32(x[n]);
     }
 
     /* Check the correctness of the result */
-    TEST_LIBS_CHECK_RES_REAL(y, res, 4, flOk);
+    TEST_LIBS_CHECK_RES_REAL(y, res, 5, flOk);
 
     return flOk;
 }
@@ -9,6 +9,7 @@
  * Includes
  * ---------------------------------------------------------------------------*/
 #include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
 
 
 /* -----------------------------------------------------------------------------
@@ -24,22 +25,9 @@
  ******************************************************************************/
 uint32_t sc_sqrt_u64(uint64_t x)
 {
-    uint32_t y, t, s;
+    CIMLIB_PROF_CALL(sc_sqrt_u64, 1);
 
-    y = (1 << (sc_log2_int_u64(x) >> 1));
-    s = y >> 1;
-    t = y + s;
-
-    while (s > 0) {
-        if (((uint64_t)t * t) <= x) {
-            y = t;
-        }
-
-        s >>= 1;
-        t = y + s;
-    }
-
-    return y;
+    return sc_sqrt_u64_core(x);
 }
 
 
@@ -58,22 +46,22 @@ uint32_t sc_sqrt_u64(uint64_t x)
 bool test_sc_sqrt_u64(void)
 {
     int n;
-    uint32_t y[4];
-    static uint64_t x[4] = {
-        CONST_U64(9.0), CONST_U64(36.0), CONST_U64(4.0), CONST_U64(1.0)
+    uint32_t y[5];
+    static uint64_t x[5] = {
+        CONST_U64(9.0), CONST_U64(36.0), CONST_U64(4.0), CONST_U64(1.0), 0
     };
-    static uint32_t res[4] = {
-        CONST_U32(3.0), CONST_U32(6.0), CONST_U32(2.0), CONST_U32(1.0)
+    static uint32_t res[5] = {
+        CONST_U32(3.0), CONST_U32(6.0), CONST_U32(2.0), CONST_U32(1.0), 0
     };
     bool flOk = true;
 
     /* Call 'sc_sqrt_u64' function */
-    for (n = 0; n < 4; n++) {
+    for (n = 0; n < 5; n++) {
         y[n] = sc_sqrt_u64(x[n]);
     }
 
     /* Check the correctness of the result */
-    TEST_LIBS_CHECK_RES_REAL(y, res, 4, flOk);
+    TEST_LIBS_CHECK_RES_REAL(y, res, 5, flOk);
 
     return flOk;
 }
@@ -10,13 +10,16 @@
 C_SRC_LIB = \
 	$(wildcard frm_math/*.c) \
 	$(wildcard mem_oper/*.c) \
+	$(wildcard par_math/*.c) \
+	$(wildcard prof_oper/*.c) \
 	$(wildcard sc_math/*.c) \
 	$(wildcard vec_math/*.c)
 
 # Include directories
 INCLUDES_LIB = \
 	-I ../../common/inc \
-	-I ../../test/inc
+	-I ../../test/inc \
+	-I inc
 	
 # Objects
 OBJS_LIB = $(C_SRC_LIB:.c=.o)
@@ -36,3 +39,26 @@ INCLUDES_TEST = \
 
 # Objects
 OBJS_TEST = $(C_SRC_TEST:.c=.o)
+
+# C++ header test source files
+CPP_SRC_TEST = \
+	$(wildcard ../../test/*.cpp)
+
+# C++ header test objects
+OBJS_TEST_CPP = $(CPP_SRC_TEST:.cpp=.o)
+
+
+#==========================================================
+# Library bench sources
+#==========================================================
+
+# Source files
+C_SRC_BENCH = \
+	$(wildcard ../../bench/*.c)
+
+# Include directories
+INCLUDES_BENCH = \
+	-I ../../bench/inc
+
+# Objects
+OBJS_BENCH = $(C_SRC_BENCH:.c=.o)
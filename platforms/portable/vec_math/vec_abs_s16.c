@@ -26,6 +26,7 @@
  ******************************************************************************/
 void vec_abs_s16(int16_t *pY, int len, const int16_t *pX)
 {
+    CIMLIB_PROF_FUNC(vec_abs_s16, len);
     int n;
 
     for (n = 0; n < len; n++) {
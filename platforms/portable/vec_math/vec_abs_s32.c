@@ -26,6 +26,7 @@
  ******************************************************************************/
 void vec_abs_s32(int32_t *pY, int len, const int32_t *pX)
 {
+    CIMLIB_PROF_FUNC(vec_abs_s32, len);
     int n;
 
     for (n = 0; n < len; n++) {
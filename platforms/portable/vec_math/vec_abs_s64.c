@@ -26,6 +26,7 @@
  ******************************************************************************/
 void vec_abs_s64(int64_t *pY, int len, const int64_t *pX)
 {
+    CIMLIB_PROF_FUNC(vec_abs_s64, len);
     int n;
 
     for (n = 0; n < len; n++) {
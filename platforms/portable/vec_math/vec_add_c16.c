@@ -25,6 +25,7 @@
  ******************************************************************************/
 void vec_add_c16(cint16_t *pZ, int len, const cint16_t *pX, const cint16_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_add_c16, len);
     int n;
 
     for (n = 0; n < len; n++) {
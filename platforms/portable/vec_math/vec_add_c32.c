@@ -25,6 +25,7 @@
  ******************************************************************************/
 void vec_add_c32(cint32_t *pZ, int len, const cint32_t *pX, const cint32_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_add_c32, len);
     int n;
 
     for (n = 0; n < len; n++) {
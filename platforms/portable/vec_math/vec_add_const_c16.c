@@ -26,6 +26,7 @@
  ******************************************************************************/
 void vec_add_const_c16(cint16_t *pY, int len, const cint16_t *pX, cint16_t cnst)
 {
+    CIMLIB_PROF_FUNC(vec_add_const_c16, len);
     int n;
     int16_t re, im;
 
@@ -26,6 +26,7 @@
  ******************************************************************************/
 void vec_add_const_c32(cint32_t *pY, int len, const cint32_t *pX, cint32_t cnst)
 {
+    CIMLIB_PROF_FUNC(vec_add_const_c32, len);
     int n;
     int32_t re, im;
 
@@ -26,6 +26,7 @@
  ******************************************************************************/
 void vec_add_const_s32(int32_t *pY, int len, const int32_t *pX, int32_t cnst)
 {
+    CIMLIB_PROF_FUNC(vec_add_const_s32, len);
     int n;
 
     for (n = 0; n < len; n++) {
@@ -27,6 +27,7 @@
 void vec_add_const_sat_c16(cint16_t *pY, int len, const cint16_t *pX,
                            cint16_t cnst)
 {
+    CIMLIB_PROF_FUNC(vec_add_const_sat_c16, len);
     int n;
     int32_t re, im;
     int16_t cnst_re, cnst_im;
@@ -27,6 +27,7 @@
 void vec_add_const_sat_c32(cint32_t *pY, int len, const cint32_t *pX,
                            cint32_t cnst)
 {
+    CIMLIB_PROF_FUNC(vec_add_const_sat_c32, len);
     int n;
     int64_t re, im;
     int32_t cnst_re, cnst_im;
@@ -25,6 +25,7 @@
  ******************************************************************************/
 void vec_add_s16(int16_t *pZ, int len, const int16_t *pX, const int16_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_add_s16, len);
     int n;
 
     for (n = 0; n < len; n++) {
@@ -25,6 +25,7 @@
  ******************************************************************************/
 void vec_add_s32(int32_t *pZ, int len, const int32_t *pX, const int32_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_add_s32, len);
     int n;
 
     for (n = 0; n < len; n++) {
@@ -27,6 +27,7 @@
 void vec_add_sat_c16(cint16_t *pZ, int len, const cint16_t *pX,
                      const cint16_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_add_sat_c16, len);
     int n;
     int32_t re, im;
 
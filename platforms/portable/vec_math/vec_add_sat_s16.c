@@ -26,6 +26,7 @@
  ******************************************************************************/
 void vec_add_sat_s16(int16_t *pZ, int len, const int16_t *pX, const int16_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_add_sat_s16, len);
     int n;
     int32_t tmp;
 
@@ -26,6 +26,7 @@
  ******************************************************************************/
 void vec_add_sat_s32(int32_t *pZ, int len, const int32_t *pX, const int32_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_add_sat_s32, len);
     int n;
     int64_t tmp;
 
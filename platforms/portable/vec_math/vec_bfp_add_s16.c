@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Extra fraction bits of aligned sum */
+#define BFP_FRAC  (32)
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates by element addition of two block floating point
+ * vectors. Inputs are aligned to common exponent, which is selected by their
+ * headroom to keep all significant bits of the sum, result is normalised.
+ *
+ * @param[out]  pZ  Pointer to output block floating point vector. Can be
+ *                  equal to 'pX' or 'pY'.
+ * @param[in]   pX  Pointer to input block floating point vector.
+ * @param[in]   pY  Pointer to input block floating point vector.
+ ******************************************************************************/
+void vec_bfp_add_s16(vec_bfp_s16_t *pZ, const vec_bfp_s16_t *pX,
+                     const vec_bfp_s16_t *pY)
+{
+    CIMLIB_PROF_FUNC(vec_bfp_add_s16, pZ->len);
+    int n, exp, shX, shY;
+    int64_t acc, mulX, mulY;
+    int64_t rnd = ((int64_t)1 << (BFP_FRAC - 1));
+    int topX = INT16_MIN;
+    int topY = INT16_MIN;
+    int hX = vec_bfp_headroom_s16(pX);
+    int hY = vec_bfp_headroom_s16(pY);
+
+    /* Exponents of most significant bits, all zero vectors are ignored */
+    if (hX < 16) {
+        topX = pX->exp + 15 - hX;
+    }
+
+    if (hY < 16) {
+        topY = pY->exp + 15 - hY;
+    }
+
+    /* Output exponent, one bit for carry */
+    exp = ((topX > topY) ? topX : topY) + 1 - 15;
+
+    /* Inputs scales, with 'BFP_FRAC' extra fraction bits */
+    shX = BFP_FRAC + pX->exp - exp;
+    shY = BFP_FRAC + pY->exp - exp;
+
+    /* Larger scales are possible only for all zero vectors */
+    shX = (shX > BFP_FRAC + 14) ? (BFP_FRAC + 14) : shX;
+    shY = (shY > BFP_FRAC + 14) ? (BFP_FRAC + 14) : shY;
+    mulX = (shX > 0) ? ((int64_t)1 << shX) : 1;
+    mulY = (shY > 0) ? ((int64_t)1 << shY) : 1;
+    shX = (shX < 0) ? ((shX < -63) ? 63 : -shX) : 0;
+    shY = (shY < 0) ? ((shY < -63) ? 63 : -shY) : 0;
+
+    for (n = 0; n < pZ->len; n++) {
+        acc = (((int64_t)pX->pMant[n] * mulX) >> shX) +
+              (((int64_t)pY->pMant[n] * mulY) >> shY);
+        acc = (acc + rnd) >> BFP_FRAC;
+        CIMLIB_SAT_INT(pZ->pMant[n], INT16_MAX, acc);
+    }
+
+    pZ->exp = exp;
+    vec_bfp_norm_s16(pZ);
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX          (12)
+#define CONST(X)       CIMLIB_CONST_S16(X, RADIX)
+#define RADIX_OUT      (16)
+#define CONST_OUT(X)   CIMLIB_CONST_S32(X, RADIX_OUT)
+
+
+/*******************************************************************************
+ * This function tests 'vec_bfp_add_s16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_bfp_add_s16(void)
+{
+    int n;
+    int64_t diff, tol;
+    int32_t y[4];
+    vec_bfp_s16_t z, x1, x2;
+    int16_t mantZ[4], mant1[4], mant2[4];
+    static int16_t in1[4] = {
+        CONST(1.0), CONST(0.5), CONST(-2.0), CONST(0.001)
+    };
+    static int16_t in2[4] = {
+        CONST(7.0), CONST(-0.5), CONST(1.75), CONST(0.0)
+    };
+    static int32_t res[4] = {
+        CONST_OUT(8.0), CONST_OUT(0.0), CONST_OUT(-0.25), CONST_OUT(0.001)
+    };
+    bool flOk = true;
+
+    /* Call 'vec_bfp_add_s16' function */
+    vec_bfp_init_s16(&z, mantZ, 4);
+    vec_bfp_init_s16(&x1, mant1, 4);
+    vec_bfp_init_s16(&x2, mant2, 4);
+    vec_bfp_from_s16(&x1, in1, RADIX);
+    vec_bfp_from_s16(&x2, in2, RADIX);
+    vec_bfp_add_s16(&z, &x1, &x2);
+
+    /* Check the correctness of the result, with mantissa LSB tolerance */
+    vec_bfp_to_s32(y, &z, RADIX_OUT);
+    tol = (z.exp + RADIX_OUT > 0) ? (1 << (z.exp + RADIX_OUT)) : 1;
+    for (n = 0; n < 4; n++) {
+        diff = (int64_t)y[n] - res[n];
+        if ((diff > tol) || (diff < -tol)) {
+            flOk = false;
+            printf("val #%3d, out = %ld; ref = %ld;\n", n, (long)y[n],
+                   (long)res[n]);
+        }
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
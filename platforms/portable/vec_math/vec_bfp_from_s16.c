@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include <string.h>
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function initialises block floating point vector, 16 bit mantissas.
+ * Mantissas buffer is provided by caller and is reset to zero, exponent is
+ * reset to zero.
+ *
+ * @param[out]  pX     Pointer to block floating point vector.
+ * @param[in]   pMant  Pointer to mantissas buffer, 'len' elements.
+ * @param[in]   len    Vector length.
+ ******************************************************************************/
+void vec_bfp_init_s16(vec_bfp_s16_t *pX, int16_t *pMant, int len)
+{
+    CIMLIB_PROF_CALL(vec_bfp_init_s16, 0);
+
+    pX->pMant = pMant;
+    pX->len = len;
+    pX->exp = 0;
+
+    (void)memset(pMant, 0, len * sizeof(int16_t));
+}
+
+
+/*******************************************************************************
+ * This function converts fixed point vector, 16 bit signed, to block
+ * floating point vector. Result is normalised.
+ *
+ * @param[out]  pY     Pointer to block floating point vector, 'len' elements
+ *                     are converted.
+ * @param[in]   pX     Pointer to input vector, 16 bit signed. Can be equal
+ *                     to mantissas buffer of 'pY'.
+ * @param[in]   radix  Input radix.
+ ******************************************************************************/
+void vec_bfp_from_s16(vec_bfp_s16_t *pY, const int16_t *pX, int radix)
+{
+    CIMLIB_PROF_FUNC(vec_bfp_from_s16, pY->len);
+    int n;
+
+    for (n = 0; n < pY->len; n++) {
+        pY->pMant[n] = pX[n];
+    }
+
+    pY->exp = -radix;
+    vec_bfp_norm_s16(pY);
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX     (12)
+#define CONST(X)  CIMLIB_CONST_S16(X, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'vec_bfp_from_s16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_bfp_from_s16(void)
+{
+    vec_bfp_s16_t y;
+    int16_t mant[4];
+    static int16_t x[4] = {
+        CONST(0.5), CONST(-0.25), CONST(0.125), CONST(0.0)
+    };
+    static int16_t res[4] = {
+        16384, -8192, 4096, 0
+    };
+    bool flOk = true;
+
+    /* Call 'vec_bfp_init_s16' and 'vec_bfp_from_s16' functions */
+    vec_bfp_init_s16(&y, mant, 4);
+    vec_bfp_from_s16(&y, x, RADIX);
+
+    /* Check the correctness of the result, 0.5 is normalised to 2^14 */
+    TEST_LIBS_CHECK_RES_REAL(mant, res, 4, flOk);
+
+    if (y.exp != -RADIX - 3) {
+        flOk = false;
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
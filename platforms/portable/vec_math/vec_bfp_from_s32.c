@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function converts fixed point vector, 32 bit signed, to block
+ * floating point vector. Input is shifted by common number of bits to
+ * keep 16 significant bits of maximum element, with rounding. Result is
+ * normalised.
+ *
+ * @param[out]  pY     Pointer to block floating point vector, 'len' elements
+ *                     are converted.
+ * @param[in]   pX     Pointer to input vector, 32 bit signed.
+ * @param[in]   radix  Input radix.
+ ******************************************************************************/
+void vec_bfp_from_s32(vec_bfp_s16_t *pY, const int32_t *pX, int radix)
+{
+    CIMLIB_PROF_FUNC(vec_bfp_from_s32, pY->len);
+    int n, shift;
+    int64_t tmp;
+    int64_t rnd = 0;
+    uint32_t bits = 0;
+
+    /* Number of significant bits, without sign */
+    for (n = 0; n < pY->len; n++) {
+        bits |= (uint32_t)(pX[n] ^ (pX[n] >> 31));
+    }
+
+    shift = sc_log2_int_u32_core(bits) - 14;
+    if (shift < 0) {
+        shift = 0;
+    }
+
+    /* For correct rounding add half of shift */
+    if (shift != 0) {
+        rnd = ((int64_t)1 << (shift - 1));
+    }
+
+    for (n = 0; n < pY->len; n++) {
+        tmp = ((int64_t)pX[n] + rnd) >> shift;
+        CIMLIB_SAT_INT(pY->pMant[n], INT16_MAX, tmp);
+    }
+
+    pY->exp = shift - radix;
+    vec_bfp_norm_s16(pY);
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX     (24)
+#define CONST(X)  CIMLIB_CONST_S32(X, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'vec_bfp_from_s32' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_bfp_from_s32(void)
+{
+    vec_bfp_s16_t y;
+    int16_t mant[4];
+    static int32_t x[4] = {
+        CONST(100.0), CONST(-0.5), CONST(0.25), CONST(3.0)
+    };
+    static int16_t res[4] = {
+        25600, -128, 64, 768
+    };
+    bool flOk = true;
+
+    /* Call 'vec_bfp_from_s32' function */
+    vec_bfp_init_s16(&y, mant, 4);
+    vec_bfp_from_s32(&y, x, RADIX);
+
+    /* Check the correctness of the result, 100.0 = 25600 * 2^-8 */
+    TEST_LIBS_CHECK_RES_REAL(mant, res, 4, flOk);
+
+    if (y.exp != -8) {
+        flOk = false;
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates headroom of block floating point vector, number
+ * of redundant sign bits of mantissas, common for all elements.
+ *
+ * @param[in]  pX  Pointer to block floating point vector.
+ *
+ * @return         Headroom, in bits, [0..15]; 16 if all mantissas are zero.
+ ******************************************************************************/
+int vec_bfp_headroom_s16(const vec_bfp_s16_t *pX)
+{
+    CIMLIB_PROF_FUNC(vec_bfp_headroom_s16, pX->len);
+    int n;
+    uint16_t bits = 0;
+    uint16_t zero = 0;
+
+    for (n = 0; n < pX->len; n++) {
+        bits |= (uint16_t)(pX->pMant[n] ^ (pX->pMant[n] >> 15));
+        zero |= (uint16_t)pX->pMant[n];
+    }
+
+    if (zero == 0) {
+        return 16;
+    }
+
+    if (bits == 0) {
+        return 15;
+    }
+
+    return 14 - sc_log2_int_u16_core(bits);
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+
+/*******************************************************************************
+ * This function tests 'vec_bfp_headroom_s16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_bfp_headroom_s16(void)
+{
+    vec_bfp_s16_t x;
+    static int16_t mant[4] = {
+        0, -1, 255, -256
+    };
+    bool flOk = true;
+
+    /* Call 'vec_bfp_headroom_s16' function, 255 and -256 need 8 bits */
+    x.pMant = mant;
+    x.len = 4;
+    x.exp = 0;
+
+    if (vec_bfp_headroom_s16(&x) != 7) {
+        flOk = false;
+    }
+
+    /* Only zero and minus one */
+    x.len = 2;
+    if (vec_bfp_headroom_s16(&x) != 15) {
+        flOk = false;
+    }
+
+    /* Only zero */
+    x.len = 1;
+    if (vec_bfp_headroom_s16(&x) != 16) {
+        flOk = false;
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates by element multiply of two block floating point
+ * vectors. Products are calculated twice: first pass finds their number of
+ * significant bits, second one shifts them to 16 bits, result is
+ * normalised.
+ *
+ * @param[out]  pZ  Pointer to output block floating point vector. Can be
+ *                  equal to 'pX' or 'pY'.
+ * @param[in]   pX  Pointer to input block floating point vector.
+ * @param[in]   pY  Pointer to input block floating point vector.
+ ******************************************************************************/
+void vec_bfp_mul_s16(vec_bfp_s16_t *pZ, const vec_bfp_s16_t *pX,
+                     const vec_bfp_s16_t *pY)
+{
+    CIMLIB_PROF_FUNC(vec_bfp_mul_s16, pZ->len);
+    int n, shift;
+    int32_t tmp;
+    int32_t rnd = 0;
+    uint32_t bits = 0;
+
+    /* Number of significant bits of products, without sign */
+    for (n = 0; n < pZ->len; n++) {
+        tmp = (int32_t)pX->pMant[n] * pY->pMant[n];
+        bits |= (uint32_t)(tmp ^ (tmp >> 31));
+    }
+
+    shift = sc_log2_int_u32_core(bits) - 14;
+    if (shift < 0) {
+        shift = 0;
+    }
+
+    /* For correct rounding add half of shift */
+    if (shift != 0) {
+        rnd = (1 << (shift - 1));
+    }
+
+    for (n = 0; n < pZ->len; n++) {
+        tmp = ((int32_t)pX->pMant[n] * pY->pMant[n] + rnd) >> shift;
+        CIMLIB_SAT_INT(pZ->pMant[n], INT16_MAX, tmp);
+    }
+
+    pZ->exp = pX->exp + pY->exp + shift;
+    vec_bfp_norm_s16(pZ);
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX          (12)
+#define CONST(X)       CIMLIB_CONST_S16(X, RADIX)
+#define RADIX_OUT      (16)
+#define CONST_OUT(X)   CIMLIB_CONST_S32(X, RADIX_OUT)
+
+
+/*******************************************************************************
+ * This function tests 'vec_bfp_mul_s16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_bfp_mul_s16(void)
+{
+    int n;
+    int64_t diff, tol;
+    int32_t y[4];
+    vec_bfp_s16_t z, x1, x2;
+    int16_t mantZ[4], mant1[4], mant2[4];
+    static int16_t in1[4] = {
+        CONST(1.5), CONST(-0.25), CONST(0.001), CONST(0.75)
+    };
+    static int16_t in2[4] = {
+        CONST(2.0), CONST(4.0), CONST(-0.5), CONST(0.0)
+    };
+    static int32_t res[4] = {
+        CONST_OUT(3.0), CONST_OUT(-1.0), CONST_OUT(-0.0005), CONST_OUT(0.0)
+    };
+    bool flOk = true;
+
+    /* Call 'vec_bfp_mul_s16' function */
+    vec_bfp_init_s16(&z, mantZ, 4);
+    vec_bfp_init_s16(&x1, mant1, 4);
+    vec_bfp_init_s16(&x2, mant2, 4);
+    vec_bfp_from_s16(&x1, in1, RADIX);
+    vec_bfp_from_s16(&x2, in2, RADIX);
+    vec_bfp_mul_s16(&z, &x1, &x2);
+
+    /* Check the correctness of the result, with mantissa LSB tolerance */
+    vec_bfp_to_s32(y, &z, RADIX_OUT);
+    tol = (z.exp + RADIX_OUT > 0) ? (1 << (z.exp + RADIX_OUT)) : 1;
+    for (n = 0; n < 4; n++) {
+        diff = (int64_t)y[n] - res[n];
+        if ((diff > tol) || (diff < -tol)) {
+            flOk = false;
+            printf("val #%3d, out = %ld; ref = %ld;\n", n, (long)y[n],
+                   (long)res[n]);
+        }
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function normalises block floating point vector, mantissas are
+ * shifted left by headroom and exponent is decreased, so maximum element
+ * uses all 16 bits. Exponent of all zero vector is reset to zero.
+ *
+ * @param[in,out]  pX  Pointer to block floating point vector.
+ ******************************************************************************/
+void vec_bfp_norm_s16(vec_bfp_s16_t *pX)
+{
+    CIMLIB_PROF_FUNC(vec_bfp_norm_s16, pX->len);
+    int n;
+    int shift = vec_bfp_headroom_s16(pX);
+
+    if (shift > 15) {
+        pX->exp = 0;
+        return;
+    }
+
+    if (shift != 0) {
+        for (n = 0; n < pX->len; n++) {
+            pX->pMant[n] = (int16_t)(pX->pMant[n] * (1 << shift));
+        }
+
+        pX->exp -= shift;
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+
+/*******************************************************************************
+ * This function tests 'vec_bfp_norm_s16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_bfp_norm_s16(void)
+{
+    vec_bfp_s16_t x;
+    static int16_t mant[4] = {
+        0, -1, 255, -256
+    };
+    static int16_t res[4] = {
+        0, -128, 32640, -32768
+    };
+    bool flOk = true;
+
+    /* Call 'vec_bfp_norm_s16' function */
+    x.pMant = mant;
+    x.len = 4;
+    x.exp = 0;
+    vec_bfp_norm_s16(&x);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(mant, res, 4, flOk);
+
+    if (x.exp != -7) {
+        flOk = false;
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
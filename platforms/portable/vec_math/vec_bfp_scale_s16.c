@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function multiplies block floating point vector by fixed point
+ * constant. Products are shifted by number of bits selected by input and
+ * constant headroom, result is normalised.
+ *
+ * @param[out]  pY     Pointer to output block floating point vector. Can be
+ *                     equal to 'pX'.
+ * @param[in]   pX     Pointer to input block floating point vector.
+ * @param[in]   scale  Scale constant, 16 bit signed.
+ * @param[in]   radix  Scale constant radix.
+ ******************************************************************************/
+void vec_bfp_scale_s16(vec_bfp_s16_t *pY, const vec_bfp_s16_t *pX,
+                       int16_t scale, int radix)
+{
+    CIMLIB_PROF_FUNC(vec_bfp_scale_s16, pY->len);
+    int n, shift;
+    int32_t tmp;
+    int32_t rnd = 0;
+    uint16_t bits = (uint16_t)(scale ^ (scale >> 15));
+
+    /* Products have '30 - headroom' significant bits */
+    shift = 15 - vec_bfp_headroom_s16(pX) - (14 - sc_log2_int_u16_core(bits));
+    if (shift < 0) {
+        shift = 0;
+    }
+
+    /* For correct rounding add half of shift */
+    if (shift != 0) {
+        rnd = (1 << (shift - 1));
+    }
+
+    for (n = 0; n < pY->len; n++) {
+        tmp = ((int32_t)pX->pMant[n] * scale + rnd) >> shift;
+        CIMLIB_SAT_INT(pY->pMant[n], INT16_MAX, tmp);
+    }
+
+    pY->exp = pX->exp + shift - radix;
+    vec_bfp_norm_s16(pY);
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX          (12)
+#define CONST(X)       CIMLIB_CONST_S16(X, RADIX)
+#define RADIX_OUT      (16)
+#define CONST_OUT(X)   CIMLIB_CONST_S32(X, RADIX_OUT)
+
+
+/*******************************************************************************
+ * This function tests 'vec_bfp_scale_s16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_bfp_scale_s16(void)
+{
+    int n;
+    int64_t diff, tol;
+    int32_t y[4];
+    vec_bfp_s16_t z;
+    int16_t mantZ[4];
+    static int16_t in[4] = {
+        CONST(1.5), CONST(-0.25), CONST(0.001), CONST(7.0)
+    };
+    static int32_t res[4] = {
+        CONST_OUT(-4.5), CONST_OUT(0.75), CONST_OUT(-0.003), CONST_OUT(-21.0)
+    };
+    bool flOk = true;
+
+    /* Call 'vec_bfp_scale_s16' function, in place */
+    vec_bfp_init_s16(&z, mantZ, 4);
+    vec_bfp_from_s16(&z, in, RADIX);
+    vec_bfp_scale_s16(&z, &z, CONST(-3.0), RADIX);
+
+    /* Check the correctness of the result, with mantissa LSB tolerance */
+    vec_bfp_to_s32(y, &z, RADIX_OUT);
+    tol = (z.exp + RADIX_OUT > 0) ? (1 << (z.exp + RADIX_OUT)) : 1;
+    for (n = 0; n < 4; n++) {
+        diff = (int64_t)y[n] - res[n];
+        if ((diff > tol) || (diff < -tol)) {
+            flOk = false;
+            printf("val #%3d, out = %ld; ref = %ld;\n", n, (long)y[n],
+                   (long)res[n]);
+        }
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
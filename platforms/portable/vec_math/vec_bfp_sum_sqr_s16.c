@@ -0,0 +1,83 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates sum of squares of block floating point vector.
+ * Result is exact, sum of squares of mantissas with exponent of '2 * exp'.
+ *
+ * @param[out]  pExp  Pointer to output exponent, value is 'sum * 2^exp'.
+ * @param[in]   pX    Pointer to input block floating point vector.
+ *
+ * @return            Sum of squares of mantissas, 64 bit unsigned.
+ ******************************************************************************/
+uint64_t vec_bfp_sum_sqr_s16(int *pExp, const vec_bfp_s16_t *pX)
+{
+    CIMLIB_PROF_FUNC(vec_bfp_sum_sqr_s16, pX->len);
+    int n;
+    uint64_t acc = 0;
+
+    for (n = 0; n < pX->len; n++) {
+        acc += (uint32_t)((int32_t)pX->pMant[n] * pX->pMant[n]);
+    }
+
+    *pExp = 2 * pX->exp;
+
+    return acc;
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX     (12)
+#define CONST(X)  CIMLIB_CONST_S16(X, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'vec_bfp_sum_sqr_s16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_bfp_sum_sqr_s16(void)
+{
+    int exp;
+    uint64_t y;
+    vec_bfp_s16_t x;
+    int16_t mant[4];
+    static int16_t in[4] = {
+        CONST(0.5), CONST(-0.25), CONST(0.125), CONST(-0.5)
+    };
+    bool flOk = true;
+
+    /* Call 'vec_bfp_sum_sqr_s16' function */
+    vec_bfp_init_s16(&x, mant, 4);
+    vec_bfp_from_s16(&x, in, RADIX);
+    y = vec_bfp_sum_sqr_s16(&exp, &x);
+
+    /* Check the correctness of the result, 0.578125 = 37 * 2^-6 */
+    while ((y & 1) == 0) {
+        y >>= 1;
+        exp++;
+    }
+
+    if ((y != 37) || (exp != -6)) {
+        flOk = false;
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
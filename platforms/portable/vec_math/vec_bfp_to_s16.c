@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function converts block floating point vector to fixed point vector,
+ * 16 bit signed, with rounding and saturation control.
+ *
+ * @param[out]  pY     Pointer to output vector, 16 bit signed.
+ * @param[in]   pX     Pointer to block floating point vector.
+ * @param[in]   radix  Output radix.
+ ******************************************************************************/
+void vec_bfp_to_s16(int16_t *pY, const vec_bfp_s16_t *pX, int radix)
+{
+    CIMLIB_PROF_FUNC(vec_bfp_to_s16, pX->len);
+    int n;
+    int64_t tmp;
+    int64_t rnd = 0;
+    int shift = pX->exp + radix;
+
+    if (shift >= 0) {
+        /* Left shift, limited to keep saturation in 64 bit */
+        if (shift > 40) {
+            shift = 40;
+        }
+
+        for (n = 0; n < pX->len; n++) {
+            tmp = (int64_t)pX->pMant[n] * ((int64_t)1 << shift);
+            CIMLIB_SAT_INT(pY[n], INT16_MAX, tmp);
+        }
+    } else {
+        /* Right shift with rounding, rest of mantissa is lost */
+        shift = -shift;
+        if (shift > 31) {
+            shift = 31;
+        }
+
+        rnd = ((int64_t)1 << (shift - 1));
+        for (n = 0; n < pX->len; n++) {
+            tmp = ((int64_t)pX->pMant[n] + rnd) >> shift;
+            pY[n] = (int16_t)tmp;
+        }
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX     (12)
+#define CONST(X)  CIMLIB_CONST_S16(X, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'vec_bfp_to_s16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_bfp_to_s16(void)
+{
+    int16_t y[4];
+    vec_bfp_s16_t x;
+    static int16_t mant[4] = {
+        16384, -8192, 4096, 30000
+    };
+    static int16_t res0[4] = {
+        CONST(0.5), CONST(-0.25), CONST(0.125), CONST(0.9155273438)
+    };
+    static int16_t res1[4] = {
+        INT16_MAX, INT16_MIN, CONST(4.0), INT16_MAX
+    };
+    bool flOk = true;
+
+    /* Call 'vec_bfp_to_s16' function, value is mantissa * 2^-15 */
+    x.pMant = mant;
+    x.len = 4;
+    x.exp = -15;
+    vec_bfp_to_s16(y, &x, RADIX);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(y, res0, 4, flOk);
+
+    /* Call 'vec_bfp_to_s16' function, saturated values */
+    x.exp = -10;
+    vec_bfp_to_s16(y, &x, RADIX);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(y, res1, 4, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -27,6 +27,7 @@
  ******************************************************************************/
 uint32_t vec_cent_mass_s16(const int16_t *pX, int len, int radix)
 {
+    CIMLIB_PROF_FUNC(vec_cent_mass_s16, len);
     int n;
     int16_t x, minX;
     uint32_t centMass;
@@ -27,6 +27,7 @@
  ******************************************************************************/
 uint32_t vec_cent_mass_s32(const int32_t *pX, int len, int radix)
 {
+    CIMLIB_PROF_FUNC(vec_cent_mass_s32, len);
     int n;
     int32_t x, minX;
     uint32_t centMass;
@@ -27,6 +27,7 @@
  ******************************************************************************/
 uint32_t vec_cent_mass_u16(const uint16_t *pX, int len, int radix)
 {
+    CIMLIB_PROF_FUNC(vec_cent_mass_u16, len);
     int n;
     uint16_t x;
     uint32_t centMass;
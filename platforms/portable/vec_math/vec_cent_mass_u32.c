@@ -27,6 +27,7 @@
  ******************************************************************************/
 uint32_t vec_cent_mass_u32(const uint32_t *pX, int len, int radix)
 {
+    CIMLIB_PROF_FUNC(vec_cent_mass_u32, len);
     int n;
     uint32_t x;
     uint32_t centMass;
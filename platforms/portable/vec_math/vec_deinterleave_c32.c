@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function splits complex vector into real and imaginary parts
+ * (planar form), 32 bit complex.
+ *
+ * @param[out]  pYRe  Pointer to output vector, real part, 32 bit signed.
+ * @param[out]  pYIm  Pointer to output vector, imaginary part, 32 bit signed.
+ * @param[in]   len   Vector length.
+ * @param[in]   pX    Pointer to input vector, 32 bit complex.
+ ******************************************************************************/
+void vec_deinterleave_c32(int32_t *pYRe, int32_t *pYIm, int len,
+                          const cint32_t *pX)
+{
+    CIMLIB_PROF_FUNC(vec_deinterleave_c32, len);
+    int n;
+
+    for (n = 0; n < len; n++) {
+        pYRe[n] = pX[n].re;
+        pYIm[n] = pX[n].im;
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX     (24)
+#define CONST(X)  CIMLIB_CONST_S32(X, RADIX)
+#define CONST_CPLX(RE, IM)  CIMLIB_CONST_C32(RE, IM, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'vec_deinterleave_c32' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_deinterleave_c32(void)
+{
+    int32_t yRe[4], yIm[4];
+    static cint32_t x[4] = {
+        CONST_CPLX(0.75, 0.33), CONST_CPLX(-0.75, 0.33),
+        CONST_CPLX(0.5, -0.25), CONST_CPLX(-0.125, -0.9)
+    };
+    static int32_t resRe[4] = {
+        CONST(0.75), CONST(-0.75), CONST(0.5), CONST(-0.125)
+    };
+    static int32_t resIm[4] = {
+        CONST(0.33), CONST(0.33), CONST(-0.25), CONST(-0.9)
+    };
+    bool flOk = true;
+
+    /* Call 'vec_deinterleave_c32' function */
+    vec_deinterleave_c32(yRe, yIm, 4, x);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(yRe, resRe, 4, flOk);
+    TEST_LIBS_CHECK_RES_REAL(yIm, resIm, 4, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
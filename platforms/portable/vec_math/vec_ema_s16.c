@@ -30,6 +30,7 @@
 void vec_ema_s16(int16_t *pAcc, int len, int16_t alpha, int radix,
                  const int16_t *pX)
 {
+    CIMLIB_PROF_FUNC(vec_ema_s16, len);
     int n;
     int32_t tmp;
     int16_t rnd = 0;
@@ -30,6 +30,7 @@
 void vec_ema_s32(int32_t *pAcc, int len, int32_t alpha, int radix,
                  const int32_t *pX)
 {
+    CIMLIB_PROF_FUNC(vec_ema_s32, len);
     int n;
     int64_t tmp;
     int32_t rnd = 0;
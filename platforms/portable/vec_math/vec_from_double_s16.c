@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include <math.h>
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function converts double vector to fixed point, 16 bit signed.
+ * Input is scaled by multiplication with '2^radix', so there is no division.
+ *
+ * Flags:
+ *   'CIMLIB_CONV_RND' - round to nearest, halves away from zero (as
+ *                       'CIMLIB_ROUND'), otherwise truncate toward zero;
+ *   'CIMLIB_CONV_SAT' - saturate out of range values and infinities, NaN
+ *                       is 0, otherwise input must be in range of output
+ *                       type.
+ *
+ * @param[out]  pY     Pointer to output vector, 16 bit signed.
+ * @param[in]   len    Vector length.
+ * @param[in]   radix  Output radix, [0..15].
+ * @param[in]   flags  Conversion flags, 'CIMLIB_CONV_*'.
+ * @param[in]   pX     Pointer to input vector, double.
+ ******************************************************************************/
+void vec_from_double_s16(int16_t *pY, int len, int radix, unsigned int flags,
+                         const double *pX)
+{
+    CIMLIB_PROF_FUNC(vec_from_double_s16, len);
+    int n;
+    double tmp;
+    double scale = (double)((uint32_t)1 << radix);
+    double rnd = (flags & CIMLIB_CONV_RND) ? 0.5 : 0.0;
+    bool flSat = ((flags & CIMLIB_CONV_SAT) != 0);
+
+    for (n = 0; n < len; n++) {
+        tmp = pX[n] * scale;
+        tmp = (tmp < 0) ? (tmp - rnd) : (tmp + rnd);
+
+        if (flSat) {
+            CIMLIB_SAT_FLT(tmp, INT16_MAX, tmp);
+        }
+
+        pY[n] = (int16_t)tmp;
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX  (12)
+#define LSB_1  (1 << RADIX)
+#define LSB_Q  (1 << (RADIX - 2))
+
+
+/*******************************************************************************
+ * This function tests 'vec_from_double_s16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_from_double_s16(void)
+{
+    int16_t y[4];
+    static double x[4] = {
+        -0.25 - 0.75 / (1 << RADIX), 1.0 + 0.5 / (1 << RADIX), 8.5, -9.0
+    };
+    static int16_t resRnd[4] = {
+        -LSB_Q - 1, LSB_1 + 1, INT16_MAX, INT16_MIN
+    };
+    static int16_t resTrunc[2] = {
+        -LSB_Q, LSB_1
+    };
+    static const double xSpec[4] = {NAN, INFINITY, -INFINITY, NAN};
+    bool flOk = true;
+
+    /* Call 'vec_from_double_s16' function, rounding and saturation */
+    vec_from_double_s16(y, 4, RADIX, CIMLIB_CONV_RND | CIMLIB_CONV_SAT, x);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(y, resRnd, 4, flOk);
+
+    /* Call 'vec_from_double_s16' function, truncation */
+    vec_from_double_s16(y, 2, RADIX, CIMLIB_CONV_TRUNC, x);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(y, resTrunc, 2, flOk);
+
+    /* NaN is 0, infinities are saturated */
+    vec_from_double_s16(y, 4, RADIX, CIMLIB_CONV_SAT, xSpec);
+    flOk = flOk && (y[0] == 0) && (y[1] == INT16_MAX) && (y[2] == INT16_MIN) &&
+           (y[3] == 0);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
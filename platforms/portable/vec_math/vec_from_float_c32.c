@@ -0,0 +1,111 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include <math.h>
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function converts float vector to fixed point, 32 bit complex.
+ * Input is scaled by multiplication with '2^radix', so there is no division.
+ *
+ * Flags:
+ *   'CIMLIB_CONV_RND' - round to nearest, halves away from zero (as
+ *                       'CIMLIB_ROUND'), otherwise truncate toward zero;
+ *   'CIMLIB_CONV_SAT' - saturate out of range values and infinities, NaN
+ *                       is 0, otherwise input must be in range of output
+ *                       type.
+ *
+ * @param[out]  pY     Pointer to output vector, 32 bit complex.
+ * @param[in]   len    Vector length.
+ * @param[in]   radix  Output radix, [0..31].
+ * @param[in]   flags  Conversion flags, 'CIMLIB_CONV_*'.
+ * @param[in]   pX     Pointer to input vector, float, interleaved real and
+ *                     imaginary parts, 2 * len values.
+ ******************************************************************************/
+void vec_from_float_c32(cint32_t *pY, int len, int radix, unsigned int flags,
+                        const float *pX)
+{
+    CIMLIB_PROF_FUNC(vec_from_float_c32, len);
+    int n;
+    double re, im;
+    double scale = (double)((uint32_t)1 << radix);
+    double rnd = (flags & CIMLIB_CONV_RND) ? 0.5 : 0.0;
+    bool flSat = ((flags & CIMLIB_CONV_SAT) != 0);
+
+    for (n = 0; n < len; n++) {
+        re = pX[2 * n] * scale;
+        im = pX[2 * n + 1] * scale;
+        re = (re < 0) ? (re - rnd) : (re + rnd);
+        im = (im < 0) ? (im - rnd) : (im + rnd);
+
+        if (flSat) {
+            CIMLIB_SAT_FLT(re, INT32_MAX, re);
+            CIMLIB_SAT_FLT(im, INT32_MAX, im);
+        }
+
+        pY[n].re = (int32_t)re;
+        pY[n].im = (int32_t)im;
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX  (16)
+#define LSB_1  (1 << RADIX)
+#define LSB_Q  (1 << (RADIX - 2))
+
+
+/*******************************************************************************
+ * This function tests 'vec_from_float_c32' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_from_float_c32(void)
+{
+    cint32_t y[2];
+    static float x[4] = {
+        -0.25 - 0.75 / (1 << RADIX), 1.0 + 0.5 / (1 << RADIX), 40000.0, -40000.0
+    };
+    static cint32_t resRnd[2] = {
+        {-LSB_Q - 1, LSB_1 + 1}, {INT32_MAX, INT32_MIN}
+    };
+    static cint32_t resTrunc[1] = {
+        {-LSB_Q, LSB_1}
+    };
+    static const float xSpec[4] = {NAN, INFINITY, -INFINITY, NAN};
+    bool flOk = true;
+
+    /* Call 'vec_from_float_c32' function, rounding and saturation */
+    vec_from_float_c32(y, 2, RADIX, CIMLIB_CONV_RND | CIMLIB_CONV_SAT, x);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_CPLX(y, resRnd, 2, flOk);
+
+    /* Call 'vec_from_float_c32' function, truncation */
+    vec_from_float_c32(y, 1, RADIX, CIMLIB_CONV_TRUNC, x);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_CPLX(y, resTrunc, 1, flOk);
+
+    /* NaN is 0, infinities are saturated */
+    vec_from_float_c32(y, 2, RADIX, CIMLIB_CONV_SAT, xSpec);
+    flOk = flOk && (y[0].re == 0) && (y[0].im == INT32_MAX) &&
+           (y[1].re == INT32_MIN) && (y[1].im == 0);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
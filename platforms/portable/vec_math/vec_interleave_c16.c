@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function merges real and imaginary parts (planar form) into complex
+ * vector, 16 bit complex.
+ *
+ * @param[out]  pY    Pointer to output vector, 16 bit complex.
+ * @param[in]   len   Vector length.
+ * @param[in]   pXRe  Pointer to input vector, real part, 16 bit signed.
+ * @param[in]   pXIm  Pointer to input vector, imaginary part, 16 bit signed.
+ ******************************************************************************/
+void vec_interleave_c16(cint16_t *pY, int len, const int16_t *pXRe,
+                        const int16_t *pXIm)
+{
+    CIMLIB_PROF_FUNC(vec_interleave_c16, len);
+    int n;
+
+    for (n = 0; n < len; n++) {
+        pY[n].re = pXRe[n];
+        pY[n].im = pXIm[n];
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX     (12)
+#define CONST(X)  CIMLIB_CONST_S16(X, RADIX)
+#define CONST_CPLX(RE, IM)  CIMLIB_CONST_C16(RE, IM, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'vec_interleave_c16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_interleave_c16(void)
+{
+    cint16_t y[4];
+    static int16_t xRe[4] = {
+        CONST(0.75), CONST(-0.75), CONST(0.5), CONST(-0.125)
+    };
+    static int16_t xIm[4] = {
+        CONST(0.33), CONST(0.33), CONST(-0.25), CONST(-0.9)
+    };
+    static cint16_t res[4] = {
+        CONST_CPLX(0.75, 0.33), CONST_CPLX(-0.75, 0.33),
+        CONST_CPLX(0.5, -0.25), CONST_CPLX(-0.125, -0.9)
+    };
+    bool flOk = true;
+
+    /* Call 'vec_interleave_c16' function */
+    vec_interleave_c16(y, 4, xRe, xIm);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_CPLX(y, res, 4, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -11,6 +11,23 @@
 #include "cimlib.h"               /* Library header */
 
 
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Complex multiply-accumulate loop with radix, it is specialised by
+ * 'CIMLIB_RADIX_SWITCH' */
+#define MAC_LOOP(R)                                                            \
+{                                                                              \
+    for (n = 0; n < len; n++) {                                                \
+        re = (int64_t)pX[n].re * pY[n].re - (int64_t)pX[n].im * pY[n].im;      \
+        im = (int64_t)pX[n].im * pY[n].re + (int64_t)pX[n].re * pY[n].im;      \
+        pZ[n].re += (int32_t)(re >> (R));                                      \
+        pZ[n].im += (int32_t)(im >> (R));                                      \
+    }                                                                          \
+}
+
+
 /* -----------------------------------------------------------------------------
  * Exported functions
  * ---------------------------------------------------------------------------*/
@@ -28,15 +45,12 @@
 void vec_mac_c32(cint32_t *pZ, int len, int radix, const cint32_t *pX,
                  const cint32_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_mac_c32, len);
     int n;
     int64_t re, im;
 
-    for (n = 0; n < len; n++) {
-        re = (int64_t)pX[n].re * pY[n].re - (int64_t)pX[n].im * pY[n].im;
-        im = (int64_t)pX[n].im * pY[n].re + (int64_t)pX[n].re * pY[n].im;
-        pZ[n].re += (int32_t)(re >> radix);
-        pZ[n].im += (int32_t)(im >> radix);
-    }
+    /* Immediate shifts for commonly used radices */
+    CIMLIB_RADIX_SWITCH(radix, MAC_LOOP);
 }
 
 
@@ -53,6 +67,9 @@ void vec_mac_c32(cint32_t *pZ, int len, int radix, const cint32_t *pX,
  ******************************************************************************/
 bool test_vec_mac_c32(void)
 {
+    int n, k;
+    cint32_t ref, yk[4];
+    static const int radix[4] = {24, 28, 30, 25};
     static cint32_t x[4] = {
         CONST_CPLX(0.75, 0.33),
         CONST_CPLX(0.75, 0.33),
@@ -85,6 +102,24 @@ bool test_vec_mac_c32(void)
     /* Check the correctness of the result */
     TEST_LIBS_CHECK_RES_CPLX(z, res, 4, flOk);
 
+    /* Radices specialised by 'CIMLIB_RADIX_SWITCH' and runtime one, scalar
+     * function is reference, 'y' is scaled down, so accumulation does not
+     * overflow */
+    for (n = 0; n < 4; n++) {
+        yk[n].re = y[n].re / 16;
+        yk[n].im = y[n].im / 16;
+    }
+    for (k = 0; k < 4; k++) {
+        for (n = 0; n < 4; n++) {
+            z[n] = x[n];
+        }
+        vec_mac_c32(z, 4, radix[k], x, yk);
+        for (n = 0; n < 4; n++) {
+            ref = sc_mac_c32(x[n], yk[n], x[n], radix[k]);
+            flOk = flOk && (z[n].re == ref.re) && (z[n].im == ref.im);
+        }
+    }
+
     return flOk;
 }
 
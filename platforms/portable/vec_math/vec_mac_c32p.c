@@ -0,0 +1,108 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates by element complex multiply of input vectors,
+ * 32 bit complex, planar (split real and imaginary parts) form, result
+ * is accumulated in output vector.
+ *
+ * @param[in,out]  pZRe   Pointer to input-output vector, real part,
+ *                        32 bit signed.
+ * @param[in,out]  pZIm   Pointer to input-output vector, imaginary part,
+ *                        32 bit signed.
+ * @param[in]      len    Vector length.
+ * @param[in]      radix  Radix.
+ * @param[in]      pXRe   Pointer to input vector, real part, 32 bit signed.
+ * @param[in]      pXIm   Pointer to input vector, imaginary part,
+ *                        32 bit signed.
+ * @param[in]      pYRe   Pointer to input vector, real part, 32 bit signed.
+ * @param[in]      pYIm   Pointer to input vector, imaginary part,
+ *                        32 bit signed.
+ ******************************************************************************/
+void vec_mac_c32p(int32_t *pZRe, int32_t *pZIm, int len, int radix,
+                  const int32_t *pXRe, const int32_t *pXIm, const int32_t *pYRe,
+                  const int32_t *pYIm)
+{
+    CIMLIB_PROF_FUNC(vec_mac_c32p, len);
+    int n;
+    int64_t re, im;
+
+    for (n = 0; n < len; n++) {
+        re = (int64_t)pXRe[n] * pYRe[n] - (int64_t)pXIm[n] * pYIm[n];
+        im = (int64_t)pXIm[n] * pYRe[n] + (int64_t)pXRe[n] * pYIm[n];
+        pZRe[n] += (int32_t)(re >> radix);
+        pZIm[n] += (int32_t)(im >> radix);
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX               (28)
+#define CONST_CPLX(RE, IM)  CIMLIB_CONST_C32(RE, IM, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'vec_mac_c32p' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_mac_c32p(void)
+{
+    int n;
+    cint32_t z[4];
+    int32_t xRe[4], xIm[4], yRe[4], yIm[4], zRe[4], zIm[4];
+    static cint32_t x[4] = {
+        CONST_CPLX(0.75, 0.33), CONST_CPLX(-0.75, 0.33),
+        CONST_CPLX(0.5, -0.25), CONST_CPLX(-0.125, -0.9)
+    };
+    static cint32_t y[4] = {
+        CONST_CPLX(0.33, 0.75), CONST_CPLX(0.33, -0.75),
+        CONST_CPLX(-0.33, 0.75), CONST_CPLX(-0.33, -0.75)
+    };
+    bool flOk = true;
+
+    /* Split input vectors into planar form */
+    for (n = 0; n < 4; n++) {
+        xRe[n] = x[n].re;
+        xIm[n] = x[n].im;
+        yRe[n] = y[n].re;
+        yIm[n] = y[n].im;
+    }
+
+    /* Initial accumulator */
+    for (n = 0; n < 4; n++) {
+        z[n] = y[3 - n];
+        zRe[n] = z[n].re;
+        zIm[n] = z[n].im;
+    }
+
+    /* Call 'vec_mac_c32p' function, interleaved version is reference */
+    vec_mac_c32p(zRe, zIm, 4, RADIX, xRe, xIm, yRe, yIm);
+    vec_mac_c32(z, 4, RADIX, x, y);
+
+    /* Check the correctness of the result */
+    for (n = 0; n < 4; n++) {
+        if ((zRe[n] != z[n].re) || (zIm[n] != z[n].im)) {
+            flOk = false;
+        }
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -28,6 +28,7 @@
 void vec_mac_cj_long_c32(cint64_t *pZ, int len, const cint32_t *pX,
                          const cint32_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_mac_cj_long_c32, len);
     int n;
 
     for (n = 0; n < len; n++) {
@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates by element complex conjugate multiply of input
+ * vectors, scales products radix and accumulates them in output vector in
+ * one pass, Z = Z + X * conj(Y) * 2^offset, 16 bit complex, result is with
+ * saturation control. Products are shifted once, by 'radix - offset' bits,
+ * so there is no extra rounding error of separate scaling.
+ *
+ * @param[in,out]  pZ      Pointer to input-output vector, 16 bit complex.
+ * @param[in]      len     Vector length.
+ * @param[in]      radix   Radix.
+ * @param[in]      pX      Pointer to input vector, 16 bit complex.
+ * @param[in]      pY      Pointer to input vector, 16 bit complex.
+ * @param[in]      offset  Scale radix offset, number of shifts right, if
+ *                         negative; if positive - left shifts, [..radix].
+ ******************************************************************************/
+void vec_mac_cj_scale_sat_c16(cint16_t *pZ, int len, int radix,
+                              const cint16_t *pX, const cint16_t *pY,
+                              int offset)
+{
+    CIMLIB_PROF_FUNC(vec_mac_cj_scale_sat_c16, len);
+    int n;
+    int32_t re, im;
+    int shift = radix - offset;
+
+    for (n = 0; n < len; n++) {
+        re = (int32_t)pX[n].re * pY[n].re + (int32_t)pX[n].im * pY[n].im;
+        im = (int32_t)pX[n].im * pY[n].re - (int32_t)pX[n].re * pY[n].im;
+        re = (re >> shift) + pZ[n].re;
+        im = (im >> shift) + pZ[n].im;
+        CIMLIB_SAT_INT(re, INT16_MAX, re);
+        CIMLIB_SAT_INT(im, INT16_MAX, im);
+        pZ[n].re = (int16_t)re;
+        pZ[n].im = (int16_t)im;
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX               (12)
+#define CONST(X)            CIMLIB_CONST_S16(X, RADIX)
+#define CONST_CPLX(RE, IM)  CIMLIB_CONST_C16(RE, IM, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'vec_mac_cj_scale_sat_c16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_mac_cj_scale_sat_c16(void)
+{
+    static cint16_t x[4] = {
+        CONST_CPLX(1.5, 0.5),
+        CONST_CPLX(2.0, -1.0),
+        CONST_CPLX(-2.0, 0.25),
+        CONST_CPLX(3.0, 3.0)
+    };
+    static cint16_t y[4] = {
+        CONST_CPLX(1.0, 0.5),
+        CONST_CPLX(0.5, 0.5),
+        CONST_CPLX(1.5, -2.0),
+        CONST_CPLX(2.0, -1.0)
+    };
+    cint16_t z[4] = {
+        CONST_CPLX(0.5, -0.25),
+        CONST_CPLX(-1.0, 1.0),
+        CONST_CPLX(7.0, 0.0),
+        CONST_CPLX(0.0, -7.5)
+    };
+    static cint16_t res[4] = {
+        CONST_CPLX(1.3750000000E+00, -3.7500000000E-01),
+        CONST_CPLX(-7.5000000000E-01, 2.5000000000E-01),
+        CONST_CPLX(5.2500000000E+00, -1.8125000000E+00),
+        CONST_CPLX(1.5000000000E+00, -3.0000000000E+00)
+    };
+    bool flOk = true;
+
+    /* Call 'vec_mac_cj_scale_sat_c16' function, products are halved */
+    vec_mac_cj_scale_sat_c16(z, 4, RADIX, x, y, -1);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_CPLX(z, res, 4, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -28,6 +28,7 @@
 void vec_mac_long_c16(cint32_t *pZ, int len, const cint16_t *pX,
                       const cint16_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_mac_long_c16, len);
     int n;
 
     for (n = 0; n < len; n++) {
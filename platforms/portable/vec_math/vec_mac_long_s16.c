@@ -27,6 +27,7 @@
 void vec_mac_long_s16(int32_t *pZ, int len, const int16_t *pX,
                       const int16_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_mac_long_s16, len);
     int n;
 
     for (n = 0; n < len; n++) {
@@ -11,6 +11,20 @@
 #include "cimlib.h"               /* Library header */
 
 
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Multiply-accumulate loop with radix, it is specialised by
+ * 'CIMLIB_RADIX_SWITCH' */
+#define MAC_LOOP(R)                                                            \
+{                                                                              \
+    for (n = 0; n < len; n++) {                                                \
+        pZ[n] += (int16_t)(((int32_t)pX[n] * pY[n]) >> (R));                   \
+    }                                                                          \
+}
+
+
 /* -----------------------------------------------------------------------------
  * Exported functions
  * ---------------------------------------------------------------------------*/
@@ -28,11 +42,11 @@
 void vec_mac_s16(int16_t *pZ, int len, int radix, const int16_t *pX,
                  const int16_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_mac_s16, len);
     int n;
 
-    for (n = 0; n < len; n++) {
-        pZ[n] += (int16_t)(((int32_t)pX[n] * pY[n]) >> radix);
-    }
+    /* Immediate shifts for commonly used radices */
+    CIMLIB_RADIX_SWITCH(radix, MAC_LOOP);
 }
 
 
@@ -49,6 +63,8 @@ void vec_mac_s16(int16_t *pZ, int len, int radix, const int16_t *pX,
  ******************************************************************************/
 bool test_vec_mac_s16(void)
 {
+    int n, k;
+    static const int radix[5] = {8, 12, 14, 15, 13};
     static int16_t x[4] = {
         CONST(7.9), CONST(4.0), CONST(2.0), CONST(1.0)
     };
@@ -72,6 +88,18 @@ bool test_vec_mac_s16(void)
     /* Check the correctness of the result */
     TEST_LIBS_CHECK_RES_REAL(z, res, 4, flOk);
 
+    /* Radices specialised by 'CIMLIB_RADIX_SWITCH' and runtime one, scalar
+     * function is reference */
+    for (k = 0; k < 5; k++) {
+        for (n = 0; n < 4; n++) {
+            z[n] = x[n];
+        }
+        vec_mac_s16(z, 4, radix[k], x, y);
+        for (n = 0; n < 4; n++) {
+            flOk = flOk && (z[n] == sc_mac_s16(x[n], y[n], x[n], radix[k]));
+        }
+    }
+
     return flOk;
 }
 
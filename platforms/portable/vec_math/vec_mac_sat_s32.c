@@ -28,6 +28,7 @@
 void vec_mac_sat_s32(int32_t *pZ, int len, int radix, const int32_t *pX,
                      const int32_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_mac_sat_s32, len);
     int n;
     int64_t tmp;
 
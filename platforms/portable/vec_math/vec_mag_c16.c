@@ -9,6 +9,7 @@
  * Includes
  * ---------------------------------------------------------------------------*/
 #include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
 
 
 /* -----------------------------------------------------------------------------
@@ -25,12 +26,14 @@
  ******************************************************************************/
 void vec_mag_c16(uint16_t *pY, int len, const cint16_t *pX)
 {
+    CIMLIB_PROF_FUNC(vec_mag_c16, len);
     int n;
     uint32_t eng;
 
     for (n = 0; n < len; n++) {
-        eng = (uint32_t)(pX[n].re * pX[n].re + pX[n].im * pX[n].im);
-        pY[n] = sc_sqrt_u32(eng);
+        eng = (uint32_t)((int32_t)pX[n].re * pX[n].re) +
+              (uint32_t)((int32_t)pX[n].im * pX[n].im);
+        pY[n] = sc_sqrt_u32_core(eng);
     }
 }
 
@@ -0,0 +1,87 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates absolute complex (magnitude) value of each element
+ * of vector, 16 bit complex, planar (split real and imaginary parts) form.
+ *
+ * @param[out]  pY    Pointer to output vector, 16 bit unsigned.
+ * @param[in]   len   Vector length.
+ * @param[in]   pXRe  Pointer to input vector, real part, 16 bit signed.
+ * @param[in]   pXIm  Pointer to input vector, imaginary part, 16 bit signed.
+ ******************************************************************************/
+void vec_mag_c16p(uint16_t *pY, int len, const int16_t *pXRe,
+                  const int16_t *pXIm)
+{
+    CIMLIB_PROF_FUNC(vec_mag_c16p, len);
+    int n;
+    uint32_t eng;
+
+    for (n = 0; n < len; n++) {
+        eng = (uint32_t)((int32_t)pXRe[n] * pXRe[n]) +
+              (uint32_t)((int32_t)pXIm[n] * pXIm[n]);
+        pY[n] = sc_sqrt_u32_core(eng);
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX               (10)
+#define CONST_CPLX(RE, IM)  CIMLIB_CONST_C16(RE, IM, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'vec_mag_c16p' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_mag_c16p(void)
+{
+    int n;
+    uint16_t z[4], res[4];
+    int16_t xRe[4], xIm[4];
+    static cint16_t x[4] = {
+        CONST_CPLX(0.75, 0.33), CONST_CPLX(-0.75, 0.33),
+        CONST_CPLX(0.5, -0.25), CONST_CPLX(-0.125, -0.9)
+    };
+    bool flOk = true;
+
+    /* Split input vector into planar form */
+    for (n = 0; n < 4; n++) {
+        xRe[n] = x[n].re;
+        xIm[n] = x[n].im;
+    }
+
+    /* Call 'vec_mag_c16p' function, interleaved version is reference */
+    vec_mag_c16p(z, 4, xRe, xIm);
+    vec_mag_c16(res, 4, x);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(z, res, 4, flOk);
+
+    /* Corner of range, sum of squares is 2^31 */
+    xRe[0] = INT16_MIN;
+    xIm[0] = INT16_MIN;
+    vec_mag_c16p(z, 1, xRe, xIm);
+    flOk = flOk && (z[0] == 46340);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
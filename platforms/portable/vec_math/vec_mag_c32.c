@@ -9,6 +9,7 @@
  * Includes
  * ---------------------------------------------------------------------------*/
 #include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
 
 
 /* -----------------------------------------------------------------------------
@@ -25,13 +26,14 @@
  ******************************************************************************/
 void vec_mag_c32(uint32_t *pY, int len, const cint32_t *pX)
 {
+    CIMLIB_PROF_FUNC(vec_mag_c32, len);
     int n;
     uint64_t eng;
 
     for (n = 0; n < len; n++) {
-        eng = (uint64_t)((int64_t)pX[n].re * pX[n].re +
-                         (int64_t)pX[n].im * pX[n].im);
-        pY[n] = sc_sqrt_u64(eng);
+        eng = (uint64_t)((int64_t)pX[n].re * pX[n].re) +
+              (uint64_t)((int64_t)pX[n].im * pX[n].im);
+        pY[n] = sc_sqrt_u64_core(eng);
     }
 }
 
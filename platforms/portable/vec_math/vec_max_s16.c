@@ -26,6 +26,7 @@
  ******************************************************************************/
 int16_t vec_max_s16(int *pIdxMax, const int16_t *pX, int len)
 {
+    CIMLIB_PROF_FUNC(vec_max_s16, len);
     int i, idxMax;
     int16_t maxX;
 
@@ -26,6 +26,7 @@
  ******************************************************************************/
 int32_t vec_max_s32(int *pIdxMax, const int32_t *pX, int len)
 {
+    CIMLIB_PROF_FUNC(vec_max_s32, len);
     int i, idxMax;
     int32_t maxX;
 
@@ -27,6 +27,7 @@
  ******************************************************************************/
 uint32_t vec_max_sqr_c32(int *pIdxMax, const cint32_t *pX, int len, int radix)
 {
+    CIMLIB_PROF_FUNC(vec_max_sqr_c32, len);
     int n, idxMax;
     uint32_t maxSqr;
     uint64_t maxSqrLong, tmp;
@@ -27,6 +27,7 @@
  ******************************************************************************/
 uint16_t vec_max_sqr_s16(int *pIdxMax, const int16_t *pX, int len, int radix)
 {
+    CIMLIB_PROF_FUNC(vec_max_sqr_s16, len);
     int n, idxMax;
     uint16_t maxSqr;
     uint32_t maxSqrLong, tmp;
@@ -29,6 +29,7 @@
 uint16_t vec_max_sqr_sat_c16(int *pIdxMax, const cint16_t *pX, int len,
                              int radix)
 {
+    CIMLIB_PROF_FUNC(vec_max_sqr_sat_c16, len);
     int n, idxMax;
     uint16_t maxSqr;
     uint32_t maxSqrLong, tmp;
@@ -26,6 +26,7 @@
  ******************************************************************************/
 int16_t vec_min_s16(int *pIdxMin, const int16_t *pX, int len)
 {
+    CIMLIB_PROF_FUNC(vec_min_s16, len);
     int i, idxMin;
     int16_t minX;
 
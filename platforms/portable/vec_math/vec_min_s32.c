@@ -26,6 +26,7 @@
  ******************************************************************************/
 int32_t vec_min_s32(int *pIdxMin, const int32_t *pX, int len)
 {
+    CIMLIB_PROF_FUNC(vec_min_s32, len);
     int i, idxMin;
     int32_t minX;
 
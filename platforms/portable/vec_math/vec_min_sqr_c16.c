@@ -27,6 +27,7 @@
  ******************************************************************************/
 uint16_t vec_min_sqr_c16(int *pIdxMin, const cint16_t *pX, int len, int radix)
 {
+    CIMLIB_PROF_FUNC(vec_min_sqr_c16, len);
     int n, idxMin;
     uint16_t minSqr;
     uint32_t minSqrLong, tmp;
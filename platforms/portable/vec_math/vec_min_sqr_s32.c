@@ -27,6 +27,7 @@
  ******************************************************************************/
 uint32_t vec_min_sqr_s32(int *pIdxMin, const int32_t *pX, int len, int radix)
 {
+    CIMLIB_PROF_FUNC(vec_min_sqr_s32, len);
     int n, idxMin;
     uint32_t minSqr;
     uint64_t minSqrLong, tmp;
@@ -29,6 +29,7 @@
 uint32_t vec_min_sqr_sat_c32(int *pIdxMin, const cint32_t *pX, int len,
                              int radix)
 {
+    CIMLIB_PROF_FUNC(vec_min_sqr_sat_c32, len);
     int n, idxMin;
     uint32_t minSqr;
     uint64_t minSqrLong, tmp;
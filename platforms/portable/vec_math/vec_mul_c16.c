@@ -11,6 +11,23 @@
 #include "cimlib.h"               /* Library header */
 
 
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Complex multiply loop with radix, it is specialised by
+ * 'CIMLIB_RADIX_SWITCH' */
+#define MUL_LOOP(R)                                                            \
+{                                                                              \
+    for (n = 0; n < len; n++) {                                                \
+        re = (int32_t)pX[n].re * pY[n].re - (int32_t)pX[n].im * pY[n].im;      \
+        im = (int32_t)pX[n].im * pY[n].re + (int32_t)pX[n].re * pY[n].im;      \
+        pZ[n].re = (int16_t)(re >> (R));                                       \
+        pZ[n].im = (int16_t)(im >> (R));                                       \
+    }                                                                          \
+}
+
+
 /* -----------------------------------------------------------------------------
  * Exported functions
  * ---------------------------------------------------------------------------*/
@@ -28,15 +45,12 @@
 void vec_mul_c16(cint16_t *pZ, int len, int radix, const cint16_t *pX,
                  const cint16_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_mul_c16, len);
     int n;
     int32_t re, im;
 
-    for (n = 0; n < len; n++) {
-        re = (int32_t)pX[n].re * pY[n].re - (int32_t)pX[n].im * pY[n].im;
-        im = (int32_t)pX[n].im * pY[n].re + (int32_t)pX[n].re * pY[n].im;
-        pZ[n].re = (int16_t)(re >> radix);
-        pZ[n].im = (int16_t)(im >> radix);
-    }
+    /* Immediate shifts for commonly used radices */
+    CIMLIB_RADIX_SWITCH(radix, MUL_LOOP);
 }
 
 
@@ -53,6 +67,9 @@ void vec_mul_c16(cint16_t *pZ, int len, int radix, const cint16_t *pX,
  ******************************************************************************/
 bool test_vec_mul_c16(void)
 {
+    int n, k;
+    cint16_t ref;
+    static const int radix[5] = {8, 12, 14, 15, 13};
     cint16_t z[4];
     static cint16_t x[4] = {
         CONST_CPLX(0.75, 0.33),
@@ -80,6 +97,16 @@ bool test_vec_mul_c16(void)
     /* Check the correctness of the result */
     TEST_LIBS_CHECK_RES_CPLX(z, res, 4, flOk);
 
+    /* Radices specialised by 'CIMLIB_RADIX_SWITCH' and runtime one, scalar
+     * function is reference */
+    for (k = 0; k < 5; k++) {
+        vec_mul_c16(z, 4, radix[k], x, y);
+        for (n = 0; n < 4; n++) {
+            ref = sc_mul_c16(x[n], y[n], radix[k]);
+            flOk = flOk && (z[n].re == ref.re) && (z[n].im == ref.im);
+        }
+    }
+
     return flOk;
 }
 
@@ -11,6 +11,23 @@
 #include "cimlib.h"               /* Library header */
 
 
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Complex multiply loop with radix, it is specialised by
+ * 'CIMLIB_RADIX_SWITCH' */
+#define MUL_LOOP(R)                                                            \
+{                                                                              \
+    for (n = 0; n < len; n++) {                                                \
+        re = (int64_t)pX[n].re * pY[n].re - (int64_t)pX[n].im * pY[n].im;      \
+        im = (int64_t)pX[n].im * pY[n].re + (int64_t)pX[n].re * pY[n].im;      \
+        pZ[n].re = (int32_t)(re >> (R));                                       \
+        pZ[n].im = (int32_t)(im >> (R));                                       \
+    }                                                                          \
+}
+
+
 /* -----------------------------------------------------------------------------
  * Exported functions
  * ---------------------------------------------------------------------------*/
@@ -28,15 +45,12 @@
 void vec_mul_c32(cint32_t *pZ, int len, int radix, const cint32_t *pX,
                  const cint32_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_mul_c32, len);
     int n;
     int64_t re, im;
 
-    for (n = 0; n < len; n++) {
-        re = (int64_t)pX[n].re * pY[n].re - (int64_t)pX[n].im * pY[n].im;
-        im = (int64_t)pX[n].im * pY[n].re + (int64_t)pX[n].re * pY[n].im;
-        pZ[n].re = (int32_t)(re >> radix);
-        pZ[n].im = (int32_t)(im >> radix);
-    }
+    /* Immediate shifts for commonly used radices */
+    CIMLIB_RADIX_SWITCH(radix, MUL_LOOP);
 }
 
 
@@ -53,6 +67,9 @@ void vec_mul_c32(cint32_t *pZ, int len, int radix, const cint32_t *pX,
  ******************************************************************************/
 bool test_vec_mul_c32(void)
 {
+    int n, k;
+    cint32_t ref, yk[4];
+    static const int radix[4] = {24, 28, 30, 25};
     cint32_t z[4];
     static cint32_t x[4] = {
         CONST_CPLX(0.75, 0.33),
@@ -80,6 +97,21 @@ bool test_vec_mul_c32(void)
     /* Check the correctness of the result */
     TEST_LIBS_CHECK_RES_CPLX(z, res, 4, flOk);
 
+    /* Radices specialised by 'CIMLIB_RADIX_SWITCH' and runtime one, scalar
+     * function is reference, 'y' is scaled down, so accumulation does not
+     * overflow */
+    for (n = 0; n < 4; n++) {
+        yk[n].re = y[n].re / 16;
+        yk[n].im = y[n].im / 16;
+    }
+    for (k = 0; k < 4; k++) {
+        vec_mul_c32(z, 4, radix[k], x, yk);
+        for (n = 0; n < 4; n++) {
+            ref = sc_mul_c32(x[n], yk[n], radix[k]);
+            flOk = flOk && (z[n].re == ref.re) && (z[n].im == ref.im);
+        }
+    }
+
     return flOk;
 }
 
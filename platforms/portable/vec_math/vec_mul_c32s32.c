@@ -28,6 +28,7 @@
 void vec_mul_c32s32(cint32_t *pZ, int len, int radix, const cint32_t *pX,
                     const int32_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_mul_c32s32, len);
     int n;
     int64_t re, im;
 
@@ -28,6 +28,7 @@
 void vec_mul_cj_c16(cint16_t *pZ, int len, int radix, const cint16_t *pX,
                     const cint16_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_mul_cj_c16, len);
     int n;
     int32_t re, im;
 
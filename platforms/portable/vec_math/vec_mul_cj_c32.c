@@ -28,6 +28,7 @@
 void vec_mul_cj_c32(cint32_t *pZ, int len, int radix, const cint32_t *pX,
                     const cint32_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_mul_cj_c32, len);
     int n;
     int64_t re, im;
 
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates by element complex multiply of vector with
+ * constant and adds second vector to products in one pass,
+ * Z = X * cnst + Y (axpy), 32 bit complex, result is with saturation control.
+ *
+ * @param[out]  pZ     Pointer to output vector, 32 bit complex.
+ * @param[in]   len    Vector length.
+ * @param[in]   radix  Radix.
+ * @param[in]   pX     Pointer to input vector, 32 bit complex.
+ * @param[in]   cnst   Constant, 32 bit complex.
+ * @param[in]   pY     Pointer to input addend vector, 32 bit complex.
+ ******************************************************************************/
+void vec_mul_const_add_sat_c32(cint32_t *pZ, int len, int radix,
+                               const cint32_t *pX, cint32_t cnst,
+                               const cint32_t *pY)
+{
+    CIMLIB_PROF_FUNC(vec_mul_const_add_sat_c32, len);
+    int n;
+    int64_t re, im;
+
+    for (n = 0; n < len; n++) {
+        re = (int64_t)pX[n].re * cnst.re - (int64_t)pX[n].im * cnst.im;
+        im = (int64_t)pX[n].im * cnst.re + (int64_t)pX[n].re * cnst.im;
+        re = (re >> radix) + pY[n].re;
+        im = (im >> radix) + pY[n].im;
+        CIMLIB_SAT_INT(re, INT32_MAX, re);
+        CIMLIB_SAT_INT(im, INT32_MAX, im);
+        pZ[n].re = (int32_t)re;
+        pZ[n].im = (int32_t)im;
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX               (28)
+#define CONST(X)            CIMLIB_CONST_S32(X, RADIX)
+#define CONST_CPLX(RE, IM)  CIMLIB_CONST_C32(RE, IM, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'vec_mul_const_add_sat_c32' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_mul_const_add_sat_c32(void)
+{
+    cint32_t z[4];
+    static cint32_t x[4] = {
+        CONST_CPLX(1.5, 0.5),
+        CONST_CPLX(2.0, -1.0),
+        CONST_CPLX(-2.0, 0.25),
+        CONST_CPLX(3.0, 3.0)
+    };
+    static cint32_t cnst = CONST_CPLX(1.5, -0.5);
+    static cint32_t y[4] = {
+        CONST_CPLX(0.25, 1.0),
+        CONST_CPLX(-1.5, 0.5),
+        CONST_CPLX(4.0, 4.0),
+        CONST_CPLX(-0.75, -6.0)
+    };
+    static cint32_t res[4] = {
+        CONST_CPLX(2.7500000000E+00, 1.0000000000E+00),
+        CONST_CPLX(1.0000000000E+00, -2.0000000000E+00),
+        CONST_CPLX(1.1250000000E+00, 5.3750000000E+00),
+        CONST_CPLX(5.2500000000E+00, -3.0000000000E+00)
+    };
+    bool flOk = true;
+
+    /* Call 'vec_mul_const_add_sat_c32' function */
+    vec_mul_const_add_sat_c32(z, 4, RADIX, x, cnst, y);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_CPLX(z, res, 4, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates by element multiply of vector with constant and
+ * adds second vector to products in one pass, Z = X * cnst + Y (axpy),
+ * 16 bit signed, result is with saturation control.
+ *
+ * @param[out]  pZ     Pointer to output vector, 16 bit signed.
+ * @param[in]   len    Vector length.
+ * @param[in]   radix  Radix.
+ * @param[in]   pX     Pointer to input vector, 16 bit signed.
+ * @param[in]   cnst   Constant, 16 bit signed.
+ * @param[in]   pY     Pointer to input addend vector, 16 bit signed.
+ ******************************************************************************/
+void vec_mul_const_add_sat_s16(int16_t *pZ, int len, int radix,
+                               const int16_t *pX, int16_t cnst,
+                               const int16_t *pY)
+{
+    CIMLIB_PROF_FUNC(vec_mul_const_add_sat_s16, len);
+    int n;
+    int32_t tmp;
+
+    for (n = 0; n < len; n++) {
+        tmp = ((int32_t)pX[n] * cnst) >> radix;
+        tmp += pY[n];
+        CIMLIB_SAT_INT(tmp, INT16_MAX, tmp);
+        pZ[n] = (int16_t)tmp;
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX     (12)
+#define CONST(X)  CIMLIB_CONST_S16(X, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'vec_mul_const_add_sat_s16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_mul_const_add_sat_s16(void)
+{
+    int16_t z[4];
+    static int16_t x[4] = {
+        CONST(3.0), CONST(1.0), CONST(-0.5), CONST(-3.25)
+    };
+    static int16_t cnst = CONST(2.5);
+    static int16_t y[4] = {
+        CONST(0.75), CONST(-2.0), CONST(1.25), CONST(-0.5)
+    };
+    static int16_t res[4] = {
+        INT16_MAX, CONST(5.0000000000E-01), CONST(0.0000000000E+00), INT16_MIN
+    };
+    bool flOk = true;
+
+    /* Call 'vec_mul_const_add_sat_s16' function */
+    vec_mul_const_add_sat_s16(z, 4, RADIX, x, cnst, y);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(z, res, 4, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -28,6 +28,7 @@
 void vec_mul_const_c16(cint16_t *pY, int len, int radix, const cint16_t *pX,
                        cint16_t cnst)
 {
+    CIMLIB_PROF_FUNC(vec_mul_const_c16, len);
     int n;
     int32_t re, im;
 
@@ -28,6 +28,7 @@
 void vec_mul_const_c32(cint32_t *pY, int len, int radix, const cint32_t *pX,
                        cint32_t cnst)
 {
+    CIMLIB_PROF_FUNC(vec_mul_const_c32, len);
     int n;
     int64_t re, im;
 
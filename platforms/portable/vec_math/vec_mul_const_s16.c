@@ -28,6 +28,7 @@
 void vec_mul_const_s16(int16_t *pY, int len, int radix, const int16_t *pX,
                        int16_t cnst)
 {
+    CIMLIB_PROF_FUNC(vec_mul_const_s16, len);
     int n;
 
     for (n = 0; n < len; n++) {
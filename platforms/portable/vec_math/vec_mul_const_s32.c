@@ -28,6 +28,7 @@
 void vec_mul_const_s32(int32_t *pY, int len, int radix, const int32_t *pX,
                        int32_t cnst)
 {
+    CIMLIB_PROF_FUNC(vec_mul_const_s32, len);
     int n;
 
     for (n = 0; n < len; n++) {
@@ -27,6 +27,7 @@
 void vec_mul_long_s32(int64_t *pZ, int len, const int32_t *pX,
                       const int32_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_mul_long_s32, len);
     int n;
 
     for (n = 0; n < len; n++) {
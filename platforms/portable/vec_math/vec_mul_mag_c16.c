@@ -0,0 +1,98 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates by element complex multiply of input vectors and
+ * magnitude of products in one pass, Z = |X * Y|, 16 bit complex. Magnitude
+ * of product is calculated as square root of product of input squared
+ * magnitudes, so there is no intermediate rounding, result is with
+ * saturation control.
+ *
+ * @param[out]  pZ     Pointer to output vector, 16 bit unsigned.
+ * @param[in]   len    Vector length.
+ * @param[in]   radix  Radix.
+ * @param[in]   pX     Pointer to input vector, 16 bit complex.
+ * @param[in]   pY     Pointer to input vector, 16 bit complex.
+ ******************************************************************************/
+void vec_mul_mag_c16(uint16_t *pZ, int len, int radix, const cint16_t *pX,
+                     const cint16_t *pY)
+{
+    CIMLIB_PROF_FUNC(vec_mul_mag_c16, len);
+    int n;
+    uint32_t engX, engY, mag;
+
+    for (n = 0; n < len; n++) {
+        engX = (uint32_t)((int32_t)pX[n].re * pX[n].re) +
+               (uint32_t)((int32_t)pX[n].im * pX[n].im);
+        engY = (uint32_t)((int32_t)pY[n].re * pY[n].re) +
+               (uint32_t)((int32_t)pY[n].im * pY[n].im);
+        mag = sc_sqrt_u64_core((uint64_t)engX * engY) >> radix;
+        CIMLIB_SAT_UINT(mag, UINT16_MAX, mag);
+        pZ[n] = (uint16_t)mag;
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX               (10)
+#define CONST(X)            CIMLIB_CONST_U16(X, RADIX)
+#define CONST_CPLX(RE, IM)  CIMLIB_CONST_C16(RE, IM, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'vec_mul_mag_c16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_mul_mag_c16(void)
+{
+    uint16_t z[5];
+    static cint16_t x[5] = {
+        CONST_CPLX(2.1, 0.05),
+        CONST_CPLX(0.1, -0.05),
+        CONST_CPLX(-5.6, 3.001),
+        CONST_CPLX(3.14, 1.0),
+        {INT16_MIN, INT16_MIN}
+    };
+    static cint16_t y[5] = {
+        CONST_CPLX(1.5, -0.5),
+        CONST_CPLX(0.75, 0.25),
+        CONST_CPLX(-1.25, 0.0),
+        CONST_CPLX(0.5, 2.0),
+        CONST_CPLX(0.0, 1.0)
+    };
+    static uint16_t res[5] = {
+        CONST(3.3203125000E+00),
+        CONST(8.7890625000E-02),
+        CONST(7.9404296875E+00),
+        CONST(6.7919921875E+00),
+        46340
+    };
+    bool flOk = true;
+
+    /* Call 'vec_mul_mag_c16' function */
+    vec_mul_mag_c16(z, 5, RADIX, x, y);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(z, res, 5, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
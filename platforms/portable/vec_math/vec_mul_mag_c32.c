@@ -0,0 +1,176 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
+
+
+/* -----------------------------------------------------------------------------
+ * Local functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function multiplies two 64 bit unsigned values by 32 bit halves,
+ * result is with 128 bit precision.
+ *
+ * @param[in]  x  First value.
+ * @param[in]  y  Second value.
+ *
+ * @return        Product, 128 bit unsigned.
+ ******************************************************************************/
+static inline uint128_t vec_mul_mag_c32_mul(uint64_t x, uint64_t y)
+{
+    uint128_t z;
+    uint64_t ll, lh, hl, mid;
+
+    ll = (x & UINT32_MAX) * (y & UINT32_MAX);
+    lh = (x & UINT32_MAX) * (y >> 32);
+    hl = (x >> 32) * (y & UINT32_MAX);
+    mid = (ll >> 32) + (lh & UINT32_MAX) + (hl & UINT32_MAX);
+
+    z.lo = (mid << 32) | (ll & UINT32_MAX);
+    z.hi = (x >> 32) * (y >> 32) + (lh >> 32) + (hl >> 32) + (mid >> 32);
+
+    return z;
+}
+
+
+/*******************************************************************************
+ * This function calculates square root of 128 bit value, rounded down. Value
+ * is shifted right by even number of bits to 64 bits, its root gives upper
+ * bits of result, lower bits are found one by one.
+ *
+ * @param[in]  x  Value, less than 2^126.
+ *
+ * @return        Square root, 64 bit unsigned.
+ ******************************************************************************/
+static inline uint64_t vec_mul_mag_c32_sqrt(uint128_t x)
+{
+    int shift;
+    uint64_t y, t, s;
+    uint128_t sqr;
+
+    if (x.hi == 0) {
+        return sc_sqrt_u64_core(x.lo);
+    }
+
+    /* Upper bits by root of value shifted by 2 * 'shift' bits */
+    shift = (sc_log2_int_u64_core(x.hi) + 2) >> 1;
+    y = (uint64_t)sc_sqrt_u64_core((x.lo >> (2 * shift)) |
+                                   (x.hi << (64 - 2 * shift))) << shift;
+
+    for (s = (uint64_t)1 << (shift - 1); s > 0; s >>= 1) {
+        t = y + s;
+        sqr = sc_sqr_xlong_s64_core((int64_t)t);
+        if ((sqr.hi < x.hi) || ((sqr.hi == x.hi) && (sqr.lo <= x.lo))) {
+            y = t;
+        }
+    }
+
+    return y;
+}
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates by element complex multiply of input vectors and
+ * magnitude of products in one pass, Z = |X * Y|, 32 bit complex. Magnitude
+ * of product is square root of product of input energies, calculated with
+ * 128 bit precision, so it is rounded down once. Result is with saturation
+ * control.
+ *
+ * @param[out]  pZ     Pointer to output vector, 32 bit unsigned.
+ * @param[in]   len    Vector length.
+ * @param[in]   radix  Radix.
+ * @param[in]   pX     Pointer to input vector, 32 bit complex.
+ * @param[in]   pY     Pointer to input vector, 32 bit complex.
+ ******************************************************************************/
+void vec_mul_mag_c32(uint32_t *pZ, int len, int radix, const cint32_t *pX,
+                     const cint32_t *pY)
+{
+    CIMLIB_PROF_FUNC(vec_mul_mag_c32, len);
+    int n;
+    uint64_t engX, engY, mag;
+
+    for (n = 0; n < len; n++) {
+        engX = (uint64_t)((int64_t)pX[n].re * pX[n].re) +
+               (uint64_t)((int64_t)pX[n].im * pX[n].im);
+        engY = (uint64_t)((int64_t)pY[n].re * pY[n].re) +
+               (uint64_t)((int64_t)pY[n].im * pY[n].im);
+        mag = vec_mul_mag_c32_sqrt(vec_mul_mag_c32_mul(engX, engY)) >> radix;
+        CIMLIB_SAT_UINT(mag, UINT32_MAX, mag);
+        pZ[n] = (uint32_t)mag;
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX               (20)
+#define CONST(X)            CIMLIB_CONST_U32(X, RADIX)
+#define CONST_CPLX(RE, IM)  CIMLIB_CONST_C32(RE, IM, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'vec_mul_mag_c32' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_mul_mag_c32(void)
+{
+    uint32_t z[5];
+    static cint32_t x[5] = {
+        CONST_CPLX(2.1, 0.05),
+        CONST_CPLX(0.1, -0.05),
+        CONST_CPLX(-5.6, 3.001),
+        CONST_CPLX(3.14, 1.0),
+        {INT32_MIN, INT32_MIN}
+    };
+    static cint32_t y[5] = {
+        CONST_CPLX(1.5, -0.5),
+        CONST_CPLX(0.75, 0.25),
+        CONST_CPLX(-1.25, 0.0),
+        CONST_CPLX(0.5, 2.0),
+        CONST_CPLX(0.0, 1.0)
+    };
+    static uint32_t res[5] = {
+        CONST(3.3213329315E+00),
+        CONST(8.8388442993E-02),
+        CONST(7.9417810440E+00),
+        CONST(6.7936220169E+00),
+        3037000499u
+    };
+    static const cint32_t xBig[2] = {{INT32_MAX, INT32_MAX}, {INT32_MAX, 0}};
+    static const cint32_t yBig[2] = {{1, 1}, {3, 3}};
+    bool flOk = true;
+
+    /* Call 'vec_mul_mag_c32' function */
+    vec_mul_mag_c32(z, 5, RADIX, x, y);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(z, res, 5, flOk);
+
+    /* Large unequal magnitudes, reference is floor root of exact product of
+     * energies, product of rounded magnitudes is 3037000498 and 2147483647 */
+    vec_mul_mag_c32(z, 1, 0, xBig, yBig);
+    vec_mul_mag_c32(&z[1], 1, 2, &xBig[1], &yBig[1]);
+    flOk = flOk && (z[0] == 4294967294u) && (z[1] == 2277750373u);
+
+    /* The widest product is saturated */
+    vec_mul_mag_c32(z, 1, 31, &x[4], &x[4]);
+    flOk = flOk && (z[0] == UINT32_MAX);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -11,6 +11,20 @@
 #include "cimlib.h"               /* Library header */
 
 
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Multiply loop with radix, it is specialised by 'CIMLIB_RADIX_SWITCH' */
+#define MUL_LOOP(R)                                                            \
+{                                                                              \
+    for (n = 0; n < len; n++) {                                                \
+        tmp = (int32_t)pX[n] * pY[n];                                          \
+        pZ[n] = (int16_t)(tmp >> (R));                                         \
+    }                                                                          \
+}
+
+
 /* -----------------------------------------------------------------------------
  * Exported functions
  * ---------------------------------------------------------------------------*/
@@ -27,13 +41,12 @@
 void vec_mul_s16(int16_t *pZ, int len, int radix, const int16_t *pX,
                  const int16_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_mul_s16, len);
     int n;
     int32_t tmp;
 
-    for (n = 0; n < len; n++) {
-        tmp = (int32_t)pX[n] * pY[n];
-        pZ[n] = (int16_t)(tmp >> radix);
-    }
+    /* Immediate shifts for commonly used radices */
+    CIMLIB_RADIX_SWITCH(radix, MUL_LOOP);
 }
 
 
@@ -50,6 +63,8 @@ void vec_mul_s16(int16_t *pZ, int len, int radix, const int16_t *pX,
  ******************************************************************************/
 bool test_vec_mul_s16(void)
 {
+    int n, k;
+    static const int radix[5] = {8, 12, 14, 15, 13};
     int16_t z[4];
     static int16_t x[4] = {
         CONST(7.9), CONST(4.0), CONST(2.0), CONST(1.0)
@@ -71,6 +86,15 @@ bool test_vec_mul_s16(void)
     /* Check the correctness of the result */
     TEST_LIBS_CHECK_RES_REAL(z, res, 4, flOk);
 
+    /* Radices specialised by 'CIMLIB_RADIX_SWITCH' and runtime one, scalar
+     * function is reference */
+    for (k = 0; k < 5; k++) {
+        vec_mul_s16(z, 4, radix[k], x, y);
+        for (n = 0; n < 4; n++) {
+            flOk = flOk && (z[n] == sc_mul_s16(x[n], y[n], radix[k]));
+        }
+    }
+
     return flOk;
 }
 
@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates by element multiply of input vectors, 16 bit
+ * signed, aligned fast path version of 'vec_mul_s16' function. There is no
+ * peeling, compiler uses aligned vector loads and stores for blocks of
+ * 'CIMLIB_ALIGN_LEN' elements, tail is processed by scalar loop.
+ *
+ * Note: All pointers must be aligned to 'CIMLIB_ALIGN_BYTES' (e.g. allocated
+ *       by 'mem_arena_alloc'), vector length should be multiple of
+ *       'CIMLIB_ALIGN_LEN' to avoid the tail.
+ *
+ * @param[out]  pZ     Pointer to output vector, 16 bit signed.
+ * @param[in]   len    Vector length.
+ * @param[in]   radix  Radix.
+ * @param[in]   pX     Pointer to input vector, 16 bit signed.
+ * @param[in]   pY     Pointer to input vector, 16 bit signed.
+ ******************************************************************************/
+void vec_mul_s16_a(int16_t *pZ, int len, int radix, const int16_t *pX,
+                   const int16_t *pY)
+{
+    CIMLIB_PROF_FUNC(vec_mul_s16_a, len);
+    int n, lenBlk;
+
+    /* Aligned pointers, whole blocks first, so there is no tail in vector
+     * loop */
+    pZ = CIMLIB_ASSUME_ALIGNED(pZ);
+    pX = CIMLIB_ASSUME_ALIGNED(pX);
+    pY = CIMLIB_ASSUME_ALIGNED(pY);
+    lenBlk = len & ~(CIMLIB_ALIGN_LEN - 1);
+
+    for (n = 0; n < lenBlk; n++) {
+        pZ[n] = (int16_t)(((int32_t)pX[n] * pY[n]) >> radix);
+    }
+
+    /* Tail of length which is not multiple of block */
+    for (n = lenBlk; n < len; n++) {
+        pZ[n] = (int16_t)(((int32_t)pX[n] * pY[n]) >> radix);
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX     (15)
+
+/* Test vector length */
+#define TEST_LEN  (4 * CIMLIB_ALIGN_LEN)
+
+
+/*******************************************************************************
+ * This function tests 'vec_mul_s16_a' function. Returns 'true' if validation
+ * is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_mul_s16_a(void)
+{
+    int n;
+    mem_arena_t arena;
+    int16_t *pX, *pY, *pZ;
+    static int16_t res[TEST_LEN];
+    static uint8_t buf[4 * TEST_LEN * sizeof(int16_t)];
+    uint32_t seed = 1;
+    bool flOk = true;
+
+    /* Generate test vectors in aligned buffers */
+    mem_arena_init(&arena, buf, sizeof(buf));
+    pX = mem_arena_alloc(&arena, TEST_LEN * sizeof(int16_t));
+    pY = mem_arena_alloc(&arena, TEST_LEN * sizeof(int16_t));
+
+    for (n = 0; n < TEST_LEN; n++) {
+        seed = seed * 1103515245u + 12345u;
+        pX[n] = (int16_t)(seed >> 16);
+        seed = seed * 1103515245u + 12345u;
+        pY[n] = (int16_t)(seed >> 16);
+    }
+    pZ = mem_arena_alloc(&arena, TEST_LEN * sizeof(int16_t));
+
+    /* Call 'vec_mul_s16_a' function, 'vec_mul_s16' is reference */
+    vec_mul_s16_a(pZ, TEST_LEN, RADIX, pX, pY);
+    vec_mul_s16(res, TEST_LEN, RADIX, pX, pY);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(pZ, res, TEST_LEN, flOk);
+
+    /* Length which is not multiple of block, tail is processed too */
+    for (n = 0; n < TEST_LEN; n++) {
+        pZ[n] = 0;
+    }
+    vec_mul_s16_a(pZ, TEST_LEN - 3, RADIX, pX, pY);
+    TEST_LIBS_CHECK_RES_REAL(pZ, res, TEST_LEN - 3, flOk);
+    flOk = flOk && (pZ[TEST_LEN - 3] == 0);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -11,6 +11,19 @@
 #include "cimlib.h"               /* Library header */
 
 
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Multiply loop with radix, it is specialised by 'CIMLIB_RADIX_SWITCH' */
+#define MUL_LOOP(R)                                                            \
+{                                                                              \
+    for (n = 0; n < len; n++) {                                                \
+        pZ[n] = (int32_t)(((int64_t)pX[n] * pY[n]) >> (R));                    \
+    }                                                                          \
+}
+
+
 /* -----------------------------------------------------------------------------
  * Exported functions
  * ---------------------------------------------------------------------------*/
@@ -27,11 +40,11 @@
 void vec_mul_s32(int32_t *pZ, int len, int radix, const int32_t *pX,
                  const int32_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_mul_s32, len);
     int n;
 
-    for (n = 0; n < len; n++) {
-        pZ[n] = (int32_t)(((int64_t)pX[n] * pY[n]) >> radix);
-    }
+    /* Immediate shifts for commonly used radices */
+    CIMLIB_RADIX_SWITCH(radix, MUL_LOOP);
 }
 
 
@@ -48,6 +61,8 @@ void vec_mul_s32(int32_t *pZ, int len, int radix, const int32_t *pX,
  ******************************************************************************/
 bool test_vec_mul_s32(void)
 {
+    int n, k;
+    static const int radix[4] = {24, 28, 30, 25};
     int32_t z[4];
     static int32_t x[4] = {
         CONST(7.9), CONST(4.0), CONST(2.0), CONST(1.0)
@@ -69,6 +84,15 @@ bool test_vec_mul_s32(void)
     /* Check the correctness of the result */
     TEST_LIBS_CHECK_RES_REAL(z, res, 4, flOk);
 
+    /* Radices specialised by 'CIMLIB_RADIX_SWITCH' and runtime one, scalar
+     * function is reference */
+    for (k = 0; k < 4; k++) {
+        vec_mul_s32(z, 4, radix[k], x, y);
+        for (n = 0; n < 4; n++) {
+            flOk = flOk && (z[n] == sc_mul_s32(x[n], y[n], radix[k]));
+        }
+    }
+
     return flOk;
 }
 
@@ -28,6 +28,7 @@
 void vec_mul_sat_s16(int16_t *pZ, int len, int radix, const int16_t *pX,
                      const int16_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_mul_sat_s16, len);
     int n;
     int32_t tmp;
 
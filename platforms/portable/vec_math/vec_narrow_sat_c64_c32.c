@@ -0,0 +1,87 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function narrows vector from 64 bit to 32 bit complex, with rounding
+ * radix shift and saturation control, e.g. to convert 'vec_mac_long_c32'
+ * result back to 32 bit.
+ *
+ * @param[out]  pY     Pointer to output vector, 32 bit complex.
+ * @param[in]   len    Vector length.
+ * @param[in]   radix  Number of right shifts, [0..63].
+ * @param[in]   pX     Pointer to input vector, 64 bit complex.
+ ******************************************************************************/
+void vec_narrow_sat_c64_c32(cint32_t *pY, int len, int radix,
+                            const cint64_t *pX)
+{
+    CIMLIB_PROF_FUNC(vec_narrow_sat_c64_c32, len);
+    int n;
+    int64_t re, im;
+
+    for (n = 0; n < len; n++) {
+        re = pX[n].re >> radix;
+        im = pX[n].im >> radix;
+
+        /* Round by the last shifted out bit, can not overflow */
+        if (radix != 0) {
+            re += (pX[n].re >> (radix - 1)) & 1;
+            im += (pX[n].im >> (radix - 1)) & 1;
+        }
+
+        CIMLIB_SAT_INT(pY[n].re, INT32_MAX, re);
+        CIMLIB_SAT_INT(pY[n].im, INT32_MAX, im);
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX  (24)
+#define CONST_CPLX(RE, IM)  CIMLIB_CONST_C32(RE, IM, RADIX)
+#define CONST_CPLX_LONG(RE, IM)  CIMLIB_CONST_C64(RE, IM, RADIX * 2)
+
+
+/*******************************************************************************
+ * This function tests 'vec_narrow_sat_c64_c32' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_narrow_sat_c64_c32(void)
+{
+    cint32_t y[2];
+    static cint64_t x[2] = {
+        CONST_CPLX_LONG(-200.0, 0.25), CONST_CPLX_LONG(-0.75, 300.5)
+    };
+    static cint32_t res[2] = {
+        {INT32_MIN, 0}, {0, INT32_MAX}
+    };
+    bool flOk = true;
+
+    /* In range values */
+    res[0].im = CIMLIB_CONST_S32(0.25, RADIX);
+    res[1].re = CIMLIB_CONST_S32(-0.75, RADIX);
+
+    /* Call 'vec_narrow_sat_c64_c32' function */
+    vec_narrow_sat_c64_c32(y, 2, RADIX, x);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_CPLX(y, res, 2, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
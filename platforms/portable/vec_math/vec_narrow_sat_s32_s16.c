@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function narrows vector from 32 bit to 16 bit signed, with rounding
+ * radix shift and saturation control, e.g. to convert 'vec_mac_long_s16'
+ * result back to 16 bit.
+ *
+ * @param[out]  pY     Pointer to output vector, 16 bit signed.
+ * @param[in]   len    Vector length.
+ * @param[in]   radix  Number of right shifts, [0..31].
+ * @param[in]   pX     Pointer to input vector, 32 bit signed.
+ ******************************************************************************/
+void vec_narrow_sat_s32_s16(int16_t *pY, int len, int radix, const int32_t *pX)
+{
+    CIMLIB_PROF_FUNC(vec_narrow_sat_s32_s16, len);
+    int n;
+    int64_t tmp;
+    int64_t rnd = 0;
+
+    /* For correct rounding add half of radix */
+    if (radix != 0) {
+        rnd = ((int64_t)1 << (radix - 1));
+    }
+
+    for (n = 0; n < len; n++) {
+        tmp = ((int64_t)pX[n] + rnd) >> radix;
+        CIMLIB_SAT_INT(pY[n], INT16_MAX, tmp);
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX          (12)
+#define CONST(X)       CIMLIB_CONST_S16(X, RADIX)
+#define CONST_LONG(X)  CIMLIB_CONST_S32(X, RADIX * 2)
+
+
+/*******************************************************************************
+ * This function tests 'vec_narrow_sat_s32_s16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_narrow_sat_s32_s16(void)
+{
+    int16_t y[4];
+    static int32_t x[4] = {
+        CONST_LONG(-7.99), CONST_LONG(0.25), CONST_LONG(-0.75),
+        CONST_LONG(7.5)
+    };
+    static int16_t res[4] = {
+        INT16_MIN, CONST(0.25), CONST(-0.75), CONST(7.5)
+    };
+    bool flOk = true;
+
+    /* Saturated values */
+    x[0] = INT32_MIN;
+    x[3] = INT32_MAX;
+    res[3] = INT16_MAX;
+
+    /* Call 'vec_narrow_sat_s32_s16' function */
+    vec_narrow_sat_s32_s16(y, 4, RADIX, x);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(y, res, 4, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function narrows vector from 64 bit to 32 bit signed, with rounding
+ * radix shift and saturation control, e.g. to convert 'vec_mac_long_s32'
+ * result back to 32 bit.
+ *
+ * @param[out]  pY     Pointer to output vector, 32 bit signed.
+ * @param[in]   len    Vector length.
+ * @param[in]   radix  Number of right shifts, [0..63].
+ * @param[in]   pX     Pointer to input vector, 64 bit signed.
+ ******************************************************************************/
+void vec_narrow_sat_s64_s32(int32_t *pY, int len, int radix, const int64_t *pX)
+{
+    CIMLIB_PROF_FUNC(vec_narrow_sat_s64_s32, len);
+    int n;
+    int64_t tmp;
+
+    for (n = 0; n < len; n++) {
+        tmp = pX[n] >> radix;
+
+        /* Round by the last shifted out bit, can not overflow */
+        if (radix != 0) {
+            tmp += (pX[n] >> (radix - 1)) & 1;
+        }
+
+        CIMLIB_SAT_INT(pY[n], INT32_MAX, tmp);
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX          (24)
+#define CONST(X)       CIMLIB_CONST_S32(X, RADIX)
+#define CONST_LONG(X)  CIMLIB_CONST_S64(X, RADIX * 2)
+
+
+/*******************************************************************************
+ * This function tests 'vec_narrow_sat_s64_s32' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_narrow_sat_s64_s32(void)
+{
+    int32_t y[4];
+    static int64_t x[4] = {
+        CONST_LONG(-200.0), CONST_LONG(0.25), CONST_LONG(-0.75),
+        CONST_LONG(300.5)
+    };
+    static int32_t res[4] = {
+        INT32_MIN, CONST(0.25), CONST(-0.75), INT32_MAX
+    };
+    bool flOk = true;
+
+    /* Call 'vec_narrow_sat_s64_s32' function */
+    vec_narrow_sat_s64_s32(y, 4, RADIX, x);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(y, res, 4, flOk);
+
+    /* Extreme input values, rounding must not overflow */
+    x[0] = INT64_MIN;
+    x[3] = INT64_MAX;
+    vec_narrow_sat_s64_s32(y, 4, RADIX, x);
+    TEST_LIBS_CHECK_RES_REAL(y, res, 4, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
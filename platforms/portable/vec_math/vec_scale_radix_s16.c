@@ -26,6 +26,7 @@
  ******************************************************************************/
 void vec_scale_radix_s16(int16_t *pY, int len, int offset, const int16_t *pX)
 {
+    CIMLIB_PROF_FUNC(vec_scale_radix_s16, len);
     int n;
 
     if (offset > 0) {
@@ -26,6 +26,7 @@
  ******************************************************************************/
 void vec_scale_radix_s32(int32_t *pY, int len, int offset, const int32_t *pX)
 {
+    CIMLIB_PROF_FUNC(vec_scale_radix_s32, len);
     int n;
 
     if (offset > 0) {
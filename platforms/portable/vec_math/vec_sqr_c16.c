@@ -25,6 +25,7 @@
  ******************************************************************************/
 void vec_sqr_c16(uint16_t *pY, int len, int radix, const cint16_t *pX)
 {
+    CIMLIB_PROF_FUNC(vec_sqr_c16, len);
     int n;
     uint32_t tmp;
 
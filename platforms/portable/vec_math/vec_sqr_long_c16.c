@@ -25,6 +25,7 @@
  ******************************************************************************/
 void vec_sqr_long_c16(uint32_t *pY, int len, const cint16_t *pX)
 {
+    CIMLIB_PROF_FUNC(vec_sqr_long_c16, len);
     int n;
     uint32_t tmp;
 
@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates square of each element of vector, 16 bit complex,
+ * planar (split real and imaginary parts) form, result with extended
+ * precision.
+ *
+ * @param[out]  pY    Pointer to output vector, 32 bit unsigned.
+ * @param[in]   len   Vector length.
+ * @param[in]   pXRe  Pointer to input vector, real part, 16 bit signed.
+ * @param[in]   pXIm  Pointer to input vector, imaginary part, 16 bit signed.
+ ******************************************************************************/
+void vec_sqr_long_c16p(uint32_t *pY, int len, const int16_t *pXRe,
+                       const int16_t *pXIm)
+{
+    CIMLIB_PROF_FUNC(vec_sqr_long_c16p, len);
+    int n;
+    uint32_t tmp;
+
+    for (n = 0; n < len; n++) {
+        tmp = (uint32_t)pXRe[n] * pXRe[n];
+        tmp += (uint32_t)pXIm[n] * pXIm[n];
+        pY[n] = tmp;
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX               (12)
+#define CONST_CPLX(RE, IM)  CIMLIB_CONST_C16(RE, IM, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'vec_sqr_long_c16p' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_sqr_long_c16p(void)
+{
+    int n;
+    uint32_t z[4], res[4];
+    int16_t xRe[4], xIm[4];
+    static cint16_t x[4] = {
+        CONST_CPLX(0.75, 0.33), CONST_CPLX(-0.75, 0.33),
+        CONST_CPLX(0.5, -0.25), CONST_CPLX(-0.125, -0.9)
+    };
+    bool flOk = true;
+
+    /* Split input vector into planar form */
+    for (n = 0; n < 4; n++) {
+        xRe[n] = x[n].re;
+        xIm[n] = x[n].im;
+    }
+
+    /* Call 'vec_sqr_long_c16p' function, interleaved version is reference */
+    vec_sqr_long_c16p(z, 4, xRe, xIm);
+    vec_sqr_long_c16(res, 4, x);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(z, res, 4, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -25,6 +25,7 @@
  ******************************************************************************/
 void vec_sqr_long_s16(uint32_t *pY, int len, const int16_t *pX)
 {
+    CIMLIB_PROF_FUNC(vec_sqr_long_s16, len);
     int n;
 
     for (n = 0; n < len; n++) {
@@ -25,6 +25,7 @@
  ******************************************************************************/
 void vec_sqr_long_s32(uint64_t *pY, int len, const int32_t *pX)
 {
+    CIMLIB_PROF_FUNC(vec_sqr_long_s32, len);
     int n;
 
     for (n = 0; n < len; n++) {
@@ -26,6 +26,7 @@
  ******************************************************************************/
 void vec_sqr_sat_s16(uint16_t *pY, int len, int radix, const int16_t *pX)
 {
+    CIMLIB_PROF_FUNC(vec_sqr_sat_s16, len);
     int n;
     uint32_t tmp;
 
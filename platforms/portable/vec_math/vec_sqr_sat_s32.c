@@ -26,6 +26,7 @@
  ******************************************************************************/
 void vec_sqr_sat_s32(uint32_t *pY, int len, int radix, const int32_t *pX)
 {
+    CIMLIB_PROF_FUNC(vec_sqr_sat_s32, len);
     int n;
     uint64_t tmp;
 
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates square of each element of vector, 64 bit signed,
+ * result with saturation control. Square is calculated with 128 bit
+ * precision, so only radix shifted result is saturated.
+ *
+ * @param[out]  pY     Pointer to output vector, 64 bit unsigned.
+ * @param[in]   len    Vector length.
+ * @param[in]   radix  Radix, [0..63].
+ * @param[in]   pX     Pointer to input vector, 64 bit signed.
+ ******************************************************************************/
+void vec_sqr_sat_s64(uint64_t *pY, int len, int radix, const int64_t *pX)
+{
+    CIMLIB_PROF_FUNC(vec_sqr_sat_s64, len);
+    int n;
+    uint128_t sqr;
+
+    for (n = 0; n < len; n++) {
+        sqr = sc_sqr_xlong_s64_core(pX[n]);
+
+        /* Radix shift of 128 bit value */
+        if (radix != 0) {
+            sqr.lo = (sqr.lo >> radix) | (sqr.hi << (64 - radix));
+            sqr.hi >>= radix;
+        }
+
+        CIMLIB_SAT_UINT128(pY[n], sqr);
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX  (40)
+#define CONST(X)  CIMLIB_CONST_S64(X, RADIX)
+#define CONST_LONG(X)  CIMLIB_CONST_U64(X, RADIX)
+#define CONST_CPLX(RE, IM)  CIMLIB_CONST_C64(RE, IM, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'vec_sqr_sat_s64' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_sqr_sat_s64(void)
+{
+    uint64_t y[4];
+    static int64_t x[4] = {
+        CONST(0.5), CONST(-5.0), CONST(-1000.0), CONST(3000000.0)
+    };
+    static uint64_t res[4] = {
+        CONST_LONG(0.25), CONST_LONG(25.0), CONST_LONG(1000000.0), UINT64_MAX
+    };
+    bool flOk = true;
+
+    /* Call 'vec_sqr_sat_s64' function */
+    vec_sqr_sat_s64(y, 4, RADIX, x);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(y, res, 4, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
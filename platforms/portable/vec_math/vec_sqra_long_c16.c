@@ -26,6 +26,7 @@
  ******************************************************************************/
 void vec_sqra_long_c16(uint32_t *pYAcc, int len, const cint16_t *pX)
 {
+    CIMLIB_PROF_FUNC(vec_sqra_long_c16, len);
     int n;
     uint32_t tmp;
 
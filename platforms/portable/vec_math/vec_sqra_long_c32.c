@@ -26,6 +26,7 @@
  ******************************************************************************/
 void vec_sqra_long_c32(uint64_t *pYAcc, int len, const cint32_t *pX)
 {
+    CIMLIB_PROF_FUNC(vec_sqra_long_c32, len);
     int n;
     uint64_t tmp;
 
@@ -26,6 +26,7 @@
  ******************************************************************************/
 void vec_sqra_long_s16(uint32_t *pYAcc, int len, const int16_t *pX)
 {
+    CIMLIB_PROF_FUNC(vec_sqra_long_s16, len);
     int n;
 
     for (n = 0; n < len; n++) {
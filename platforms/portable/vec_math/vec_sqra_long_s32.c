@@ -26,6 +26,7 @@
  ******************************************************************************/
 void vec_sqra_long_s32(uint64_t *pYAcc, int len, const int32_t *pX)
 {
+    CIMLIB_PROF_FUNC(vec_sqra_long_s32, len);
     int n;
 
     for (n = 0; n < len; n++) {
@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Number of elements processed together */
+#define GRP_LEN  (8)
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates square root of each element of vector, 64 bit
+ * unsigned, result is rounded down. Elements are processed by groups, result
+ * bits are found from high to low one for all elements of group, without
+ * branches, so compiler keeps group in registers or vectorises it. Result is
+ * the same as of 'sc_sqrt_u64' function.
+ *
+ * @param[out]  pY   Pointer to output vector, 32 bit unsigned.
+ * @param[in]   len  Vector length.
+ * @param[in]   pX   Pointer to input vector, 64 bit unsigned.
+ ******************************************************************************/
+void vec_sqrt_u64(uint32_t *pY, int len, const uint64_t *pX)
+{
+    CIMLIB_PROF_FUNC(vec_sqrt_u64, len);
+    int n, k, lenGrp;
+    uint32_t t, bit;
+    uint32_t y[GRP_LEN];
+    uint64_t x[GRP_LEN];
+
+    for (n = 0; n < len; n += lenGrp) {
+        lenGrp = (len - n < GRP_LEN) ? (len - n) : GRP_LEN;
+
+        /* Load group, tail is padded by zeros */
+        for (k = 0; k < GRP_LEN; k++) {
+            x[k] = (k < lenGrp) ? pX[n + k] : 0;
+            y[k] = 0;
+        }
+
+        /* Set result bits */
+        for (bit = 1u << 31; bit != 0; bit >>= 1) {
+            for (k = 0; k < GRP_LEN; k++) {
+                t = y[k] | bit;
+                y[k] = ((uint64_t)t * t <= x[k]) ? t : y[k];
+            }
+        }
+
+        for (k = 0; k < lenGrp; k++) {
+            pY[n + k] = y[k];
+        }
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Test vector length, not multiple of group length */
+#define LEN  (61)
+
+
+/*******************************************************************************
+ * This function tests 'vec_sqrt_u64' function. Returns 'true' if validation
+ * is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_sqrt_u64(void)
+{
+    int n;
+    uint64_t x[LEN];
+    uint32_t y[LEN], res[LEN];
+    uint64_t seed = 12345u;
+    bool flOk = true;
+
+    /* Edge values and pseudo random values of different magnitudes */
+    x[0] = 0;
+    x[1] = 2;
+    x[2] = 3;
+    x[3] = UINT64_MAX;
+    x[4] = (uint64_t)UINT32_MAX * UINT32_MAX;
+    x[5] = (uint64_t)UINT32_MAX * UINT32_MAX - 1;
+    for (n = 6; n < LEN; n++) {
+        seed = seed * 6364136223846793005u + 1442695040888963407u;
+        x[n] = seed >> (n - 6);
+    }
+
+    for (n = 0; n < LEN; n++) {
+        res[n] = sc_sqrt_u64(x[n]);
+    }
+
+    /* Call 'vec_sqrt_u64' function */
+    vec_sqrt_u64(y, LEN, x);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(y, res, LEN, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
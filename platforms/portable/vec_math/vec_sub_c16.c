@@ -26,6 +26,7 @@
  ******************************************************************************/
 void vec_sub_c16(cint16_t *pZ, int len, const cint16_t *pX, const cint16_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_sub_c16, len);
     int n;
 
     for (n = 0; n < len; n++) {
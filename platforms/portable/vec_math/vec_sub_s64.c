@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates by element subtraction of two vectors, 64 bit
+ * signed.
+ *
+ * @param[out]  pZ   Pointer to output vector, 64 bit signed.
+ * @param[in]   len  Vector length.
+ * @param[in]   pX   Pointer to input vector, 64 bit signed.
+ * @param[in]   pY   Pointer to input vector, 64 bit signed.
+ ******************************************************************************/
+void vec_sub_s64(int64_t *pZ, int len, const int64_t *pX, const int64_t *pY)
+{
+    CIMLIB_PROF_FUNC(vec_sub_s64, len);
+    int n;
+
+    for (n = 0; n < len; n++) {
+        pZ[n] = pX[n] - pY[n];
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX  (40)
+#define CONST(X)  CIMLIB_CONST_S64(X, RADIX)
+#define CONST_CPLX(RE, IM)  CIMLIB_CONST_C64(RE, IM, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'vec_sub_s64' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_sub_s64(void)
+{
+    int64_t z[4];
+    static int64_t x[4] = {
+        CONST(-7.1), CONST(0.1), CONST(5.6), CONST(3.14)
+    };
+    static int64_t y[4] = {
+        CONST(-7.1), CONST(0.1), CONST(5.6), CONST(3.14)
+    };
+    static int64_t res[4] = {
+        0, 0, 0, 0
+    };
+    bool flOk = true;
+
+    /* Call 'vec_sub_s64' function */
+    vec_sub_s64(z, 4, x, y);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(z, res, 4, flOk);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -27,6 +27,7 @@
 void vec_sub_sat_c32(cint32_t *pZ, int len, const cint32_t *pX,
                      const cint32_t *pY)
 {
+    CIMLIB_PROF_FUNC(vec_sub_sat_c32, len);
     int n;
     int64_t re, im;
 
@@ -25,6 +25,7 @@
  ******************************************************************************/
 cint32_t vec_sum_c16(const cint16_t *pX, int len)
 {
+    CIMLIB_PROF_FUNC(vec_sum_c16, len);
     int n;
     cint32_t acc;
     int32_t accRe = 0;
@@ -25,6 +25,7 @@
  ******************************************************************************/
 cint64_t vec_sum_c32(const cint32_t *pX, int len)
 {
+    CIMLIB_PROF_FUNC(vec_sum_c32, len);
     int n;
     cint64_t acc;
     int64_t accRe = 0;
@@ -0,0 +1,83 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates sum of vector, 64 bit complex.
+ *
+ * Note: Accumulators are 64 bit, so sum must be in range of 64 bit signed.
+ *
+ * @param[in]  pX   Pointer to input vector, 64 bit complex.
+ * @param[in]  len  Vector length.
+ *
+ * @return          Sum of vector, 64 bit complex.
+ ******************************************************************************/
+cint64_t vec_sum_c64(const cint64_t *pX, int len)
+{
+    CIMLIB_PROF_FUNC(vec_sum_c64, len);
+    int n;
+    cint64_t acc;
+    int64_t accRe = 0;
+    int64_t accIm = 0;
+
+    for (n = 0; n < len; n++) {
+        accRe += pX[n].re;
+        accIm += pX[n].im;
+    }
+
+    acc.re = accRe;
+    acc.im = accIm;
+
+    return acc;
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX  (40)
+#define CONST(X)  CIMLIB_CONST_S64(X, RADIX)
+#define CONST_CPLX(RE, IM)  CIMLIB_CONST_C64(RE, IM, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'vec_sum_c64' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_sum_c64(void)
+{
+    cint64_t y;
+    static cint64_t in[4] = {
+        CONST_CPLX(2.1, 0.05),
+        CONST_CPLX(-2.1, -0.05),
+        CONST_CPLX(-5.6, 3.0),
+        CONST_CPLX(1000.0, -3.0)
+    };
+    static cint64_t res = CONST_CPLX(994.4, 0.0);
+    bool flOk = true;
+
+    /* Call 'vec_sum_c64' function */
+    y = vec_sum_c64(in, 4);
+
+    /* Check the correctness of the results */
+    if ((y.re != res.re) || (y.im != res.im)) {
+        flOk = false;
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
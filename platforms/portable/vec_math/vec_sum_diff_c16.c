@@ -27,6 +27,7 @@
  ******************************************************************************/
 cint32_t vec_sum_diff_c16(const cint16_t *pX, const cint16_t *pY, int len)
 {
+    CIMLIB_PROF_FUNC(vec_sum_diff_c16, len);
     int n;
     cint32_t acc = {0, 0};
 
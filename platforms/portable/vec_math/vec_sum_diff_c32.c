@@ -27,6 +27,7 @@
  ******************************************************************************/
 cint64_t vec_sum_diff_c32(const cint32_t *pX, const cint32_t *pY, int len)
 {
+    CIMLIB_PROF_FUNC(vec_sum_diff_c32, len);
     int n;
     cint64_t acc = {0, 0};
 
@@ -27,6 +27,7 @@
  ******************************************************************************/
 int64_t vec_sum_diff_s32(const int32_t *pX, const int32_t *pY, int len)
 {
+    CIMLIB_PROF_FUNC(vec_sum_diff_s32, len);
     int n;
     int64_t acc = 0;
 
@@ -9,6 +9,7 @@
  * Includes
  * ---------------------------------------------------------------------------*/
 #include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
 
 
 /* -----------------------------------------------------------------------------
@@ -26,13 +27,14 @@
  ******************************************************************************/
 uint32_t vec_sum_mag_c16(const cint16_t *pX, int len)
 {
+    CIMLIB_PROF_FUNC(vec_sum_mag_c16, len);
     int n;
     uint32_t eng;
     uint32_t acc = 0;
 
     for (n = 0; n < len; n++) {
         eng = (uint32_t)pX[n].re * pX[n].re + (uint32_t)pX[n].im * pX[n].im;
-        acc += sc_sqrt_u32(eng);
+        acc += sc_sqrt_u32_core(eng);
     }
 
     return acc;
@@ -9,6 +9,7 @@
  * Includes
  * ---------------------------------------------------------------------------*/
 #include "cimlib.h"               /* Library header */
+#include "sc_core.h"              /* Scalar cores */
 
 
 /* -----------------------------------------------------------------------------
@@ -27,13 +28,14 @@
  ******************************************************************************/
 uint64_t vec_sum_mag_c32(const cint32_t *pX, int len)
 {
+    CIMLIB_PROF_FUNC(vec_sum_mag_c32, len);
     int n;
     uint64_t eng;
     uint64_t acc = 0;
 
     for (n = 0; n < len; n++) {
         eng = (uint64_t)pX[n].re * pX[n].re + (uint64_t)pX[n].im * pX[n].im;
-        acc += sc_sqrt_u64(eng);
+        acc += sc_sqrt_u64_core(eng);
     }
 
     return acc;
@@ -29,6 +29,7 @@
 cint32_t vec_sum_mul_c16s16(const cint16_t *pX, const int16_t *pY, int len,
                             int radix)
 {
+    CIMLIB_PROF_FUNC(vec_sum_mul_c16s16, len);
     int n;
     cint32_t acc;
     int32_t accRe = 0;
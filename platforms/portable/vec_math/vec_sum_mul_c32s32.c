@@ -29,6 +29,7 @@
 cint64_t vec_sum_mul_c32s32(const cint32_t *pX, const int32_t *pY, int len,
                             int radix)
 {
+    CIMLIB_PROF_FUNC(vec_sum_mul_c32s32, len);
     int n;
     cint64_t acc;
     int64_t accRe = 0;
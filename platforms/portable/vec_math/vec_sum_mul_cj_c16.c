@@ -29,6 +29,7 @@
 cint32_t vec_sum_mul_cj_c16(const cint16_t *pX, const cint16_t *pY, int len,
                             int radix)
 {
+    CIMLIB_PROF_FUNC(vec_sum_mul_cj_c16, len);
     int n;
     cint32_t acc;
     int32_t accRe = 0;
@@ -0,0 +1,105 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates sum of complex conjugate multiplies of vectors,
+ * 16 bit complex, planar (split real and imaginary parts) form.
+ *
+ * @param[in]  pXRe   Pointer to input vector, real part, 16 bit signed.
+ * @param[in]  pXIm   Pointer to input vector, imaginary part, 16 bit signed.
+ * @param[in]  pYRe   Pointer to input vector, real part, 16 bit signed.
+ * @param[in]  pYIm   Pointer to input vector, imaginary part, 16 bit signed.
+ * @param[in]  len    Vector length.
+ * @param[in]  radix  Radix.
+ *
+ * @return            Sum of complex conjugate multiplies, 32 bit complex.
+ ******************************************************************************/
+cint32_t vec_sum_mul_cj_c16p(const int16_t *pXRe, const int16_t *pXIm,
+                             const int16_t *pYRe, const int16_t *pYIm, int len,
+                             int radix)
+{
+    CIMLIB_PROF_FUNC(vec_sum_mul_cj_c16p, len);
+    int n;
+    cint32_t acc;
+    int32_t accRe = 0;
+    int32_t accIm = 0;
+
+    /* For correct rounding add half of radix */
+    if (radix != 0) {
+        accRe = ((int32_t)1 << (radix - 1));
+        accIm = ((int32_t)1 << (radix - 1));
+    }
+
+    for (n = 0; n < len; n++) {
+        accRe += (int32_t)pXRe[n] * pYRe[n] + (int32_t)pXIm[n] * pYIm[n];
+        accIm += (int32_t)pXIm[n] * pYRe[n] - (int32_t)pXRe[n] * pYIm[n];
+    }
+
+    acc.re = accRe >> radix;
+    acc.im = accIm >> radix;
+
+    return acc;
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX               (14)
+#define CONST_CPLX(RE, IM)  CIMLIB_CONST_C16(RE, IM, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'vec_sum_mul_cj_c16p' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_sum_mul_cj_c16p(void)
+{
+    int n;
+    cint32_t z, res;
+    int16_t xRe[4], xIm[4], yRe[4], yIm[4];
+    static cint16_t x[4] = {
+        CONST_CPLX(0.75, 0.33), CONST_CPLX(-0.75, 0.33),
+        CONST_CPLX(0.5, -0.25), CONST_CPLX(-0.125, -0.9)
+    };
+    static cint16_t y[4] = {
+        CONST_CPLX(0.33, 0.75), CONST_CPLX(0.33, -0.75),
+        CONST_CPLX(-0.33, 0.75), CONST_CPLX(-0.33, -0.75)
+    };
+    bool flOk = true;
+
+    /* Split input vectors into planar form */
+    for (n = 0; n < 4; n++) {
+        xRe[n] = x[n].re;
+        xIm[n] = x[n].im;
+        yRe[n] = y[n].re;
+        yIm[n] = y[n].im;
+    }
+
+    /* Call 'vec_sum_mul_cj_c16p' function, interleaved version is reference */
+    z = vec_sum_mul_cj_c16p(xRe, xIm, yRe, yIm, 4, RADIX);
+    res = vec_sum_mul_cj_c16(x, y, 4, RADIX);
+
+    /* Check the correctness of the result */
+    if ((z.re != res.re) || (z.im != res.im)) {
+        flOk = false;
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -28,6 +28,7 @@
 int32_t vec_sum_mul_s16(const int16_t *pX, const int16_t *pY, int len,
                         int radix)
 {
+    CIMLIB_PROF_FUNC(vec_sum_mul_s16, len);
     int n;
     int32_t acc = 0;
 
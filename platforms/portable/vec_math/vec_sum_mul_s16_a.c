@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates sum of multiplies of vectors, 16 bit signed,
+ * aligned fast path version of 'vec_sum_mul_s16' function. There is no
+ * peeling, compiler uses aligned vector loads for blocks of
+ * 'CIMLIB_ALIGN_LEN' elements, tail is processed by scalar loop.
+ *
+ * Note: All pointers must be aligned to 'CIMLIB_ALIGN_BYTES' (e.g. allocated
+ *       by 'mem_arena_alloc'), vector length should be multiple of
+ *       'CIMLIB_ALIGN_LEN' to avoid the tail.
+ *
+ * @param[in]  pX     Pointer to input vector, 16 bit signed.
+ * @param[in]  pY     Pointer to input vector, 16 bit signed.
+ * @param[in]  len    Vector length.
+ * @param[in]  radix  Radix.
+ *
+ * @return            Sum of multiplies, 32 bit signed.
+ ******************************************************************************/
+int32_t vec_sum_mul_s16_a(const int16_t *pX, const int16_t *pY, int len,
+                          int radix)
+{
+    CIMLIB_PROF_FUNC(vec_sum_mul_s16_a, len);
+    int n, lenBlk;
+    uint32_t sum = 0;
+
+    /* Aligned pointers, whole blocks first, so there is no tail in vector
+     * loop */
+    pX = CIMLIB_ASSUME_ALIGNED(pX);
+    pY = CIMLIB_ASSUME_ALIGNED(pY);
+    lenBlk = len & ~(CIMLIB_ALIGN_LEN - 1);
+
+    /* For correct rounding add half of radix */
+    if (radix != 0) {
+        sum = ((uint32_t)1 << (radix - 1));
+    }
+
+    /* Sum modulo 2^32, compiler keeps vector of partial sums */
+    for (n = 0; n < lenBlk; n++) {
+        sum += (uint32_t)((int32_t)pX[n] * pY[n]);
+    }
+
+    /* Tail of length which is not multiple of block */
+    for (n = lenBlk; n < len; n++) {
+        sum += (uint32_t)((int32_t)pX[n] * pY[n]);
+    }
+
+    return (int32_t)sum >> radix;
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX     (15)
+
+/* Test vector length */
+#define TEST_LEN  (4 * CIMLIB_ALIGN_LEN)
+
+
+/*******************************************************************************
+ * This function tests 'vec_sum_mul_s16_a' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_sum_mul_s16_a(void)
+{
+    int n;
+    int32_t z, res;
+    mem_arena_t arena;
+    int16_t *pX, *pY;
+    static uint8_t buf[3 * TEST_LEN * sizeof(int16_t)];
+    uint32_t seed = 1;
+    bool flOk = true;
+
+    /* Generate test vectors in aligned buffers */
+    mem_arena_init(&arena, buf, sizeof(buf));
+    pX = mem_arena_alloc(&arena, TEST_LEN * sizeof(int16_t));
+    pY = mem_arena_alloc(&arena, TEST_LEN * sizeof(int16_t));
+
+    for (n = 0; n < TEST_LEN; n++) {
+        seed = seed * 1103515245u + 12345u;
+        pX[n] = (int16_t)((int32_t)(seed >> 20) - 2048);
+        seed = seed * 1103515245u + 12345u;
+        pY[n] = (int16_t)((int32_t)(seed >> 20) - 2048);
+    }
+
+    /* Call 'vec_sum_mul_s16_a' function, 'vec_sum_mul_s16' is reference */
+    z = vec_sum_mul_s16_a(pX, pY, TEST_LEN, RADIX);
+    res = vec_sum_mul_s16(pX, pY, TEST_LEN, RADIX);
+
+    /* Check the correctness of the results */
+    if (z != res) {
+        flOk = false;
+        printf("out = %ld; ref = %ld;\n", (long)z, (long)res);
+    }
+
+    /* Length which is not multiple of block, tail is summed too */
+    z = vec_sum_mul_s16_a(pX, pY, TEST_LEN - 3, RADIX);
+    res = vec_sum_mul_s16(pX, pY, TEST_LEN - 3, RADIX);
+    flOk = flOk && (z == res);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -28,6 +28,7 @@
 int64_t vec_sum_mul_s32(const int32_t *pX, const int32_t *pY, int len,
                         int radix)
 {
+    CIMLIB_PROF_FUNC(vec_sum_mul_s32, len);
     int n;
     int64_t acc = 0;
 
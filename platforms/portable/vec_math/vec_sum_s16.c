@@ -25,6 +25,7 @@
  ******************************************************************************/
 int32_t vec_sum_s16(const int16_t *pX, int len)
 {
+    CIMLIB_PROF_FUNC(vec_sum_s16, len);
     int n;
     int32_t acc = 0;
 
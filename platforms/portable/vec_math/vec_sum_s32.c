@@ -25,6 +25,7 @@
  ******************************************************************************/
 int64_t vec_sum_s32(const int32_t *pX, int len)
 {
+    CIMLIB_PROF_FUNC(vec_sum_s32, len);
     int n;
     int64_t acc = 0;
 
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates sum of vector, 64 bit signed.
+ *
+ * Note: Accumulator is 64 bit, so sum must be in range of 64 bit signed.
+ *
+ * @param[in]  pX   Pointer to input vector, 64 bit signed.
+ * @param[in]  len  Vector length.
+ *
+ * @return          Sum of vector, 64 bit signed.
+ ******************************************************************************/
+int64_t vec_sum_s64(const int64_t *pX, int len)
+{
+    CIMLIB_PROF_FUNC(vec_sum_s64, len);
+    int n;
+    int64_t acc = 0;
+
+    for (n = 0; n < len; n++) {
+        acc += pX[n];
+    }
+
+    return acc;
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX  (40)
+#define CONST(X)  CIMLIB_CONST_S64(X, RADIX)
+#define CONST_CPLX(RE, IM)  CIMLIB_CONST_C64(RE, IM, RADIX)
+
+
+/*******************************************************************************
+ * This function tests 'vec_sum_s64' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_sum_s64(void)
+{
+    int64_t y;
+    static int64_t in[4] = {
+        CONST(2.1), CONST(-2.1), CONST(-5.6), CONST(1000.0)
+    };
+    static int64_t res = CONST(994.4);
+    bool flOk = true;
+
+    /* Call 'vec_sum_s64' function */
+    y = vec_sum_s64(in, 4);
+
+    /* Check the correctness of the results */
+    if (y != res) {
+        flOk = false;
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
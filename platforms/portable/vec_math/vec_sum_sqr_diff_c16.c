@@ -30,6 +30,7 @@
 uint32_t vec_sum_sqr_diff_c16(const cint16_t *pX, const cint16_t *pY, int len,
                               int radix)
 {
+    CIMLIB_PROF_FUNC(vec_sum_sqr_diff_c16, len);
     int n;
     int16_t diff_re, diff_im;
     uint32_t acc = 0;
@@ -30,6 +30,7 @@
 uint64_t vec_sum_sqr_diff_c32(const cint32_t *pX, const cint32_t *pY, int len,
                               int radix)
 {
+    CIMLIB_PROF_FUNC(vec_sum_sqr_diff_c32, len);
     int n;
     int32_t diff_re, diff_im;
     uint64_t acc = 0;
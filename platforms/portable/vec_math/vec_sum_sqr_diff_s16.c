@@ -30,6 +30,7 @@
 uint32_t vec_sum_sqr_diff_s16(const int16_t *pX, const int16_t *pY, int len,
                               int radix)
 {
+    CIMLIB_PROF_FUNC(vec_sum_sqr_diff_s16, len);
     int n;
     int16_t diff;
     uint32_t acc = 0;
@@ -30,6 +30,7 @@
 uint64_t vec_sum_sqr_diff_s32(const int32_t *pX, const int32_t *pY, int len,
                               int radix)
 {
+    CIMLIB_PROF_FUNC(vec_sum_sqr_diff_s32, len);
     int n;
     int32_t diff;
     uint64_t acc = 0;
@@ -26,6 +26,7 @@
  ******************************************************************************/
 uint32_t vec_sum_sqr_long_s16(const int16_t *pX, int len)
 {
+    CIMLIB_PROF_FUNC(vec_sum_sqr_long_s16, len);
     int n;
     uint32_t acc = 0;
 
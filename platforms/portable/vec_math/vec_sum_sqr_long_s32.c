@@ -26,6 +26,7 @@
  ******************************************************************************/
 uint64_t vec_sum_sqr_long_s32(const int32_t *pX, int len)
 {
+    CIMLIB_PROF_FUNC(vec_sum_sqr_long_s32, len);
     int n;
     uint64_t acc = 0;
 
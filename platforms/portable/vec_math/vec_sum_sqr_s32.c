@@ -26,6 +26,7 @@
  ******************************************************************************/
 uint64_t vec_sum_sqr_s32(const int32_t *pX, int len, int radix)
 {
+    CIMLIB_PROF_FUNC(vec_sum_sqr_s32, len);
     int n;
     uint64_t acc = 0;
 
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function calculates sum of squares of vector, 32 bit signed,
+ * result with 128 bit precision. Unlike 'vec_sum_sqr_long_s32' function,
+ * accumulator can not wrap for any vector length.
+ *
+ * Each square is not greater than 2^62, it is added to 64 bit low word
+ * of accumulator, carry is propagated to high word.
+ *
+ * @param[in]  pX   Pointer to input vector, 32 bit signed.
+ * @param[in]  len  Vector length.
+ *
+ * @return          Sum of squares, 128 bit unsigned.
+ ******************************************************************************/
+uint128_t vec_sum_sqr_xlong_s32(const int32_t *pX, int len)
+{
+    CIMLIB_PROF_FUNC(vec_sum_sqr_xlong_s32, len);
+    int n;
+    uint64_t sqr;
+    uint128_t acc = {0, 0};
+
+    for (n = 0; n < len; n++) {
+        sqr = (uint64_t)((int64_t)pX[n] * pX[n]);
+        acc.lo += sqr;
+        acc.hi += (acc.lo < sqr);
+    }
+
+    return acc;
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/*******************************************************************************
+ * This function tests 'vec_sum_sqr_xlong_s32' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_sum_sqr_xlong_s32(void)
+{
+    uint128_t y;
+    static int32_t x[6] = {
+        INT32_MIN, INT32_MIN, INT32_MIN, INT32_MIN, INT32_MIN, -5
+    };
+    static uint128_t res = {1, ((uint64_t)1 << 62) + 25};
+    bool flOk = true;
+
+    /* Call 'vec_sum_sqr_xlong_s32' function, 64 bit sum wraps */
+    y = vec_sum_sqr_xlong_s32(x, 6);
+
+    /* Check the correctness of the results */
+    if ((y.hi != res.hi) || (y.lo != res.lo)) {
+        flOk = false;
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
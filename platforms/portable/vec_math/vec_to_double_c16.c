@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function converts fixed point vector to double, 16 bit complex.
+ * Input is scaled by multiplication with exact '2^-radix' reciprocal, so
+ * result is the same as of 'CIMLIB_DOUBLE' macro, without division.
+ *
+ * @param[out]  pY     Pointer to output vector, double, interleaved real and
+ *                     imaginary parts, 2 * len values.
+ * @param[in]   len    Vector length.
+ * @param[in]   radix  Input radix, [0..15].
+ * @param[in]   pX     Pointer to input vector, 16 bit complex.
+ ******************************************************************************/
+void vec_to_double_c16(double *pY, int len, int radix, const cint16_t *pX)
+{
+    CIMLIB_PROF_FUNC(vec_to_double_c16, len);
+    int n;
+    double scale = 1.0 / (double)((uint32_t)1 << radix);
+
+    for (n = 0; n < len; n++) {
+        pY[2 * n] = (double)pX[n].re * scale;
+        pY[2 * n + 1] = (double)pX[n].im * scale;
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX  (12)
+#define LSB_1  (1 << RADIX)
+#define LSB_Q  (1 << (RADIX - 2))
+
+
+/*******************************************************************************
+ * This function tests 'vec_to_double_c16' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_to_double_c16(void)
+{
+    int n;
+    double y[4];
+    double res[4];
+    static cint16_t x[2] = {
+        {-LSB_Q - 1, LSB_1 + 1}, {INT16_MAX, INT16_MIN}
+    };
+    bool flOk = true;
+
+    /* Reference values, 'CIMLIB_DOUBLE' macro */
+    for (n = 0; n < 2; n++) {
+        res[2 * n] = CIMLIB_DOUBLE(x[n].re, RADIX);
+        res[2 * n + 1] = CIMLIB_DOUBLE(x[n].im, RADIX);
+    }
+
+    /* Call 'vec_to_double_c16' function */
+    vec_to_double_c16(y, 2, RADIX, x);
+
+    /* Check the correctness of the result, exact */
+    for (n = 0; n < 4; n++) {
+        if (y[n] != res[n]) {
+            flOk = false;
+            printf("val #%3d, out = %f; ref = %f;\n", n, (double)y[n],
+                   (double)res[n]);
+        }
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function converts fixed point vector to double, 32 bit signed.
+ * Input is scaled by multiplication with exact '2^-radix' reciprocal, so
+ * result is the same as of 'CIMLIB_DOUBLE' macro, without division.
+ *
+ * @param[out]  pY     Pointer to output vector, double.
+ * @param[in]   len    Vector length.
+ * @param[in]   radix  Input radix, [0..31].
+ * @param[in]   pX     Pointer to input vector, 32 bit signed.
+ ******************************************************************************/
+void vec_to_double_s32(double *pY, int len, int radix, const int32_t *pX)
+{
+    CIMLIB_PROF_FUNC(vec_to_double_s32, len);
+    int n;
+    double scale = 1.0 / (double)((uint32_t)1 << radix);
+
+    for (n = 0; n < len; n++) {
+        pY[n] = (double)pX[n] * scale;
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX  (16)
+#define LSB_1  (1 << RADIX)
+#define LSB_Q  (1 << (RADIX - 2))
+
+
+/*******************************************************************************
+ * This function tests 'vec_to_double_s32' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_to_double_s32(void)
+{
+    int n;
+    double y[4];
+    double res[4];
+    static int32_t x[4] = {
+        -LSB_Q - 1, LSB_1 + 1, INT32_MAX, INT32_MIN
+    };
+    bool flOk = true;
+
+    /* Reference values, 'CIMLIB_DOUBLE' macro */
+    for (n = 0; n < 4; n++) {
+        res[n] = CIMLIB_DOUBLE(x[n], RADIX);
+    }
+
+    /* Call 'vec_to_double_s32' function */
+    vec_to_double_s32(y, 4, RADIX, x);
+
+    /* Check the correctness of the result, exact */
+    for (n = 0; n < 4; n++) {
+        if (y[n] != res[n]) {
+            flOk = false;
+            printf("val #%3d, out = %f; ref = %f;\n", n, (double)y[n],
+                   (double)res[n]);
+        }
+    }
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
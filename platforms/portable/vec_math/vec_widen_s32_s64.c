@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include "cimlib.h"               /* Library header */
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function widens vector from 32 bit to 64 bit signed, with radix
+ * shift. Result can not overflow, so saturation is not needed.
+ *
+ * @param[out]  pY     Pointer to output vector, 64 bit signed.
+ * @param[in]   len    Vector length.
+ * @param[in]   radix  Number of left shifts, [0..32].
+ * @param[in]   pX     Pointer to input vector, 32 bit signed.
+ ******************************************************************************/
+void vec_widen_s32_s64(int64_t *pY, int len, int radix, const int32_t *pX)
+{
+    CIMLIB_PROF_FUNC(vec_widen_s32_s64, len);
+    int n;
+
+    for (n = 0; n < len; n++) {
+        pY[n] = (int64_t)pX[n] * ((int64_t)1 << radix);
+    }
+}
+
+
+#if (CIMLIB_BUILD_TEST == 1)
+
+/* Simplify macroses for fixed radix */
+#define RADIX          (24)
+#define CONST(X)       CIMLIB_CONST_S32(X, RADIX)
+#define CONST_LONG(X)  CIMLIB_CONST_S64(X, RADIX * 2)
+
+
+/*******************************************************************************
+ * This function tests 'vec_widen_s32_s64' function. Returns 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+bool test_vec_widen_s32_s64(void)
+{
+    int64_t y[4];
+    const int32_t xMin = INT32_MIN;
+    static int32_t x[4] = {
+        CONST(-7.5), CONST(0.25), CONST(-0.75), CONST(3.14)
+    };
+    static int64_t res[4] = {
+        CONST_LONG(-7.5), CONST_LONG(0.25), CONST_LONG(-0.75), 0
+    };
+    bool flOk = true;
+
+    /* Not exactly representable value */
+    res[3] = (int64_t)x[3] * ((int64_t)1 << RADIX);
+
+    /* Call 'vec_widen_s32_s64' function */
+    vec_widen_s32_s64(y, 4, RADIX, x);
+
+    /* Check the correctness of the result */
+    TEST_LIBS_CHECK_RES_REAL(y, res, 4, flOk);
+
+    /* Negative minimum by the widest shift */
+    vec_widen_s32_s64(y, 1, 32, &xMin);
+    flOk = flOk && (y[0] == INT64_MIN);
+
+    return flOk;
+}
+
+#endif /* (CIMLIB_BUILD_TEST == 1) */
@@ -55,18 +55,56 @@ bool test_all(const char *platform)
 
     printf("\nTest frame math library:\n");
 
-    TEST(frm_ema_s16, flPass);
-    TEST(frm_ema_s32, flPass);
+    TEST(frm_cic_decim_s16,  flPass);
+    TEST(frm_cic_interp_s16, flPass);
+    TEST(frm_ema_blk_s32,    flPass);
+    TEST(frm_ema_s16,        flPass);
+    TEST(frm_ema_s32,        flPass);
+    TEST(frm_goertzel_s16,   flPass);
+    TEST(frm_movavg_s16,     flPass);
+    TEST(frm_movavg_s32,     flPass);
+    TEST(frm_movsum_sqr_c16, flPass);
+    TEST(frm_movsum_sqr_s16, flPass);
+    TEST(frm_sdft_c16,       flPass);
+    TEST(frm_stats_s16,      flPass);
+    TEST(frm_stats_s32,      flPass);
 
 
     printf("\nTest memory operations library:\n");
 
-    TEST(mem_kth_min_s16, flPass);
-    TEST(mem_kth_min_s32, flPass);
-    TEST(mem_median_s16,  flPass);
-    TEST(mem_median_s32,  flPass);
-    TEST(mem_sort_s16,    flPass);
-    TEST(mem_sort_s32,    flPass);
+    TEST(mem_arena,           flPass);
+    TEST(mem_kth_min_s16,     flPass);
+    TEST(mem_kth_min_s32,     flPass);
+    TEST(mem_kth_min_ws_s16,  flPass);
+    TEST(mem_kth_min_ws_s32,  flPass);
+    TEST(mem_median_s16,      flPass);
+    TEST(mem_median_s32,      flPass);
+    TEST(mem_median_ws_s16,   flPass);
+    TEST(mem_median_ws_s32,   flPass);
+    TEST(mem_sort_s16,        flPass);
+    TEST(mem_sort_s32,        flPass);
+
+
+    printf("\nTest parallel backend library:\n");
+
+    TEST(par_mem_kth_min_ws_s32,    flPass);
+    TEST(par_mem_median_ws_s32,     flPass);
+    TEST(par_mem_sort_ws_s32,       flPass);
+    TEST(par_pool,                  flPass);
+    TEST(par_ring,                  flPass);
+    TEST(par_sched,                 flPass);
+    TEST(par_vec_max_s32,           flPass);
+    TEST(par_vec_mul_c16,           flPass);
+    TEST(par_vec_mul_c32,           flPass);
+    TEST(par_vec_sum_s32,           flPass);
+    TEST(par_vec_sum_sqr_long_s32,  flPass);
+
+
+    printf("\nTest profile library:\n");
+
+    TEST(prof_cnt,  flPass);
+    TEST(prof_dump, flPass);
+    TEST(prof_sat,  flPass);
 
 
     printf("\nTest scalar math library:\n");
@@ -156,6 +194,7 @@ bool test_all(const char *platform)
     TEST(sc_sqr_sat_c32,     flPass);
     TEST(sc_sqr_sat_s16,     flPass);
     TEST(sc_sqr_sat_s32,     flPass);
+    TEST(sc_sqr_xlong_s64,   flPass);
     TEST(sc_sqrt_u32,        flPass);
     TEST(sc_sqrt_u64,        flPass);
     TEST(sc_sub_c16,         flPass);
@@ -168,7 +207,10 @@ bool test_all(const char *platform)
     TEST(vec_abs_s32,           flPass);
     TEST(vec_abs_s64,           flPass);
     TEST(vec_add_c16,           flPass);
+    TEST(vec_add_c16p,          flPass);
     TEST(vec_add_c32,           flPass);
+    TEST(vec_add_c32p,          flPass);
+    TEST(vec_add_c64,           flPass);
     TEST(vec_add_const_c16,     flPass);
     TEST(vec_add_const_c32,     flPass);
     TEST(vec_add_const_s16,     flPass);
@@ -179,24 +221,52 @@ bool test_all(const char *platform)
     TEST(vec_add_const_sat_s32, flPass);
     TEST(vec_add_s16,           flPass);
     TEST(vec_add_s32,           flPass);
+    TEST(vec_add_s64,           flPass);
     TEST(vec_add_sat_c16,       flPass);
     TEST(vec_add_sat_c32,       flPass);
     TEST(vec_add_sat_s16,       flPass);
     TEST(vec_add_sat_s32,       flPass);
+    TEST(vec_bfp_add_s16,       flPass);
+    TEST(vec_bfp_from_s16,      flPass);
+    TEST(vec_bfp_from_s32,      flPass);
+    TEST(vec_bfp_headroom_s16,  flPass);
+    TEST(vec_bfp_mac_s16,       flPass);
+    TEST(vec_bfp_mul_s16,       flPass);
+    TEST(vec_bfp_norm_s16,      flPass);
+    TEST(vec_bfp_scale_s16,     flPass);
+    TEST(vec_bfp_sum_sqr_s16,   flPass);
+    TEST(vec_bfp_to_s16,        flPass);
+    TEST(vec_bfp_to_s32,        flPass);
     TEST(vec_cent_mass_s16,     flPass);
     TEST(vec_cent_mass_s32,     flPass);
     TEST(vec_cent_mass_u16,     flPass);
     TEST(vec_cent_mass_u32,     flPass);
+    TEST(vec_deinterleave_c16,  flPass);
+    TEST(vec_deinterleave_c32,  flPass);
     TEST(vec_ema_s16,           flPass);
     TEST(vec_ema_s32,           flPass);
+    TEST(vec_from_double_c16,   flPass);
+    TEST(vec_from_double_c32,   flPass);
+    TEST(vec_from_double_s16,   flPass);
+    TEST(vec_from_double_s32,   flPass);
+    TEST(vec_from_float_c16,    flPass);
+    TEST(vec_from_float_c32,    flPass);
+    TEST(vec_from_float_s16,    flPass);
+    TEST(vec_from_float_s32,    flPass);
+    TEST(vec_interleave_c16,    flPass);
+    TEST(vec_interleave_c32,    flPass);
     TEST(vec_mac_c16,           flPass);
+    TEST(vec_mac_c16p,          flPass);
     TEST(vec_mac_c32,           flPass);
+    TEST(vec_mac_c32p,          flPass);
     TEST(vec_mac_cj_c16,        flPass);
     TEST(vec_mac_cj_c32,        flPass);
     TEST(vec_mac_cj_long_c16,   flPass);
     TEST(vec_mac_cj_long_c32,   flPass);
     TEST(vec_mac_cj_sat_c16,    flPass);
     TEST(vec_mac_cj_sat_c32,    flPass);
+    TEST(vec_mac_cj_scale_sat_c16, flPass);
+    TEST(vec_mac_cj_scale_sat_c32, flPass);
     TEST(vec_mac_long_c16,      flPass);
     TEST(vec_mac_long_c32,      flPass);
     TEST(vec_mac_long_s16,      flPass);
@@ -208,7 +278,9 @@ bool test_all(const char *platform)
     TEST(vec_mac_sat_s16,       flPass);
     TEST(vec_mac_sat_s32,       flPass);
     TEST(vec_mag_c16,           flPass);
+    TEST(vec_mag_c16p,          flPass);
     TEST(vec_mag_c32,           flPass);
+    TEST(vec_mag_c32p,          flPass);
     TEST(vec_max_s16,           flPass);
     TEST(vec_max_s32,           flPass);
     TEST(vec_max_sqr_c16,       flPass);
@@ -229,9 +301,15 @@ bool test_all(const char *platform)
     TEST(vec_min_sqr_sat_c32,   flPass);
     TEST(vec_min_sqr_sat_s16,   flPass);
     TEST(vec_min_sqr_sat_s32,   flPass);
+    TEST(vec_mul_add_sat_c16,   flPass);
+    TEST(vec_mul_add_sat_c32,   flPass);
+    TEST(vec_mul_add_sat_s16,   flPass);
+    TEST(vec_mul_add_sat_s32,   flPass);
     TEST(vec_mul_c16,           flPass);
+    TEST(vec_mul_c16p,          flPass);
     TEST(vec_mul_c16s16,        flPass);
     TEST(vec_mul_c32,           flPass);
+    TEST(vec_mul_c32p,          flPass);
     TEST(vec_mul_c32s32,        flPass);
     TEST(vec_mul_cj_c16,        flPass);
     TEST(vec_mul_cj_c32,        flPass);
@@ -239,6 +317,10 @@ bool test_all(const char *platform)
     TEST(vec_mul_cj_long_c32,   flPass);
     TEST(vec_mul_cj_sat_c16,    flPass);
     TEST(vec_mul_cj_sat_c32,    flPass);
+    TEST(vec_mul_const_add_sat_c16, flPass);
+    TEST(vec_mul_const_add_sat_c32, flPass);
+    TEST(vec_mul_const_add_sat_s16, flPass);
+    TEST(vec_mul_const_add_sat_s32, flPass);
     TEST(vec_mul_const_c16,     flPass);
     TEST(vec_mul_const_c32,     flPass);
     TEST(vec_mul_const_s16,     flPass);
@@ -251,40 +333,56 @@ bool test_all(const char *platform)
     TEST(vec_mul_long_c32,      flPass);
     TEST(vec_mul_long_s16,      flPass);
     TEST(vec_mul_long_s32,      flPass);
+    TEST(vec_mul_mag_c16,       flPass);
+    TEST(vec_mul_mag_c32,       flPass);
     TEST(vec_mul_s16,           flPass);
+    TEST(vec_mul_s16_a,         flPass);
     TEST(vec_mul_s32,           flPass);
     TEST(vec_mul_sat_c16,       flPass);
     TEST(vec_mul_sat_c32,       flPass);
     TEST(vec_mul_sat_s16,       flPass);
     TEST(vec_mul_sat_s32,       flPass);
+    TEST(vec_narrow_sat_c64_c32, flPass);
+    TEST(vec_narrow_sat_s32_s16, flPass);
+    TEST(vec_narrow_sat_s64_s32, flPass);
     TEST(vec_scale_radix_s16,   flPass);
     TEST(vec_scale_radix_s32,   flPass);
     TEST(vec_sqr_c16,           flPass);
     TEST(vec_sqr_c32,           flPass);
     TEST(vec_sqr_long_c16,      flPass);
+    TEST(vec_sqr_long_c16p,     flPass);
     TEST(vec_sqr_long_c32,      flPass);
+    TEST(vec_sqr_long_c32p,     flPass);
     TEST(vec_sqr_long_s16,      flPass);
     TEST(vec_sqr_long_s32,      flPass);
     TEST(vec_sqr_s16,           flPass);
     TEST(vec_sqr_s32,           flPass);
     TEST(vec_sqr_sat_c16,       flPass);
     TEST(vec_sqr_sat_c32,       flPass);
+    TEST(vec_sqr_sat_c64,       flPass);
     TEST(vec_sqr_sat_s16,       flPass);
     TEST(vec_sqr_sat_s32,       flPass);
+    TEST(vec_sqr_sat_s64,       flPass);
     TEST(vec_sqra_long_c16,     flPass);
     TEST(vec_sqra_long_c32,     flPass);
     TEST(vec_sqra_long_s16,     flPass);
     TEST(vec_sqra_long_s32,     flPass);
+    TEST(vec_sqrt_u64,          flPass);
     TEST(vec_sub_c16,           flPass);
+    TEST(vec_sub_c16p,          flPass);
     TEST(vec_sub_c32,           flPass);
+    TEST(vec_sub_c32p,          flPass);
+    TEST(vec_sub_c64,           flPass);
     TEST(vec_sub_s16,           flPass);
     TEST(vec_sub_s32,           flPass);
+    TEST(vec_sub_s64,           flPass);
     TEST(vec_sub_sat_c16,       flPass);
     TEST(vec_sub_sat_c32,       flPass);
     TEST(vec_sub_sat_s16,       flPass);
     TEST(vec_sub_sat_s32,       flPass);
     TEST(vec_sum_c16,           flPass);
     TEST(vec_sum_c32,           flPass);
+    TEST(vec_sum_c64,           flPass);
     TEST(vec_sum_diff_c16,      flPass);
     TEST(vec_sum_diff_c32,      flPass);
     TEST(vec_sum_diff_s16,      flPass);
@@ -296,11 +394,15 @@ bool test_all(const char *platform)
     TEST(vec_sum_mul_c32,       flPass);
     TEST(vec_sum_mul_c32s32,    flPass);
     TEST(vec_sum_mul_cj_c16,    flPass);
+    TEST(vec_sum_mul_cj_c16p,   flPass);
     TEST(vec_sum_mul_cj_c32,    flPass);
+    TEST(vec_sum_mul_cj_c32p,   flPass);
     TEST(vec_sum_mul_s16,       flPass);
+    TEST(vec_sum_mul_s16_a,     flPass);
     TEST(vec_sum_mul_s32,       flPass);
     TEST(vec_sum_s16,           flPass);
     TEST(vec_sum_s32,           flPass);
+    TEST(vec_sum_s64,           flPass);
     TEST(vec_sum_sqr_c16,       flPass);
     TEST(vec_sum_sqr_c32,       flPass);
     TEST(vec_sum_sqr_diff_c16,  flPass);
@@ -313,6 +415,18 @@ bool test_all(const char *platform)
     TEST(vec_sum_sqr_long_s32,  flPass);
     TEST(vec_sum_sqr_s16,       flPass);
     TEST(vec_sum_sqr_s32,       flPass);
+    TEST(vec_sum_sqr_xlong_c32, flPass);
+    TEST(vec_sum_sqr_xlong_s32, flPass);
+    TEST(vec_to_double_c16,     flPass);
+    TEST(vec_to_double_c32,     flPass);
+    TEST(vec_to_double_s16,     flPass);
+    TEST(vec_to_double_s32,     flPass);
+    TEST(vec_to_float_c16,      flPass);
+    TEST(vec_to_float_c32,      flPass);
+    TEST(vec_to_float_s16,      flPass);
+    TEST(vec_to_float_s32,      flPass);
+    TEST(vec_widen_s16_s32,     flPass);
+    TEST(vec_widen_s32_s64,     flPass);
 
 
     if (flPass == true) {
@@ -331,11 +445,29 @@ bool test_all(const char *platform)
  ******************************************************************************/
 int main(int argc, char *argv[])
 {
+#if (CIMLIB_PROFILE == 1)
+    static prof_snap_t snap;
+    static prof_sat_t sat[CIMLIB_PROF_NR_FUNCS];
+    static char buf[65536];
+#endif
+
     (void)argc;
 
     /* Test platform library */
     (void)test_all(argv[1]);
 
+#if (CIMLIB_PROFILE == 1)
+    /* Profile of instrumented library, since last reset of profile test */
+    (void)prof_snapshot(&snap, true);
+    (void)prof_dump(buf, sizeof(buf), &snap, CIMLIB_PROF_TEXT);
+    printf("\n%s", buf);
+
+    /* Saturations of main thread, since reset of saturation test */
+    (void)prof_sat_snapshot(sat);
+    (void)prof_sat_dump(buf, sizeof(buf), sat, CIMLIB_PROF_TEXT);
+    printf("\n%s", buf);
+#endif
+
     return 0;
 }
 #endif /* (CIMLIB_BUILD_TEST_STANDALONE == 1) */
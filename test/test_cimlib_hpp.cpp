@@ -0,0 +1,432 @@
+/*******************************************************************************
+ * Copyright (c) 2017 Vasiliy Nerozin
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the MIT license. See LICENSE.md for details.
+ ******************************************************************************/
+
+/* -----------------------------------------------------------------------------
+ * Includes
+ * ---------------------------------------------------------------------------*/
+#include <stdint.h>          /* Standard integer types */
+#include <stdio.h>           /* Standard IO library */
+#include "cimlib.hpp"        /* Library C++ header */
+
+
+/* -----------------------------------------------------------------------------
+ * Definitions
+ * ---------------------------------------------------------------------------*/
+
+/* Test execution macro */
+#define TEST(func, flPass)                                                     \
+{                                                                              \
+    bool flOk;                                                                 \
+    (flOk) = test_##func();                                                    \
+    (flPass) = ((flPass) && (flOk));                                           \
+    printf("  %24s -> ", #func);                                               \
+    if ((flOk) == 0) {                                                         \
+        printf("failed\n");                                                    \
+    }                                                                          \
+    else {                                                                     \
+        printf("passed\n");                                                    \
+    }                                                                          \
+}
+
+/* Test vector length */
+#define TEST_LEN  (64)
+
+
+/* -----------------------------------------------------------------------------
+ * Local functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * This function evaluates expression by generic single loop, as 'assign'
+ * does for expressions without library kernel.
+ ******************************************************************************/
+template <typename T, typename E>
+static void test_eval(T *pZ, int len, const cimlib::expr<E> &e)
+{
+    int n;
+
+    for (n = 0; n < len; n++) {
+        pZ[n] = (T)e.self().at(n);
+    }
+}
+
+
+/*******************************************************************************
+ * This function generates pseudo random vector, values are in full range of
+ * type with extreme values at the beginning, or in half range.
+ ******************************************************************************/
+template <typename T>
+static void test_gen(T *pX, int len, uint32_t seed, bool flFull)
+{
+    int n;
+    uint64_t val;
+
+    for (n = 0; n < len; n++) {
+        seed = seed * 1103515245u + 12345u;
+        val = ((uint64_t)seed << 32) | (seed >> 1);
+        pX[n] = (T)(val >> ((64 - sizeof(T) * 8) + (flFull ? 0 : 1)));
+    }
+
+    if (flFull) {
+        pX[0] = std::numeric_limits<T>::min();
+        pX[1] = std::numeric_limits<T>::max();
+        pX[2] = std::numeric_limits<T>::min();
+    }
+}
+
+
+/*******************************************************************************
+ * This function checks the correctness of the result.
+ ******************************************************************************/
+template <typename T>
+static bool test_check(const char *pName, const T *pZ, const T *pRes, int len)
+{
+    int n;
+    bool flOk = true;
+
+    for (n = 0; n < len; n++) {
+        if (pZ[n] != pRes[n]) {
+            flOk = false;
+            printf("%s: val #%3d, out = %ld; ref = %ld;\n", pName, n,
+                   (long)pZ[n], (long)pRes[n]);
+        }
+    }
+
+    return flOk;
+}
+
+
+/*******************************************************************************
+ * This function tests vector expressions of one type, each expression which
+ * maps to library kernel is compared with generic single loop result.
+ * Returns 'true' if validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+template <typename T>
+static bool test_expr(int radix)
+{
+    static T xBuf[TEST_LEN], yBuf[TEST_LEN], wBuf[TEST_LEN];
+    static T hxBuf[TEST_LEN], hyBuf[TEST_LEN];
+    static T zBuf[TEST_LEN], res[TEST_LEN];
+    bool flOk = true;
+
+    test_gen(xBuf, TEST_LEN, 1, true);
+    test_gen(yBuf, TEST_LEN, 2, true);
+    test_gen(wBuf, TEST_LEN, 3, true);
+    test_gen(hxBuf, TEST_LEN, 4, false);
+    test_gen(hyBuf, TEST_LEN, 5, false);
+
+    cimlib::span<T> z(zBuf, TEST_LEN);
+    cimlib::span<const T> x(xBuf, TEST_LEN), y(yBuf, TEST_LEN);
+    cimlib::span<const T> w(wBuf, TEST_LEN);
+    cimlib::span<const T> hx(hxBuf, TEST_LEN), hy(hyBuf, TEST_LEN);
+    T k = xBuf[5];
+
+    /* Addition without saturation, half range inputs do not overflow */
+    z = hx + hy;
+    test_eval(res, TEST_LEN, hx + hy);
+    flOk = test_check("add", zBuf, res, TEST_LEN) && flOk;
+
+    z = cimlib::sat(x + y);
+    test_eval(res, TEST_LEN, cimlib::sat(x + y));
+    flOk = test_check("add_sat", zBuf, res, TEST_LEN) && flOk;
+
+    z = cimlib::sat(x - y);
+    test_eval(res, TEST_LEN, cimlib::sat(x - y));
+    flOk = test_check("sub_sat", zBuf, res, TEST_LEN) && flOk;
+
+    z = x * y >> radix;
+    test_eval(res, TEST_LEN, x * y >> radix);
+    flOk = test_check("mul", zBuf, res, TEST_LEN) && flOk;
+
+    z = cimlib::sat(x * y >> radix);
+    test_eval(res, TEST_LEN, cimlib::sat(x * y >> radix));
+    flOk = test_check("mul_sat", zBuf, res, TEST_LEN) && flOk;
+
+    z = cimlib::sat(x * k >> radix);
+    test_eval(res, TEST_LEN, cimlib::sat(x * k >> radix));
+    flOk = test_check("mul_const_sat", zBuf, res, TEST_LEN) && flOk;
+
+    z = cimlib::sat((x * y >> radix) + w);
+    test_eval(res, TEST_LEN, cimlib::sat((x * y >> radix) + w));
+    flOk = test_check("mul_add_sat", zBuf, res, TEST_LEN) && flOk;
+
+    z = cimlib::sat((x * k >> radix) + w);
+    test_eval(res, TEST_LEN, cimlib::sat((x * k >> radix) + w));
+    flOk = test_check("mul_const_add_sat", zBuf, res, TEST_LEN) && flOk;
+
+    /* Expression without kernel, generic loop */
+    z = cimlib::sat((x - y) * k >> radix);
+    test_eval(res, TEST_LEN, cimlib::sat((x - y) * k >> radix));
+    flOk = test_check("generic", zBuf, res, TEST_LEN) && flOk;
+
+    return flOk;
+}
+
+
+/*******************************************************************************
+ * This function tests vector expressions of mixed const and non const spans.
+ * Returns 'true' if validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+template <typename T>
+static bool test_expr_mixed(int radix)
+{
+    static T xBuf[TEST_LEN], yBuf[TEST_LEN], wBuf[TEST_LEN];
+    static T zBuf[TEST_LEN], res[TEST_LEN];
+    bool flOk = true;
+
+    test_gen(xBuf, TEST_LEN, 6, false);
+    test_gen(yBuf, TEST_LEN, 7, true);
+    test_gen(wBuf, TEST_LEN, 8, true);
+
+    cimlib::span<T> z(zBuf, TEST_LEN);
+    cimlib::span<T> x(xBuf, TEST_LEN);
+    cimlib::span<const T> y(yBuf, TEST_LEN), w(wBuf, TEST_LEN);
+    cimlib::span<const T> cx(xBuf, TEST_LEN);
+
+    z = cimlib::sat(x + y);
+    test_eval(res, TEST_LEN, cimlib::sat(cx + y));
+    flOk = test_check("mixed add_sat", zBuf, res, TEST_LEN) && flOk;
+
+    z = cimlib::sat((y * x >> radix) + w);
+    test_eval(res, TEST_LEN, cimlib::sat((y * cx >> radix) + w));
+    flOk = test_check("mixed mul_add_sat", zBuf, res, TEST_LEN) && flOk;
+
+    /* Span assignment copies elements */
+    z = x;
+    flOk = test_check("span copy", zBuf, xBuf, TEST_LEN) && flOk;
+
+    return flOk;
+}
+
+
+/*******************************************************************************
+ * These functions test vector expressions by type. Return 'true' if
+ * validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+static bool test_expr_s16(void)
+{
+    return test_expr<int16_t>(12) && test_expr<int16_t>(15);
+}
+
+static bool test_expr_s32(void)
+{
+    return test_expr<int32_t>(24) && test_expr<int32_t>(31);
+}
+
+static bool test_expr_mixed_s16(void)
+{
+    return test_expr_mixed<int16_t>(13);
+}
+
+static bool test_expr_mixed_s32(void)
+{
+    return test_expr_mixed<int32_t>(29);
+}
+
+
+/*******************************************************************************
+ * This function tests fixed point type of radix 'R', operators and 'sat_*'
+ * functions are compared with scalar functions, 'radix_cast' with shifts,
+ * array overloads with library kernels. Returns 'true' if validation is
+ * successfully done, 'false' - otherwise.
+ ******************************************************************************/
+template <int R, typename T>
+static bool test_fixed(T (*pMul)(T, T, int), T (*pAddSat)(T, T),
+                       T (*pMulSat)(T, T, int))
+{
+    typedef cimlib::fixed<R, T> q_t;
+    typedef typename q_t::wide_type w_t;
+    int n;
+    static T xBuf[TEST_LEN], yBuf[TEST_LEN], wBuf[TEST_LEN];
+    static T res[TEST_LEN];
+    static q_t x[TEST_LEN], y[TEST_LEN], w[TEST_LEN], z[TEST_LEN];
+    bool flOk = true;
+
+    test_gen(xBuf, TEST_LEN, 9, true);
+    test_gen(yBuf, TEST_LEN, 10, true);
+    test_gen(wBuf, TEST_LEN, 11, true);
+    for (n = 0; n < TEST_LEN; n++) {
+        x[n] = q_t(cimlib::raw_t(), xBuf[n]);
+        y[n] = q_t(cimlib::raw_t(), yBuf[n]);
+        w[n] = q_t(cimlib::raw_t(), wBuf[n]);
+    }
+
+    /* Operators wrap around, as scalar functions */
+    for (n = 0; n < TEST_LEN; n++) {
+        flOk = flOk &&
+               ((x[n] + y[n]).v == (T)((w_t)xBuf[n] + yBuf[n])) &&
+               ((x[n] - y[n]).v == (T)((w_t)xBuf[n] - yBuf[n])) &&
+               ((-x[n]).v == (T)-(w_t)xBuf[n]) &&
+               ((x[n] * y[n]).v == pMul(xBuf[n], yBuf[n], R)) &&
+               (cimlib::sat_add(x[n], y[n]).v == pAddSat(xBuf[n], yBuf[n])) &&
+               (cimlib::sat_mul(x[n], y[n]).v == pMulSat(xBuf[n], yBuf[n], R));
+    }
+
+    /* Radix change both ways, negative values too */
+    for (n = 0; n < TEST_LEN; n++) {
+        flOk = flOk &&
+               (cimlib::radix_cast<R - 3>(x[n]).v == (T)(xBuf[n] >> 3)) &&
+               (cimlib::radix_cast<R + 1>(x[n]).v == (T)((w_t)xBuf[n] * 2)) &&
+               (cimlib::radix_cast<R>(x[n]).v == xBuf[n]);
+    }
+    if (!flOk) {
+        printf("fixed: operators or radix_cast mismatch\n");
+    }
+
+    /* Arrays are processed by library kernels */
+    cimlib::vec_mul(z, TEST_LEN, x, y);
+    cimlib::kernel::mul(res, TEST_LEN, R, xBuf, yBuf);
+    flOk = test_check("vec_mul", cimlib::raw(z), res, TEST_LEN) && flOk;
+
+    cimlib::vec_mul_sat(z, TEST_LEN, x, y);
+    cimlib::kernel::mul_sat(res, TEST_LEN, R, xBuf, yBuf);
+    flOk = test_check("vec_mul_sat", cimlib::raw(z), res, TEST_LEN) && flOk;
+
+    cimlib::vec_mul_add_sat(z, TEST_LEN, x, y, w);
+    cimlib::kernel::mul_add_sat(res, TEST_LEN, R, xBuf, yBuf, wBuf);
+    flOk = test_check("vec_mul_add_sat", cimlib::raw(z), res, TEST_LEN) &&
+           flOk;
+
+    return flOk;
+}
+
+
+/*******************************************************************************
+ * This function tests complex fixed point type of radix 'R', product is
+ * compared with scalar function, array overloads with library kernels.
+ * Half range values are used, so products do not overflow. Returns 'true'
+ * if validation is successfully done, 'false' - otherwise.
+ ******************************************************************************/
+template <int R, typename T, typename C>
+static bool test_cfixed(C (*pMul)(C, C, int))
+{
+    typedef cimlib::cfixed<R, T> q_t;
+    typedef typename q_t::real_type r_t;
+    int n;
+    static T xBuf[2 * TEST_LEN], yBuf[2 * TEST_LEN];
+    static C res[TEST_LEN];
+    static q_t x[TEST_LEN], y[TEST_LEN], z[TEST_LEN];
+    C tmp;
+    bool flOk = true;
+
+    test_gen(xBuf, 2 * TEST_LEN, 12, false);
+    test_gen(yBuf, 2 * TEST_LEN, 13, false);
+    for (n = 0; n < TEST_LEN; n++) {
+        x[n] = q_t(r_t(cimlib::raw_t(), xBuf[2 * n]),
+                   r_t(cimlib::raw_t(), xBuf[2 * n + 1]));
+        y[n] = q_t(r_t(cimlib::raw_t(), yBuf[2 * n]),
+                   r_t(cimlib::raw_t(), yBuf[2 * n + 1]));
+    }
+
+    /* Product, as scalar function */
+    for (n = 0; n < TEST_LEN; n++) {
+        tmp = pMul(cimlib::raw(x)[n], cimlib::raw(y)[n], R);
+        flOk = flOk && ((x[n] * y[n]).re.v == tmp.re) &&
+               ((x[n] * y[n]).im.v == tmp.im);
+    }
+    if (!flOk) {
+        printf("cfixed: product mismatch\n");
+    }
+
+    /* Arrays are processed by library kernels */
+    cimlib::vec_mul(z, TEST_LEN, x, y);
+    cimlib::kernel::mul(res, TEST_LEN, R, cimlib::raw(x), cimlib::raw(y));
+    for (n = 0; n < TEST_LEN; n++) {
+        flOk = flOk && (z[n].re.v == res[n].re) && (z[n].im.v == res[n].im);
+    }
+
+    cimlib::vec_mul_sat(z, TEST_LEN, x, y);
+    cimlib::kernel::mul_sat(res, TEST_LEN, R, cimlib::raw(x), cimlib::raw(y));
+    for (n = 0; n < TEST_LEN; n++) {
+        flOk = flOk && (z[n].re.v == res[n].re) && (z[n].im.v == res[n].im);
+    }
+
+    return flOk;
+}
+
+
+/*******************************************************************************
+ * These functions test fixed point types. Return 'true' if validation is
+ * successfully done, 'false' - otherwise.
+ ******************************************************************************/
+static bool test_fixed_s16(void)
+{
+    typedef cimlib::fixed<12, int16_t> q12_t;
+    typedef cimlib::fixed<8, int16_t> q8_t;
+    typedef cimlib::fixed<14, int16_t> q14_t;
+
+    /* Compile time constants and radix change */
+    static_assert(q12_t(1.25).v == CIMLIB_CONST_S16(1.25, 12),
+                  "constant of fixed point type");
+    static_assert(cimlib::radix_cast<8>(q12_t(-1.5)) == q8_t(-1.5),
+                  "radix_cast to lower radix");
+    static_assert(cimlib::radix_cast<14>(q12_t(-1.5)) == q14_t(-1.5),
+                  "radix_cast to higher radix");
+
+    return test_fixed<12, int16_t>(sc_mul_s16, sc_add_sat_s16,
+                                   sc_mul_sat_s16) &&
+           test_fixed<4, int16_t>(sc_mul_s16, sc_add_sat_s16,
+                                  sc_mul_sat_s16);
+}
+
+static bool test_fixed_s32(void)
+{
+    typedef cimlib::fixed<24, int32_t> q24_t;
+    typedef cimlib::fixed<30, int32_t> q30_t;
+
+    static_assert(q24_t(-3.75).v == CIMLIB_CONST_S32(-3.75, 24),
+                  "constant of fixed point type");
+    static_assert(cimlib::radix_cast<30>(q24_t(-1.5)) == q30_t(-1.5),
+                  "radix_cast to higher radix");
+
+    return test_fixed<24, int32_t>(sc_mul_s32, sc_add_sat_s32,
+                                   sc_mul_sat_s32) &&
+           test_fixed<29, int32_t>(sc_mul_s32, sc_add_sat_s32,
+                                   sc_mul_sat_s32);
+}
+
+static bool test_cfixed_c16(void)
+{
+    return test_cfixed<12, int16_t, cint16_t>(sc_mul_c16);
+}
+
+static bool test_cfixed_c32(void)
+{
+    return test_cfixed<24, int32_t, cint32_t>(sc_mul_c32);
+}
+
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+/*******************************************************************************
+ * Main function of C++ header test.
+ ******************************************************************************/
+int main(void)
+{
+    bool flPass = true;
+
+    printf("\nTest C++ header 'cimlib.hpp':\n\n");
+
+    TEST(expr_s16,       flPass);
+    TEST(expr_s32,       flPass);
+    TEST(expr_mixed_s16, flPass);
+    TEST(expr_mixed_s32, flPass);
+    TEST(fixed_s16,      flPass);
+    TEST(fixed_s32,      flPass);
+    TEST(cfixed_c16,     flPass);
+    TEST(cfixed_c32,     flPass);
+
+    if (flPass == true) {
+        printf("\nTest for 'cimlib.hpp' is successfully passed.\n");
+    } else {
+        printf("\nTest for 'cimlib.hpp' is failed.\n");
+    }
+
+    return (flPass == true) ? 0 : 1;
+}
@@ -0,0 +1,245 @@
+#!/usr/bin/env python
+#===============================================================================
+# Copyright (c) 2017 Vasiliy Nerozin
+#
+# This library is free software; you can redistribute it and/or modify it
+# under the terms of the MIT license. See LICENSE.md for details.
+#===============================================================================
+"""Compares two benchmark JSON files of 'make <platform> bench'.
+
+Speedup of each point (function, radix, length) is ratio of median times,
+base / new, so speedup above 1.0 means new build is faster. Confidence
+interval of median of each file is distribution free, from order statistics
+of timed runs, speedup interval is ratio of these intervals. Speedup of
+function is geometric mean over its points.
+
+Band of function speedup is geometric mean of interval bounds of its
+points. It is heuristic, not confidence interval of function speedup: it
+does not account for number of points or for their spread.
+
+Point is regression if upper bound of its speedup interval is below
+'1 - threshold', function is regression if upper bound of its band is below
+it, improvement is symmetric with '1 + threshold'. Band of function can
+average regression of one point away, so exit status is 1 if there are
+regressed points, tool can gate library upgrades.
+
+Usage: bench_compare.py base.json new.json [-t threshold] [-c confidence]
+       bench_compare.py --self-test
+"""
+from __future__ import division, print_function
+
+import argparse
+import json
+import math
+import sys
+
+
+#==========================================================
+# Statistics
+#==========================================================
+
+def median_rank(n, conf):
+    """Returns rank 'j' of confidence interval of median of 'n' samples.
+
+    Interval is [x(j), x(n - j + 1)] of sorted samples, 'j' is the largest
+    rank with binomial tail P(B(n, 0.5) < j) <= (1 - conf) / 2. For few runs
+    'j' is 1, interval is [min, max], its confidence is lower than requested.
+    """
+    alpha = (1.0 - conf) / 2
+    j, tail, coef = 1, 0.0, 1.0
+    for k in range(n):
+        # Tail is P(B(n, 0.5) <= k), so rank 'k + 1' is valid
+        tail += coef / 2 ** n
+        if tail > alpha:
+            break
+        j = k + 1
+        coef = coef * (n - k) / (k + 1)
+
+    return min(j, (n + 1) // 2)
+
+
+def median_ci(samples, conf):
+    """Returns median and its confidence interval (lo, hi) of samples."""
+    x = sorted(samples)
+    n = len(x)
+    med = x[n // 2] if n % 2 else 0.5 * (x[n // 2 - 1] + x[n // 2])
+    j = median_rank(n, conf)
+
+    return med, x[j - 1], x[n - j]
+
+
+def self_test():
+    """Checks interval ranks against published tables of confidence
+    intervals of median (e.g. Conover, Practical Nonparametric Statistics),
+    returns True if all ranks match."""
+    table = {
+        0.95: {6: 1, 7: 1, 8: 1, 9: 2, 10: 2, 11: 2, 12: 3, 13: 3, 14: 3,
+               15: 4, 20: 6, 25: 8, 30: 10},
+        0.99: {10: 1, 20: 4, 30: 8}
+    }
+    ok = True
+    for conf in sorted(table):
+        for n in sorted(table[conf]):
+            j = median_rank(n, conf)
+            if j != table[conf][n]:
+                ok = False
+                print('Rank of %d samples at %g confidence: %d, expected %d'
+                      % (n, conf, j, table[conf][n]))
+
+    # Interval bounds are order statistics x(j) and x(n - j + 1)
+    ok = ok and median_ci(list(range(10, 0, -1)), 0.95) == (5.5, 2, 9)
+
+    print('Self test %s.' % ('passed' if ok else 'failed'))
+
+    return ok
+
+
+def geomean(values):
+    """Returns geometric mean of positive values."""
+    return math.exp(sum(math.log(v) for v in values) / len(values))
+
+
+#==========================================================
+# Comparison
+#==========================================================
+
+def load(path):
+    """Loads bench JSON file, returns header and points by key."""
+    with open(path) as f:
+        data = json.load(f)
+
+    points = {}
+    for res in data['results']:
+        key = (res['name'], res['radix'], res['len'])
+        points[key] = res
+
+    return data, points
+
+
+def compare_point(base, new, conf):
+    """Returns speedup and its confidence interval of one point."""
+    b = base.get('samples') or [base['ns_per_elem']]
+    n = new.get('samples') or [new['ns_per_elem']]
+
+    medB, loB, hiB = median_ci(b, conf)
+    medN, loN, hiN = median_ci(n, conf)
+
+    return medB / medN, loB / hiN, hiB / loN
+
+
+def status(lo, hi, thr):
+    """Returns status of speedup interval."""
+    if hi < 1.0 - thr:
+        return 'REGRESSION'
+    if lo > 1.0 + thr:
+        return 'improved'
+    return '-'
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compare two CIMLIB benchmark JSON files.')
+    parser.add_argument('base', nargs='?',
+                        help='base (old/reference) bench JSON file')
+    parser.add_argument('new', nargs='?', help='new bench JSON file')
+    parser.add_argument('-t', '--threshold', type=float, default=5.0,
+                        help='regression threshold, in percent (5)')
+    parser.add_argument('-c', '--confidence', type=float, default=0.95,
+                        help='confidence level of intervals (0.95)')
+    parser.add_argument('-p', '--points', action='store_true',
+                        help='print all points, not only regressed ones')
+    parser.add_argument('--self-test', action='store_true',
+                        help='check median interval ranks and exit')
+    args = parser.parse_args()
+
+    if args.self_test:
+        return 0 if self_test() else 1
+    if args.new is None:
+        parser.error('base and new bench JSON files are required')
+
+    thr = args.threshold / 100.0
+    dataB, pointsB = load(args.base)
+    dataN, pointsN = load(args.new)
+    keys = sorted(set(pointsB) & set(pointsN),
+                  key=lambda k: (k[0], -1 if k[1] is None else k[1], k[2]))
+
+    print("Base: '%s' platform, %s runs, file '%s'" %
+          (dataB['platform'], dataB['runs'], args.base))
+    print("New:  '%s' platform, %s runs, file '%s'" %
+          (dataN['platform'], dataN['runs'], args.new))
+    print('Speedup is base / new time, %g%% confidence, %g%% threshold' %
+          (100 * args.confidence, args.threshold))
+
+    # Points
+    funcs = {}
+    regPoints = []
+    nrRegPoints = 0
+    for key in keys:
+        sp = compare_point(pointsB[key], pointsN[key], args.confidence)
+        funcs.setdefault(key[0], []).append((key, sp))
+        flReg = status(sp[1], sp[2], thr) == 'REGRESSION'
+        nrRegPoints += flReg
+        if args.points or flReg:
+            regPoints.append((key, sp))
+
+    # Functions
+    print('\n  %-28s %6s %8s %17s %8s  %s' %
+          ('function', 'points', 'speedup', 'band', 'worst', 'status'))
+    families = {}
+    nrReg = 0
+    for name in sorted(funcs):
+        sps = [sp for key, sp in funcs[name]]
+        # Heuristic band, geometric mean of interval bounds of points
+        sp = geomean([s[0] for s in sps])
+        lo = geomean([s[1] for s in sps])
+        hi = geomean([s[2] for s in sps])
+        st = status(lo, hi, thr)
+        nrReg += st == 'REGRESSION'
+
+        print('  %-28s %6d %8.3f   [%6.3f, %6.3f] %8.3f  %s' %
+              (name, len(sps), sp, lo, hi, min(s[0] for s in sps), st))
+
+        fam = families.setdefault(pointsN[funcs[name][0][0]]['family'],
+                                  {'sp': [], 'st': []})
+        fam['sp'].append(sp)
+        fam['st'].append(st)
+
+    # Points of regressions
+    if regPoints:
+        print('\n%s:' % ('Points' if args.points else 'Regressed points'))
+        print('  %-28s %6s %9s %10s %10s %8s %17s' %
+              ('function', 'radix', 'len', 'base ns', 'new ns', 'speedup',
+               'interval'))
+        for key, sp in regPoints:
+            print('  %-28s %6s %9d %10.3f %10.3f %8.3f   [%6.3f, %6.3f]' %
+                  (key[0], '-' if key[1] is None else key[1], key[2],
+                   pointsB[key]['ns_per_elem'], pointsN[key]['ns_per_elem'],
+                   sp[0], sp[1], sp[2]))
+
+    # Families
+    print('\nSummary by family:')
+    print('  %-8s %9s %8s %9s %10s %10s' %
+          ('family', 'functions', 'speedup', 'improved', 'regressed',
+           'unchanged'))
+    for fam in sorted(families):
+        f = families[fam]
+        print('  %-8s %9d %8.3f %9d %10d %10d' %
+              (fam + '_', len(f['sp']), geomean(f['sp']),
+               f['st'].count('improved'), f['st'].count('REGRESSION'),
+               f['st'].count('-')))
+
+    onlyB = len(set(pointsB) - set(pointsN))
+    onlyN = len(set(pointsN) - set(pointsB))
+    if onlyB or onlyN:
+        print('\nNot compared points: %d only in base, %d only in new' %
+              (onlyB, onlyN))
+
+    print('\n%d regressions of %d functions, %d regressed points of %d.' %
+          (nrReg, len(funcs), nrRegPoints, len(keys)))
+
+    # Regression of any point fails, band of function is heuristic
+    return 1 if nrRegPoints else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())